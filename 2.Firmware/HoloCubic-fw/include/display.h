@@ -6,6 +6,57 @@
 #define LCD_BL_PIN 5
 #define LCD_BL_PWM_CHANNEL 0
 
+/*
+ * How rendered stripes get to the panel:
+ * LCD_FLUSH_BLOCKING: single draw buffer, blocking pushColors() on the LVGL core
+ * LCD_FLUSH_DMA:      two draw buffers, each stripe is pushed with SPI DMA,
+ *                     so LVGL draws the next stripe while the previous one is on the wire
+ * LCD_FLUSH_TASK:     a ring of stripe buffers drained by a flush task pinned to
+ *                     the other core, LVGL keeps rendering until the ring is full
+ */
+#define LCD_FLUSH_BLOCKING 0
+#define LCD_FLUSH_DMA 1
+#define LCD_FLUSH_TASK 2
+
+#ifndef LCD_FLUSH_MODE
+#define LCD_FLUSH_MODE LCD_FLUSH_TASK
+#endif
+#define LCD_BUF_LINES 10
+
+/*
+ * With LV_COLOR_16_SWAP in lv_conf.h LVGL already renders RGB565 in the panel's
+ * byte order (high byte first), the stripes go to SPI as they are.
+ * Without it every pixel is swapped on the CPU while it is pushed.
+ */
+#define LCD_SWAP_BYTES (LV_COLOR_16_SWAP == 0)
+
+#define LCD_FLUSH_QUEUE_LEN 4		// stripe buffers in the ring (LCD_FLUSH_TASK)
+#define LCD_FLUSH_TASK_CORE 0		// loop() and LVGL run on core 1
+#define LCD_FLUSH_TASK_PRIO 2
+#define LCD_FLUSH_TASK_STACK 2048	// [bytes], see FlushStats::stack_free
+
+/*
+ * 1: large fills and blends are shared with a worker on the other core (lv_port_gpu).
+ * Off: on the PC runner the hand-off costs more than it saves (its `gpu` scenario),
+ * turn it on only where it measures faster.
+ */
+#ifndef LCD_GPU_WORKER
+#define LCD_GPU_WORKER 0
+#endif
+
+
+struct FlushStats
+{
+	uint32_t queue_depth;		// stripes waiting for the flush task right now
+	uint32_t queue_depth_max;	// deepest the queue got since the last call
+	uint32_t stall_us;			// time LVGL waited for a free stripe buffer
+	uint32_t busy_us;			// time the flush task spent pushing pixels
+	uint32_t stripes;			// stripes pushed since the last call
+	uint32_t period_ms;			// length of the measuring window
+	uint32_t stack_free;		// least stack the flush task had left since it started [bytes]
+	float stripes_per_sec;
+};
+
 
 class Display
 {
@@ -14,8 +65,12 @@ private:
 
 public:
 	void init();
-	void routine();
+	/* Runs LVGL, returns the time until LVGL has something to do again [ms] */
+	uint32_t routine();
 	void setBackLight(float);
+
+	/* Fills `stats` with counters accumulated since the previous call and resets them */
+	void getFlushStats(FlushStats* stats);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file lv_holo_anim.h
+ * Animation container: all frames of a scene in one file, made by ImageToHolo's get_holo_anim.py
+ *
+ * lv_holo_anim_header_t
+ * lv_holo_anim_entry_t[frame_cnt]     offset table, frame `i` is found without reading the others
+ * frame data                          LVGL image data (like a .bin without its header), optionally RLE compressed
+ *
+ * With `tile_size` != 0 the frames between the key frames can be deltas to the previous frame:
+ * a bitmap of the changed tiles (1 bit per tile, rows of tiles, LSB first) followed by the pixels
+ * of the changed tiles (tile by tile, row by row, clipped at the edges), the pixels optionally RLE compressed.
+ * Frame 0 is always a key frame.
+ *
+ * RLE: a control byte `c` then
+ *  - c & 0x80: (c & 0x7F) + 1 times the next unit
+ *  - else:     c + 1 units copied as they are
+ * All numbers are little endian.
+ */
+
+#ifndef LV_HOLO_ANIM_H
+#define LV_HOLO_ANIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+#define LV_HOLO_ANIM_MAGIC          "HANM"
+#define LV_HOLO_ANIM_VERSION        1
+#define LV_HOLO_ANIM_EXT            ".hanim"
+	/* Bits in `lv_holo_anim_entry_t::size`: the frame is RLE compressed / a delta to the previous frame */
+#define LV_HOLO_ANIM_RLE            0x80000000
+#define LV_HOLO_ANIM_DELTA          0x40000000
+#define LV_HOLO_ANIM_SIZE_MASK      0x3FFFFFFF
+	/* Bytes read from the file at once while decompressing */
+#define LV_HOLO_ANIM_READ_BUF       512
+	/* Longest path of a source of the decoders (this one and lv_holo_img), with the '\0' */
+#define LV_HOLO_ANIM_PATH_MAX       64
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	typedef struct
+	{
+		char magic[4];
+		uint16_t version;
+		uint16_t rle_unit;			/* bytes per RLE unit, a pixel of true color frames */
+		lv_img_header_t header;		/* of every frame */
+		uint32_t frame_cnt;
+		uint32_t fps;				/* 0: not known */
+		uint16_t tile_size;			/* of the delta frames in pixels, 0: only key frames */
+		uint16_t key_interval;		/* frames from a key frame to the next, 0: only the first one */
+	} lv_holo_anim_header_t;
+
+	typedef struct
+	{
+		uint32_t offset;			/* from the beginning of the file */
+		uint32_t size;				/* in the file, with `LV_HOLO_ANIM_RLE` and `LV_HOLO_ANIM_DELTA` */
+	} lv_holo_anim_entry_t;
+
+	/* State of the RLE decoder, the input can come in any pieces */
+	typedef struct
+	{
+		uint32_t lit_left;			/* bytes to copy */
+		uint32_t run_left;			/* bytes to repeat from `run_px` */
+		uint8_t run_px[4];
+		uint8_t run_px_got;			/* bytes of `run_px` read so far */
+		uint8_t run_pos;
+		uint8_t unit;
+	} lv_holo_anim_rle_t;
+
+	/* RLE compressed data read from a file through a small buffer, for the decoders reading line by line */
+	typedef struct
+	{
+		lv_fs_file_t* file;
+		lv_holo_anim_rle_t rle;
+		uint32_t decoded;			/* position in the decompressed data */
+		uint32_t in_len;
+		uint32_t in_pos;
+		uint8_t in_buf[LV_HOLO_ANIM_READ_BUF];
+	} lv_holo_anim_rle_file_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Register an image decoder for "S:/path/scene.hanim#<index>" sources ("#0" can be left out).
+	 * Supports the true color formats, reads the frame line by line. Delta frames can't be opened,
+	 * only the key frames */
+	void lv_holo_anim_decoder_init(void);
+
+	/* Check the magic, version, color format and byte order of a header read from a file */
+	bool lv_holo_anim_header_check(const lv_holo_anim_header_t* header);
+
+	/* Size of a decompressed frame in bytes */
+	uint32_t lv_holo_anim_frame_size(const lv_holo_anim_header_t* header);
+
+	/* Bytes of the changed tile bitmap at the beginning of the delta frames */
+	uint32_t lv_holo_anim_delta_bitmap_size(const lv_holo_anim_header_t* header);
+
+	/* Apply the data of a frame (`size` from its entry) to `frame`, the image data shown by `img`
+	 * (not zoomed or rotated), and invalidate the changed tiles of `img`.
+	 * A delta frame needs the previous frame in `frame`. Returns false if the data is damaged */
+	bool lv_holo_anim_frame_apply(const lv_holo_anim_header_t* header, uint32_t size, const uint8_t* data,
+		uint8_t* frame, lv_obj_t* img);
+
+	void lv_holo_anim_rle_init(lv_holo_anim_rle_t* rle, uint8_t unit);
+
+	/* Decompress from `in` to `out` until one of them runs out.
+	 * Returns the number of bytes written to `out`, `in_used` is set to the bytes taken from `in` */
+	uint32_t lv_holo_anim_rle_decode(lv_holo_anim_rle_t* rle, const uint8_t* in, uint32_t in_len, uint32_t* in_used,
+		uint8_t* out, uint32_t out_len);
+
+	/* Start decompressing at `offset` of `file`, where the decompressed data is at `decoded`.
+	 * A run can't go over `offset`: it's the beginning of a frame or a restart marker */
+	bool lv_holo_anim_rle_file_start(lv_holo_anim_rle_file_t* rf, lv_fs_file_t* file, uint32_t offset,
+		uint8_t unit, uint32_t decoded);
+
+	/* Decompress `len` bytes to `buf`. Returns false if the file ends or can't be read */
+	bool lv_holo_anim_rle_file_read(lv_holo_anim_rle_file_t* rf, uint8_t* buf, uint32_t len);
+
+	/* Decompress and drop the bytes up to `pos`, it can't be before `decoded` */
+	bool lv_holo_anim_rle_file_skip_to(lv_holo_anim_rle_file_t* rf, uint32_t pos);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_ANIM_H*/
@@ -0,0 +1,63 @@
+/**
+ * @file lv_holo_img.h
+ * Compressed image file: one image like a .bin, RLE compressed, made by ImageToHolo's get_holo.py --rle
+ *
+ * lv_holo_img_header_t
+ * uint32_t[block_cnt]                 restart markers: file offset of every `restart_rows` rows
+ * image data                          LVGL image data (like a .bin without its header), RLE compressed
+ *
+ * Every block of `restart_rows` rows is compressed on its own (a run never goes over a marker),
+ * so a line can be decoded from the marker of its block instead of the beginning of the image.
+ * RLE as in the animation container (see lv_holo_anim.h). All numbers are little endian.
+ */
+
+#ifndef LV_HOLO_IMG_H
+#define LV_HOLO_IMG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+#define LV_HOLO_IMG_MAGIC           "HIMG"
+#define LV_HOLO_IMG_VERSION         1
+#define LV_HOLO_IMG_EXT             ".himg"
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	typedef struct
+	{
+		char magic[4];
+		uint16_t version;
+		uint16_t rle_unit;			/* bytes per RLE unit, a pixel of true color images */
+		lv_img_header_t header;
+		uint16_t restart_rows;		/* rows between the restart markers */
+		uint16_t reserved;
+	} lv_holo_img_header_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Register an image decoder for "S:/path/img.himg" sources.
+	 * Supports the true color formats, reads the image line by line */
+	void lv_holo_img_decoder_init(void);
+
+	/* Check the magic, version, color format and byte order of a header read from a file */
+	bool lv_holo_img_header_check(const lv_holo_img_header_t* header);
+
+	/* Number of restart markers after the header */
+	uint32_t lv_holo_img_block_cnt(const lv_holo_img_header_t* header);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_IMG_H*/
@@ -0,0 +1,121 @@
+/**
+ * @file lv_holo_io.h
+ * Storage service: a worker on the other core reads, writes and stats files on the SD card
+ * for the LVGL core, which only queues the requests and gets the results in callbacks,
+ * so the UI never waits for the card. The highest priority request is done first
+ * (images about to be shown before log lines).
+ *
+ * The functions are called by the LVGL core only: a free request is taken without a lock,
+ * like the LVGL task that calls the callbacks. Only the worker runs elsewhere.
+ *
+ * Not done here:
+ *  - there is no open operation, every request opens and closes its file;
+ *  - the image decoders still read on their own: the preload of LVGL's decoder
+ *    (LV_IMG_DECODER_PRELOAD_SIZE) with lv_fs on the LVGL core, lv_holo_prefetch with its own worker.
+ *    They share the card with this worker through the FATFS volume lock, not by these priorities.
+ */
+
+#ifndef LV_HOLO_IO_H
+#define LV_HOLO_IO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+	/* Requests queued or being done at once */
+#define LV_HOLO_IO_REQ_MAX          16
+#define LV_HOLO_IO_PATH_MAX         64
+	/* [ms] how often the LVGL core looks for finished requests while there are some */
+#define LV_HOLO_IO_POLL_MS          5
+
+	/* Worker placement on the ESP32 (LVGL runs in loop() on core 1) */
+#define LV_HOLO_IO_CORE             0
+#define LV_HOLO_IO_PRIO             1
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	enum
+	{
+		LV_HOLO_IO_PRIO_LOW,		/* logs, settings */
+		LV_HOLO_IO_PRIO_MID,
+		LV_HOLO_IO_PRIO_HIGH,		/* images on the screen soon */
+		_LV_HOLO_IO_PRIO_NUM,
+	};
+	typedef uint8_t lv_holo_io_prio_t;
+
+	enum
+	{
+		LV_HOLO_IO_READ,
+		LV_HOLO_IO_WRITE,			/* the file is created or truncated */
+		LV_HOLO_IO_APPEND,			/* the file is created if it doesn't exist */
+		LV_HOLO_IO_STAT,
+	};
+	typedef uint8_t lv_holo_io_op_t;
+
+	typedef struct
+	{
+		lv_holo_io_op_t op;
+		const char* path;			/* as requested */
+		bool ok;
+		uint8_t* data;				/* READ: the bytes read */
+		uint32_t len;				/* bytes read or written */
+		uint32_t size;				/* READ, STAT: of the file */
+		void* user_data;
+	} lv_holo_io_res_t;
+
+	/* Called in the LVGL core. A buffer allocated for a read is freed after it returns,
+	 * unless it sets `res->data` to NULL and free()s it later */
+	typedef void (*lv_holo_io_cb_t)(lv_holo_io_res_t* res);
+
+	typedef struct
+	{
+		uint32_t done;				/* requests finished */
+		uint32_t failed;
+		uint32_t bytes_read;
+		uint32_t bytes_written;
+		uint32_t busy_us;			/* time the worker spent on the SD card */
+		uint32_t wait_us_max[_LV_HOLO_IO_PRIO_NUM];	/* longest time from the request to the callback */
+		uint32_t full;				/* requests refused because the queue was full */
+	} lv_holo_io_stats_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Start the worker. `root` is put before the paths without drive letter
+	 * ("" on the ESP32, the SD card's directory on a PC) */
+	void lv_holo_io_init(const char* root);
+
+	/* Read `len` bytes of `path` ("/a.bin" or "S:/a.bin") from `pos` into `buf`.
+	 * `buf` NULL: into a buffer malloc()-ed by the worker, `len` 0: up to the end of the file.
+	 * `cb` may be NULL. Returns false if the queue is full */
+	bool lv_holo_io_read(const char* path, uint32_t pos, void* buf, uint32_t len, lv_holo_io_prio_t prio,
+		lv_holo_io_cb_t cb, void* user_data);
+
+	/* Write `len` bytes to `path` (`op`: LV_HOLO_IO_WRITE or LV_HOLO_IO_APPEND). `data` is copied.
+	 * lv_holo_meta forgets the file's image header when it's done */
+	bool lv_holo_io_write(const char* path, lv_holo_io_op_t op, const void* data, uint32_t len,
+		lv_holo_io_prio_t prio, lv_holo_io_cb_t cb, void* user_data);
+
+	/* Get the size of `path`, `res->ok` is false if it doesn't exist */
+	bool lv_holo_io_stat(const char* path, lv_holo_io_prio_t prio, lv_holo_io_cb_t cb, void* user_data);
+
+	/* Requests queued or being done */
+	uint32_t lv_holo_io_pending(void);
+
+	/* Fills `stats` with counters accumulated since the previous call and resets them */
+	void lv_holo_io_get_stats(lv_holo_io_stats_t* stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_IO_H*/
@@ -0,0 +1,53 @@
+/**
+ * @file lv_holo_jpeg.h
+ * JPEG image decoder: photos are shown from "S:/path/photo.jpg" without converting them to .bin
+ *
+ * Baseline (sequential, Huffman coded) JPEG files with 8 bit samples, grayscale or YCbCr
+ * with 1x1, 2x1, 1x2 or 2x2 luma sampling and restart intervals. Progressive and arithmetic
+ * coded files are not supported.
+ *
+ * The image is decoded one MCU row at a time (8 or 16 lines) into a strip buffer, in step with
+ * LVGL's line reads. Lines above the strip restart the decoding from the top of the image.
+ * The lines of a truncated file fail from the first MCU row whose data is missing.
+ * The decoder and the strip are allocated outside LVGL's memory pool, at most
+ * `LV_HOLO_JPEG_HEAP_MAX` bytes per opened image.
+ */
+
+#ifndef LV_HOLO_JPEG_H
+#define LV_HOLO_JPEG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+	/* Bytes read from the file at once */
+#define LV_HOLO_JPEG_READ_BUF       512
+	/* Max. heap of an opened image (decoder + strip), larger images are scaled down to fit into it */
+#define LV_HOLO_JPEG_HEAP_MAX       (24U * 1024U)
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Register an image decoder for "S:/path/photo.jpg" (or .jpeg) sources.
+	 * The images are decoded to `LV_IMG_CF_TRUE_COLOR` */
+	void lv_holo_jpeg_decoder_init(void);
+
+	/* Scale the images down by 1/2, 1/4 or 1/8 until they fit into `w` x `h` (1/8 is the most).
+	 * 0: no limit in that direction. The default is the display's size (`LV_HOR_RES_MAX` x `LV_VER_RES_MAX`).
+	 * Affects the images opened later, invalidate the cached ones with `lv_img_cache_invalidate_src(NULL)`
+	 * and their headers with `lv_holo_meta_invalidate(NULL)` */
+	void lv_holo_jpeg_set_fit(lv_coord_t w, lv_coord_t h);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_JPEG_H*/
@@ -0,0 +1,114 @@
+/**
+ * @file lv_holo_meta.h
+ * Index of the image files' headers: `lv_img_set_src("S:/...")` and `lv_img_decoder_get_info`
+ * answer from RAM for the files seen before instead of opening the file again
+ *
+ * The index maps two hashes of the path (without the drive letter) to the image header, the size,
+ * the modification time and the first cluster of the file. It is filled on the first access of a
+ * file and can be saved to the SD card, so the files of the previous runs are known from the start.
+ * Index file (little endian):
+ *
+ * lv_holo_meta_file_t
+ * lv_holo_meta_entry_t[entry_cnt]
+ *
+ * Every entry found is checked against the size and the modification time of the file from
+ * `stat_cb` (a directory lookup, the file isn't opened), so files changed on a PC are read again.
+ * The files written on the device are forgotten at once: by `lv_holo_meta_file_opened` for the
+ * "S:" drive, by lv_holo_io and by SdCard for theirs.
+ * Sources which aren't plain files (a frame of an animation "S:/anim.hanim#12") are not indexed.
+ */
+
+#ifndef LV_HOLO_META_H
+#define LV_HOLO_META_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+#define LV_HOLO_META_MAGIC          "HMET"
+#define LV_HOLO_META_VERSION        2
+	/* Max. number of files in the index, a power of 2 */
+#define LV_HOLO_META_ENTRY_MAX      256
+	/* Slots searched for a path from its hash, one of them is replaced when they are all used */
+#define LV_HOLO_META_PROBE          8
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	typedef struct
+	{
+		lv_img_header_t header;
+		uint32_t size;				/* of the file in bytes, 0: unknown */
+		uint32_t cluster;			/* first cluster of the file, 0: unknown */
+		uint32_t stamp;				/* modification time from `stat_cb` */
+	} lv_holo_meta_t;
+
+	typedef struct
+	{
+		uint32_t hash;				/* of the path, 0: unused */
+		uint32_t check;				/* another hash of the path, tells apart the paths of the same `hash` */
+		lv_holo_meta_t meta;
+	} lv_holo_meta_entry_t;
+
+	typedef struct
+	{
+		char magic[4];
+		uint16_t version;
+		uint16_t entry_size;		/* sizeof(lv_holo_meta_entry_t) */
+		uint32_t entry_cnt;
+	} lv_holo_meta_file_t;
+
+	typedef struct
+	{
+		uint32_t hits;				/* headers given without file access */
+		uint32_t misses;			/* files opened to read the header */
+		uint32_t replaced;			/* entries replaced by other files */
+		uint32_t changed;			/* entries of files changed since they were added */
+		uint32_t entry_cnt;			/* files in the index now */
+	} lv_holo_meta_stats_t;
+
+	/* Size and modification time of the file `path` ("S:/..."), false if it doesn't exist */
+	typedef bool (*lv_holo_meta_stat_cb_t)(const char* path, uint32_t* size, uint32_t* stamp);
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Register an image decoder which gives the headers of "S:/..." sources from the index.
+	 * Call it after the other image decoders are registered, the decoders are tried from the last one.
+	 * `index_path` ("S:/...") is loaded if it exists and written by `lv_holo_meta_save`, NULL: not saved.
+	 * `stat_cb` checks the entries, NULL: they are trusted, forget the changed files with
+	 * `lv_holo_meta_invalidate` */
+	void lv_holo_meta_init(const char* index_path, lv_holo_meta_stat_cb_t stat_cb);
+
+	/* Get the header, size and first cluster of an image file, from the index if it's there.
+	 * Returns false if the file doesn't exist or none of the image decoders knows it */
+	bool lv_holo_meta_get(const char* src, lv_holo_meta_t* meta);
+
+	/* Forget a file ("S:/a.bin" or "/a.bin"), e.g. after writing it. NULL: forget every file */
+	void lv_holo_meta_invalidate(const char* src);
+
+	/* To be called by the "S:" drive for every file it opens (see `lv_fs_if_set_open_cb`), in the LVGL core.
+	 * The size and the first cluster of the files read are taken from the decoders' opens,
+	 * the files opened to be written, renamed or removed (`write`) are forgotten */
+	void lv_holo_meta_file_opened(const char* path, bool write, uint32_t size, uint32_t cluster);
+
+	/* Write the index file if files were added or forgotten since it was loaded or written.
+	 * Returns false if it couldn't be written */
+	bool lv_holo_meta_save(void);
+
+	/* Fills `stats` with counters accumulated since the previous call and resets them (except `entry_cnt`) */
+	void lv_holo_meta_get_stats(lv_holo_meta_stats_t* stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_META_H*/
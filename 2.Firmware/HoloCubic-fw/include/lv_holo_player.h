@@ -0,0 +1,73 @@
+/**
+ * @file lv_holo_player.h
+ * Play a sequence of LVGL .bin images (e.g. /Scenes/Holo3D/frame%03d.bin) or an animation
+ * container (/Scenes/Holo3D.hanim, see lv_holo_anim.h) from the SD card on an lv_img with a fixed frame rate
+ */
+
+#ifndef LV_HOLO_PLAYER_H
+#define LV_HOLO_PLAYER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+	/* Frame buffers, the reader fills the next ones while one is shown (falls back to 2 if RAM is short) */
+#define LV_HOLO_PLAYER_RING_LEN     3
+#define LV_HOLO_PLAYER_PATH_MAX     64
+	/* Frame rate if neither the caller nor the container gives one */
+#define LV_HOLO_PLAYER_DEF_FPS      25
+
+	/* Reader placement on the ESP32 (LVGL runs in loop() on core 1) */
+#define LV_HOLO_PLAYER_CORE         0
+#define LV_HOLO_PLAYER_PRIO         1
+
+	/* Read the files stored in consecutive sectors (see sd_raw.h) by sector address, 0: always with FATFS */
+#define LV_HOLO_PLAYER_RAW          1
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	typedef struct
+	{
+		uint32_t frames_shown;
+		uint32_t frames_dropped;	/* frame periods without a new frame from the SD card */
+		uint32_t bytes_read;
+		uint32_t frames_raw;		/* frames read by sector address */
+		uint32_t read_us;			/* time the reader spent on the SD card */
+		uint32_t period_ms;			/* length of the measuring window */
+		float fps;
+		float read_kb_per_sec;		/* SD card throughput while reading */
+	} lv_holo_player_stats_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Play the frames `path_fmt` (printf format with the frame index, path on the SD card
+	 * without drive letter) in a loop on `img` with `fps` frames per second.
+	 * `frame_cnt` 0: count the files. All frames must have the same size.
+	 * A path ending with ".hanim" is opened once as an animation container,
+	 * `frame_cnt` 0 plays all of its frames and `fps` 0 uses the rate stored in it.
+	 * Returns false if the first frame can't be read or there is not enough RAM */
+	bool lv_holo_player_open(lv_obj_t* img, const char* path_fmt, uint32_t frame_cnt, uint32_t fps);
+
+	/* Stop the playback and free the frame buffers. `img` keeps no source */
+	void lv_holo_player_close(void);
+
+	bool lv_holo_player_is_open(void);
+
+	/* Fills `stats` with counters accumulated since the previous call and resets them */
+	void lv_holo_player_get_stats(lv_holo_player_stats_t* stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_PLAYER_H*/
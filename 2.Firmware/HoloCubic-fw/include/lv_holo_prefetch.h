@@ -0,0 +1,65 @@
+/**
+ * @file lv_holo_prefetch.h
+ * Read-ahead of SD card images: a worker on the other core loads the next images
+ * (e.g. frame013.bin after frame012.bin) into RAM, an image decoder serves them from there
+ * and falls back to LVGL's line by line file reads when they are not loaded yet
+ */
+
+#ifndef LV_HOLO_PREFETCH_H
+#define LV_HOLO_PREFETCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+	/* Max. number of image buffers */
+#define LV_HOLO_PREFETCH_SLOT_MAX   4
+#define LV_HOLO_PREFETCH_PATH_MAX   64
+
+	/* Worker placement on the ESP32 (LVGL runs in loop() on core 1) */
+#define LV_HOLO_PREFETCH_CORE       0
+#define LV_HOLO_PREFETCH_PRIO       1
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	typedef struct
+	{
+		uint32_t hits;				/* images opened from RAM */
+		uint32_t misses;			/* images read from the SD card by LVGL */
+		uint32_t stalls;			/* opens waiting for the worker to finish the image */
+		uint32_t stall_us;
+		uint32_t loads;				/* images loaded by the worker */
+		uint32_t bytes_read;
+		uint32_t read_us;
+	} lv_holo_prefetch_stats_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Allocate `slot_cnt` buffers of `slot_size` bytes (a whole .bin file with its header) in DMA capable RAM,
+	 * start the worker and register the image decoder. `root` is put before the paths without drive letter
+	 * for the worker ("" on the ESP32, the SD card's directory on a PC).
+	 * Returns false if there is not enough memory */
+	bool lv_holo_prefetch_init(const char* root, uint32_t slot_cnt, uint32_t slot_size);
+
+	/* Read ahead an image source ("S:/path/img.bin") that will be shown soon.
+	 * Opening "...<number>.bin" requests the next numbers automatically */
+	void lv_holo_prefetch_request(const char* src);
+
+	/* Fills `stats` with counters accumulated since the previous call and resets them */
+	void lv_holo_prefetch_get_stats(lv_holo_prefetch_stats_t* stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_HOLO_PREFETCH_H*/
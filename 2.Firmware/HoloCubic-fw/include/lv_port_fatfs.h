@@ -18,10 +18,26 @@ extern "C" {
 	 *********************/
 #include "lvgl.h"
 #include "ff.h"
+#include "lv_port_fs_cache.h"
 	 /*********************
 	  *      DEFINES
 	  *********************/
 	void lv_fs_if_init(void);
+
+	/* Called for every file opened on the "S:" drive with its path without the drive letter ("dir/a.bin"),
+	 * `write` for the files opened to be written, renamed (both names) or removed, the size and
+	 * the first cluster (0 for an empty file) */
+	typedef void (*lv_fs_if_open_cb_t)(const char* path, bool write, uint32_t size, uint32_t cluster);
+	void lv_fs_if_set_open_cb(lv_fs_if_open_cb_t cb);
+
+	/* Size and modification time (FAT date << 16 | time) of `path` ("S:/dir/a.bin") without opening it.
+	 * Returns false if it isn't a file */
+	bool lv_fs_if_stat(const char* path, uint32_t* size, uint32_t* stamp);
+
+	/* Sectors of the read cache of the files opened later (`LV_PORT_FS_CACHE_SECTORS` by default), 0: no cache.
+	 * The buffer is the driver's `file_extra_size`, the decoders count it in the image cache's budget.
+	 * See `lv_port_fs_cache_get_stats` for the hits */
+	void lv_fs_if_set_cache(uint32_t sectors);
 	/**********************
 	 *      TYPEDEFS
 	 **********************/
@@ -0,0 +1,83 @@
+/**
+ * @file lv_port_fs_cache.h
+ * Read cache of an opened file for the file system ports: small and seeking reads (image headers
+ * and lines, fonts) are served from a few whole sectors read at once instead of reaching the card
+ * one by one
+ *
+ * The cache holds `sectors` consecutive sectors of the file. When the reads go on where the
+ * previous one ended, the whole cache is filled (read-ahead), otherwise only the sectors of the
+ * read. The whole sectors of large reads are read into the reader's buffer without the cache.
+ * The file is read by the port's callback from sector aligned positions, so FATFS can transfer
+ * the sectors from the card without its own sector buffer.
+ */
+
+#ifndef LV_PORT_FS_CACHE_H
+#define LV_PORT_FS_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+#define LV_PORT_FS_CACHE_SECTOR     512
+	/* Default sectors cached per opened file */
+#define LV_PORT_FS_CACHE_SECTORS    8
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	/* Read `btr` bytes of `file` from the position `pos` */
+	typedef lv_fs_res_t (*lv_port_fs_cache_read_cb_t)(void* file, uint32_t pos, void* buf, uint32_t btr, uint32_t* br);
+
+	typedef struct
+	{
+		void* file;					/* given to `read_cb` */
+		lv_port_fs_cache_read_cb_t read_cb;
+		uint8_t* buf;				/* allocated on the first read through the cache */
+		uint32_t buf_size;			/* whole sectors, 0: no cache */
+		uint32_t buf_pos;			/* file position of `buf[0]` */
+		uint32_t buf_len;			/* valid bytes in `buf` */
+		uint32_t pos;				/* the read/write pointer of the file */
+		uint32_t prev_end;			/* where the previous read ended */
+	} lv_port_fs_cache_t;
+
+	typedef struct
+	{
+		uint32_t hits;				/* reads served from the cache */
+		uint32_t misses;			/* reads which read the file */
+		uint32_t bytes_read;		/* given to the readers */
+		uint32_t bytes_file;		/* read from the file, with the read-ahead */
+		uint32_t bytes_direct;		/* read from the file into the readers' buffers */
+	} lv_port_fs_cache_stats_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Set up the cache of an opened file at position 0, `sectors` 0: every read goes to `read_cb` */
+	void lv_port_fs_cache_init(lv_port_fs_cache_t* cache, void* file, lv_port_fs_cache_read_cb_t read_cb,
+		uint32_t sectors);
+
+	/* Free the buffer when the file is closed */
+	void lv_port_fs_cache_free(lv_port_fs_cache_t* cache);
+
+	/* Read from `cache->pos` and move it */
+	lv_fs_res_t lv_port_fs_cache_read(lv_port_fs_cache_t* cache, void* buf, uint32_t btr, uint32_t* br);
+
+	/* Forget the cached data, e.g. after writing the file */
+	void lv_port_fs_cache_invalidate(lv_port_fs_cache_t* cache);
+
+	/* Fills `stats` with counters of every file accumulated since the previous call and resets them */
+	void lv_port_fs_cache_get_stats(lv_port_fs_cache_stats_t* stats);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_PORT_FS_CACHE_H*/
@@ -0,0 +1,44 @@
+/**
+ * @file lv_port_gpu.h
+ * "Software GPU": LVGL fills and blends shared with the second ESP32 core
+ */
+
+#ifndef LV_PORT_GPU_H
+#define LV_PORT_GPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include "lvgl.h"
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+	/* Fills smaller than this (in pixels) are done inline on the LVGL core.
+	 * A job costs a wake up of the worker and of the LVGL core, only most of a draw buffer pays it off */
+#define LV_PORT_GPU_FILL_MIN_PX     (LV_HOR_RES_MAX * 8)
+	/* Blended areas smaller than this (in pixels) are done inline on the LVGL core */
+#define LV_PORT_GPU_BLEND_MIN_PX    (LV_HOR_RES_MAX * 4)
+	/* Pending jobs for the worker, when full the LVGL core does the job itself */
+#define LV_PORT_GPU_QUEUE_LEN       8
+
+	/* Worker placement on the ESP32 (LVGL runs in loop() on core 1) */
+#define LV_PORT_GPU_CORE            0
+#define LV_PORT_GPU_PRIO            3
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Start the worker and set `gpu_fill_cb`, `gpu_blend_cb` and `gpu_wait_cb` in `disp_drv`.
+	 * Call it before `lv_disp_drv_register()` */
+	void lv_port_gpu_init(lv_disp_drv_t* disp_drv);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_PORT_GPU_H*/
@@ -0,0 +1,37 @@
+#ifndef SD_BENCH_H
+#define SD_BENCH_H
+
+#include <Arduino.h>
+
+#define SD_BENCH_FILE_SIZE    (1024 * 1024)  // [bytes] test file, written by the sequential write test
+#define SD_BENCH_RANDOM_BYTES (256 * 1024)   // [bytes] moved by each random access test
+#define SD_BENCH_CHUNK_MIN    512
+#define SD_BENCH_CHUNK_MAX    (32 * 1024)
+
+// File APIs measured, can be or-ed
+#define SD_BENCH_API_ARDUINO  0x01  // SD.open(), File::read()
+#define SD_BENCH_API_FATFS    0x02  // f_open(), f_read()
+#define SD_BENCH_API_LV_FS    0x04  // lv_fs_open(), lv_fs_read() through the port's read cache
+#define SD_BENCH_API_RAW      0x08  // sd_raw_open(), sd_raw_read(): aligned reads by sector address
+#define SD_BENCH_API_ALL      0x0F
+
+/*
+ * Throughput of the SD card through the file APIs of the firmware: sequential and random
+ * writes and reads with chunks from SD_BENCH_CHUNK_MIN to SD_BENCH_CHUNK_MAX bytes,
+ * sector aligned and 1 byte off (file position and buffer). One CSV line per test:
+ *
+ * label,spi_hz,api,op,access,align,chunk,bytes,us,kb_per_s
+ *
+ * The lines go to Serial and are appended to a CSV file on the card, so runs with other
+ * settings (SPI clock, cache size, card) can be compared. Takes a few minutes.
+ * The raw API only reads, aligned, the test file written by the others (if it's contiguous).
+ */
+class SdBench
+{
+public:
+	// Run the tests of `apis` on the test file `path` ("/bench.bin"), append the results to `csv_path`.
+	// `label` describes the settings in the CSV lines. Returns false if the test file can't be written
+	bool run(const char* path, const char* csv_path, const char* label, uint8_t apis = SD_BENCH_API_ALL);
+};
+
+#endif
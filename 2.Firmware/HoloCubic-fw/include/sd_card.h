@@ -4,6 +4,10 @@
 #include "FS.h"
 #include "SD.h"
 #include "SPI.h"
+#include "sd_raw.h"
+#include "lv_holo_io.h"
+
+#define SD_SPI_FREQ 4000000  // [Hz] SPI clock of the SD card
  
 class SdCard
 {
@@ -37,6 +41,27 @@ public:
 
 	void fileIO(  const char* path);
 
+	// Check once that the file is stored in consecutive sectors, false if it's fragmented (see sd_raw.h)
+	bool openContiguous(const char* path, sd_raw_file_t* file);
+
+	// Read `cnt` sectors of a contiguous file from its sector `first`, with one multi-block read
+	bool readSectors(const sd_raw_file_t* file, uint32_t first, uint8_t* buf, uint32_t cnt);
+
+	void closeContiguous(sd_raw_file_t* file);
+
+	// Without waiting for the card, through the storage service (lv_holo_io.h): `cb` is called
+	// in the LVGL loop when it's done. Return false if the service's queue is full
+	bool readFileAsync(const char* path, lv_holo_io_cb_t cb, void* user_data = NULL,
+		lv_holo_io_prio_t prio = LV_HOLO_IO_PRIO_MID);
+
+	bool writeFileAsync(const char* path, const char* message, lv_holo_io_cb_t cb = NULL, void* user_data = NULL);
+
+	bool appendFileAsync(const char* path, const char* message, lv_holo_io_cb_t cb = NULL, void* user_data = NULL);
+
+	// `len` bytes into `buf`, which must stay allocated until `cb`
+	bool readBinAsync(const char* path, uint8_t* buf, uint32_t len, lv_holo_io_cb_t cb, void* user_data = NULL,
+		lv_holo_io_prio_t prio = LV_HOLO_IO_PRIO_HIGH);
+
 };
 
 extern SdCard tf;
@@ -0,0 +1,74 @@
+#ifndef SD_CONFIG_H
+#define SD_CONFIG_H
+
+#include <Arduino.h>
+
+#define CONFIG_FILE_MAX   4096  // [bytes] longer config files are not read
+#define CONFIG_ENTRY_MAX  32
+#define CONFIG_TABLE_SIZE 64    // hash table slots, a power of 2 above CONFIG_ENTRY_MAX
+
+/*
+ * Settings from a config file on the SD card, e.g. /config.txt:
+ *
+ * # comment
+ * wifi.ssid = my network
+ * wifi.password = secret
+ * backlight = 0.2
+ *
+ * The file is read at once and parsed in its buffer: keys and values are NUL terminated in place,
+ * numbers and booleans are converted once. The lookups go through a hash table of the keys.
+ * A value is the rest of its line without the spaces around it.
+ */
+class Config
+{
+private:
+	struct Entry
+	{
+		uint32_t hash;
+		uint16_t key;     // offsets in `data`
+		uint16_t value;
+		int32_t i;
+		float f;
+		uint8_t flags;
+	};
+
+	char path[64];
+	char* data;
+	uint32_t size;
+	uint32_t stamp;       // date and time of the file when it was read
+	Entry entries[CONFIG_ENTRY_MAX];
+	uint8_t table[CONFIG_TABLE_SIZE];  // entry index + 1, 0: empty
+	uint8_t entry_cnt;
+	const char* const* line_keys;  // loadLines() for reload()
+	uint32_t line_key_cnt;
+
+	bool read(const char* path, uint32_t extra);
+	void add(const char* key, const char* value);
+	const Entry* find(const char* key) const;
+
+public:
+	Config();
+	~Config();
+
+	// Read and parse `path` (FATFS path, "/config.txt"). Returns false if it can't be read
+	bool load(const char* path);
+
+	// The old line by line files (/wifi.txt: ssid in line 1, password in line 2): line `i` is `keys[i]`
+	bool loadLines(const char* path, const char* const* keys, uint32_t key_cnt);
+
+	// Read the file again if its size or time changed, returns true if it did. Cheap: only stats the file
+	bool reload();
+
+	// The strings are valid until the next load() or reload()
+	const char* getString(const char* key, const char* def = "") const;
+	int32_t getInt(const char* key, int32_t def = 0) const;
+	float getFloat(const char* key, float def = 0) const;
+	bool getBool(const char* key, bool def = false) const;  // true/yes/on/1, false/no/off/0
+	bool has(const char* key) const;
+
+	uint32_t count() const { return entry_cnt; }
+};
+
+extern Config config;
+
+#endif
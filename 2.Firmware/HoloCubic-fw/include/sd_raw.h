@@ -0,0 +1,69 @@
+/**
+ * @file sd_raw.h
+ * Reading files stored in consecutive sectors of the SD card (e.g. copied with ImageToHolo's
+ * put_sd.py) by sector address, without FATFS: no cluster chain, no sector buffer of FATFS,
+ * multi-block reads straight into the caller's buffer.
+ *
+ * Whether a file is contiguous is checked once on opening, from its cluster chain.
+ * The reads take the lock of the FATFS volume (with `FF_FS_REENTRANT`) like f_read(), so they don't
+ * come between the card accesses of a FATFS call of another task. The file isn't kept open in FATFS:
+ * it mustn't be written or removed while it's read this way, its clusters could be given to another file.
+ * On a PC build every file is "contiguous" and read with stdio.
+ */
+
+#ifndef SD_RAW_H
+#define SD_RAW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/*********************
+	 *      INCLUDES
+	 *********************/
+#include <stdbool.h>
+#include <stdint.h>
+
+	/*********************
+	 *      DEFINES
+	 *********************/
+#define SD_RAW_SECTOR       512
+
+	/**********************
+	 *      TYPEDEFS
+	 **********************/
+	typedef struct
+	{
+		uint32_t sector;			/* first sector of the file on the card */
+		uint32_t sector_cnt;		/* sectors of the file's clusters, can be read */
+		uint32_t size;				/* of the file in bytes */
+		uint8_t pdrv;				/* FATFS physical drive */
+		void* fs;					/* FATFS volume, its lock is taken while reading */
+		void* fp;					/* PC build: the opened file */
+	} sd_raw_file_t;
+
+	/**********************
+	 * GLOBAL PROTOTYPES
+	 **********************/
+	/* Find where `path` (FATFS path, "/Scenes/...") is on the card.
+	 * Returns false if it doesn't exist, is empty or is fragmented (then read it with FATFS) */
+	bool sd_raw_open(const char* path, sd_raw_file_t* file);
+
+	/* Read `cnt` sectors of the file from its sector `first` into `buf` (4 byte aligned, DMA capable).
+	 * The sectors after the end of the file up to the end of its last cluster are read too */
+	bool sd_raw_read(const sd_raw_file_t* file, uint32_t first, void* buf, uint32_t cnt);
+
+	/* Nothing to do on the ESP32, the file isn't kept open */
+	void sd_raw_close(sd_raw_file_t* file);
+
+	/* Sectors to read for `len` bytes from the file position `pos` */
+	static inline uint32_t sd_raw_sector_cnt(uint32_t pos, uint32_t len)
+	{
+		return (pos % SD_RAW_SECTOR + len + SD_RAW_SECTOR - 1) / SD_RAW_SECTOR;
+	}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*SD_RAW_H*/
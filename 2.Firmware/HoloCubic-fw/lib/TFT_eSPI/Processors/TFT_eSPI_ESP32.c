@@ -24,6 +24,8 @@
   #else
     spi_host_device_t spi_host = VSPI_HOST;
   #endif
+  // Called from the SPI ISR when a queued pixel transfer is complete
+  static void (*dmaDoneCallback)(void) = nullptr;
 #endif
 
 #if !defined (TFT_PARALLEL_8_BIT)
@@ -677,6 +679,24 @@ void IRAM_ATTR dc_callback(spi_transaction_t *spi_tx)
   else {DC_C;}
 }
 
+/***************************************************************************************
+** Function name:           dma_done_callback
+** Description:             Notifies the sketch that a DMA pixel transfer is over
+***************************************************************************************/
+static void IRAM_ATTR dma_done_callback(spi_transaction_t *spi_tx)
+{
+  if (dmaDoneCallback) dmaDoneCallback();
+}
+
+/***************************************************************************************
+** Function name:           setDMACallback
+** Description:             Set the function called when a DMA pixel transfer is over
+***************************************************************************************/
+void TFT_eSPI::setDMACallback(void (*cb)(void))
+{
+  dmaDoneCallback = cb;
+}
+
 /***************************************************************************************
 ** Function name:           initDMA
 ** Description:             Initialise the DMA engine - returns true if init OK
@@ -714,7 +734,7 @@ bool TFT_eSPI::initDMA(bool ctrl_cs)
     .flags = SPI_DEVICE_NO_DUMMY, //0,
     .queue_size = 1,
     .pre_cb = 0, //dc_callback, //Callback to handle D/C line
-    .post_cb = 0
+    .post_cb = dma_done_callback
   };
   ret = spi_bus_initialize(spi_host, &buscfg, 1);
   ESP_ERROR_CHECK(ret);
@@ -638,6 +638,12 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     dmaBusy(void); // returns true if DMA is still in progress
   void     dmaWait(void); // wait until DMA is complete
 
+#if defined (ESP32_DMA)
+           // Register a function called from the SPI interrupt when a DMA pixel transfer has finished
+           // Keep it short, it runs in interrupt context (e.g. lv_disp_flush_ready)
+  void     setDMACallback(void (*cb)(void));
+#endif
+
   bool     DMA_Enabled = false;   // Flag for DMA enabled state
   uint8_t  spiBusyCheck = 0;      // Number of ESP32 transfer buffers to check
 
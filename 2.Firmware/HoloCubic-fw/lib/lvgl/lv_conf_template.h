@@ -50,6 +50,28 @@
  * Can be changed in the display driver (`lv_disp_drv_t`).*/
 #define LV_DISP_DEF_REFR_PERIOD      30      /*[ms]*/
 
+/* Adapt the refresh period to the measured render + flush time of the frames.
+ * While something is invalidated the display is refreshed with the target FPS (see `lv_refr_gov_set_fps`)
+ * or as fast as the frames can be drawn. After LV_REFR_GOV_IDLE_TIME without invalidation and input
+ * the refresh and animation tasks are slowed down up to LV_REFR_GOV_IDLE_PERIOD.
+ * The input devices are still read every LV_INDEV_DEF_READ_PERIOD to wake up at once.*/
+#define LV_USE_REFR_GOV          0
+#if LV_USE_REFR_GOV
+#define LV_REFR_GOV_DEF_FPS      (1000 / LV_DISP_DEF_REFR_PERIOD)
+#define LV_REFR_GOV_IDLE_TIME    1000  /*[ms]*/
+#define LV_REFR_GOV_IDLE_PERIOD  300  /*[ms]*/
+#endif
+
+/* Track invalidated areas in a bitmap of LV_REFR_TILE_SIZE x LV_REFR_TILE_SIZE tiles instead of
+ * the list of `LV_INV_BUF_SIZE` areas, which falls back to a full screen redraw when it overflows.
+ * Before refreshing the dirty tiles are turned into areas with a cost model:
+ * every area costs LV_REFR_TILE_AREA_COST extra pixels (address window command, flush setup).*/
+#define LV_REFR_TILE_TRACK       0
+#if LV_REFR_TILE_TRACK
+#define LV_REFR_TILE_SIZE        16  /*8 or 16 [px]*/
+#define LV_REFR_TILE_AREA_COST   256  /*[px]*/
+#endif
+
 /* Dot Per Inch: used to initialize default sizes.
  * E.g. a button with width = LV_DPI / 2 -> half inch wide
  * (Not so important, you can adjust it to modify default sizes and spaces)*/
@@ -182,6 +204,15 @@ typedef void * lv_anim_user_data_t;
 /* 1: Use image zoom and rotation*/
 #define LV_USE_IMG_TRANSFORM    1
 
+/* Anti-aliasing of transformed images with `antialias` enabled.
+ * 1: only the edges of the image are smoothed, the inside is sampled with the nearest pixel (faster)
+ * 0: every pixel is blended with its neighbors */
+#define LV_IMG_TRANSFORM_AA_EDGE 0
+
+/* Lines buffered to rotate/zoom images which are read line-by-line (e.g. from files).
+ * The buffer is `LV_IMG_TRANSFORM_STREAM_ROWS * width * 3` bytes, more lines are read again less often */
+#define LV_IMG_TRANSFORM_STREAM_ROWS 8
+
 /* 1: Enable object groups (for keyboard/encoder navigation) */
 #define LV_USE_GROUP            1
 #if LV_USE_GROUP
@@ -221,6 +252,15 @@ typedef void * lv_fs_drv_user_data_t;
 /*1: Show CPU usage and FPS count in the right bottom corner*/
 #define LV_USE_PERF_MONITOR     0
 
+/*1: Record the draw time of every object and the render and flush time of every area
+ * in a ring buffer. Use `lv_refr_prof_dump()` to print them as CSV or JSON*/
+#define LV_USE_REFR_PROF         0
+#if LV_USE_REFR_PROF
+#define LV_REFR_PROF_BUF_SIZE    256  /*Number of records, the oldest ones are overwritten*/
+#define LV_REFR_PROF_INCLUDE     <stdint.h>  /*Header for the time function*/
+#define LV_REFR_PROF_TIME_EXPR   (lv_tick_get() * 1000)  /*Expression evaluating to current time in us*/
+#endif
+
 /*1: Use the functions and types from the older API if possible */
 #define LV_USE_API_EXTENSION_V6  1
 #define LV_USE_API_EXTENSION_V7  1
@@ -243,6 +283,24 @@ typedef void * lv_fs_drv_user_data_t;
  * Set it to 0 to disable caching */
 #define LV_IMG_CACHE_DEF_SIZE       1
 
+/* Bytes the cached images can keep allocated (decoded pixels, file buffers, palettes).
+ * The images least recently used and cheapest to open are closed first. 0: limit only the number of images */
+#define LV_IMG_CACHE_DEF_BUDGET     0
+
+/* Bytes the built-in decoder reads ahead from image files, starting on a 512 byte sector boundary.
+ * Lines are then served from this buffer instead of one seek + read per line.
+ * Size it to the display buffer (plus a sector for the alignment). 0: read line by line */
+#define LV_IMG_DECODER_STRIP_SIZE 0
+
+/* 1: Unpack the lines of indexed images a byte at a time with a table of the decoded pixels of every byte value.
+ * Costs 256 * (8 / bpp) * LV_IMG_PX_SIZE_ALPHA_BYTE bytes per opened indexed image (e.g. 1.5 kB with 4 bit at 16 bit color)*/
+#define LV_IMG_DECODER_INDEXED_LUT 0
+
+/* Load true color image files not greater than this (in bytes, without the header) to RAM when opened
+ * and draw them from there instead of reading them line by line on every redraw.
+ * Needs the image cache and the image has to fit into LV_IMG_CACHE_DEF_BUDGET. 0: always read line by line */
+#define LV_IMG_DECODER_PRELOAD_SIZE 0
+
 /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
 typedef void * lv_img_decoder_user_data_t;
 
@@ -132,6 +132,66 @@
 #  else
 #    define  LV_DISP_DEF_REFR_PERIOD      30      /*[ms]*/
 #  endif
+#endif
+
+/* Adapt the refresh period to the measured render + flush time of the frames.
+ * While something is invalidated the display is refreshed with the target FPS (see `lv_refr_gov_set_fps`)
+ * or as fast as the frames can be drawn. After LV_REFR_GOV_IDLE_TIME without invalidation and input
+ * the refresh and animation tasks are slowed down up to LV_REFR_GOV_IDLE_PERIOD.
+ * The input devices are still read every LV_INDEV_DEF_READ_PERIOD to wake up at once.*/
+#ifndef LV_USE_REFR_GOV
+#  ifdef CONFIG_LV_USE_REFR_GOV
+#    define LV_USE_REFR_GOV CONFIG_LV_USE_REFR_GOV
+#  else
+#    define  LV_USE_REFR_GOV 0
+#  endif
+#endif
+#ifndef LV_REFR_GOV_DEF_FPS
+#  ifdef CONFIG_LV_REFR_GOV_DEF_FPS
+#    define LV_REFR_GOV_DEF_FPS CONFIG_LV_REFR_GOV_DEF_FPS
+#  else
+#    define  LV_REFR_GOV_DEF_FPS (1000 / LV_DISP_DEF_REFR_PERIOD)
+#  endif
+#endif
+#ifndef LV_REFR_GOV_IDLE_TIME
+#  ifdef CONFIG_LV_REFR_GOV_IDLE_TIME
+#    define LV_REFR_GOV_IDLE_TIME CONFIG_LV_REFR_GOV_IDLE_TIME
+#  else
+#    define  LV_REFR_GOV_IDLE_TIME 1000  /*[ms]*/
+#  endif
+#endif
+#ifndef LV_REFR_GOV_IDLE_PERIOD
+#  ifdef CONFIG_LV_REFR_GOV_IDLE_PERIOD
+#    define LV_REFR_GOV_IDLE_PERIOD CONFIG_LV_REFR_GOV_IDLE_PERIOD
+#  else
+#    define  LV_REFR_GOV_IDLE_PERIOD 300  /*[ms]*/
+#  endif
+#endif
+
+/* Track invalidated areas in a bitmap of LV_REFR_TILE_SIZE x LV_REFR_TILE_SIZE tiles instead of
+ * the list of `LV_INV_BUF_SIZE` areas, which falls back to a full screen redraw when it overflows.
+ * Before refreshing the dirty tiles are turned into areas with a cost model:
+ * every area costs LV_REFR_TILE_AREA_COST extra pixels (address window command, flush setup).*/
+#ifndef LV_REFR_TILE_TRACK
+#  ifdef CONFIG_LV_REFR_TILE_TRACK
+#    define LV_REFR_TILE_TRACK CONFIG_LV_REFR_TILE_TRACK
+#  else
+#    define  LV_REFR_TILE_TRACK 0
+#  endif
+#endif
+#ifndef LV_REFR_TILE_SIZE
+#  ifdef CONFIG_LV_REFR_TILE_SIZE
+#    define LV_REFR_TILE_SIZE CONFIG_LV_REFR_TILE_SIZE
+#  else
+#    define  LV_REFR_TILE_SIZE 16  /*8 or 16 [px]*/
+#  endif
+#endif
+#ifndef LV_REFR_TILE_AREA_COST
+#  ifdef CONFIG_LV_REFR_TILE_AREA_COST
+#    define LV_REFR_TILE_AREA_COST CONFIG_LV_REFR_TILE_AREA_COST
+#  else
+#    define  LV_REFR_TILE_AREA_COST 256  /*[px]*/
+#  endif
 #endif
 
  /* Dot Per Inch: used to initialize default sizes.
@@ -462,6 +522,27 @@
 #  endif
 #endif
 
+/* Anti-aliasing of transformed images with `antialias` enabled.
+ * 1: only the edges of the image are smoothed, the inside is sampled with the nearest pixel (faster)
+ * 0: every pixel is blended with its neighbors */
+#ifndef LV_IMG_TRANSFORM_AA_EDGE
+#  ifdef CONFIG_LV_IMG_TRANSFORM_AA_EDGE
+#    define LV_IMG_TRANSFORM_AA_EDGE CONFIG_LV_IMG_TRANSFORM_AA_EDGE
+#  else
+#    define  LV_IMG_TRANSFORM_AA_EDGE 0
+#  endif
+#endif
+
+/* Lines buffered to rotate/zoom images which are read line-by-line (e.g. from files).
+ * The buffer is `LV_IMG_TRANSFORM_STREAM_ROWS * width * 3` bytes, more lines are read again less often */
+#ifndef LV_IMG_TRANSFORM_STREAM_ROWS
+#  ifdef CONFIG_LV_IMG_TRANSFORM_STREAM_ROWS
+#    define LV_IMG_TRANSFORM_STREAM_ROWS CONFIG_LV_IMG_TRANSFORM_STREAM_ROWS
+#  else
+#    define  LV_IMG_TRANSFORM_STREAM_ROWS 8
+#  endif
+#endif
+
 /* 1: Enable object groups (for keyboard/encoder navigation) */
 #ifndef LV_USE_GROUP
 #  ifdef CONFIG_LV_USE_GROUP
@@ -559,6 +640,37 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #  endif
 #endif
 
+/*1: Record the draw time of every object and the render and flush time of every area
+ * in a ring buffer. Use `lv_refr_prof_dump()` to print them as CSV or JSON*/
+#ifndef LV_USE_REFR_PROF
+#  ifdef CONFIG_LV_USE_REFR_PROF
+#    define LV_USE_REFR_PROF CONFIG_LV_USE_REFR_PROF
+#  else
+#    define  LV_USE_REFR_PROF 0
+#  endif
+#endif
+#ifndef LV_REFR_PROF_BUF_SIZE
+#  ifdef CONFIG_LV_REFR_PROF_BUF_SIZE
+#    define LV_REFR_PROF_BUF_SIZE CONFIG_LV_REFR_PROF_BUF_SIZE
+#  else
+#    define  LV_REFR_PROF_BUF_SIZE 256  /*Number of records, the oldest ones are overwritten*/
+#  endif
+#endif
+#ifndef LV_REFR_PROF_INCLUDE
+#  ifdef CONFIG_LV_REFR_PROF_INCLUDE
+#    define LV_REFR_PROF_INCLUDE CONFIG_LV_REFR_PROF_INCLUDE
+#  else
+#    define  LV_REFR_PROF_INCLUDE <stdint.h>  /*Header for the time function*/
+#  endif
+#endif
+#ifndef LV_REFR_PROF_TIME_EXPR
+#  ifdef CONFIG_LV_REFR_PROF_TIME_EXPR
+#    define LV_REFR_PROF_TIME_EXPR CONFIG_LV_REFR_PROF_TIME_EXPR
+#  else
+#    define  LV_REFR_PROF_TIME_EXPR (lv_tick_get() * 1000)  /*Expression evaluating to current time in us*/
+#  endif
+#endif
+
 /*1: Use the functions and types from the older API if possible */
 #ifndef LV_USE_API_EXTENSION_V6
 #  ifdef CONFIG_LV_USE_API_EXTENSION_V6
@@ -609,6 +721,48 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #  else
 #    define  LV_IMG_CACHE_DEF_SIZE       1
 #  endif
+#endif
+
+/* Bytes the cached images can keep allocated (decoded pixels, file buffers, palettes).
+ * The images least recently used and cheapest to open are closed first. 0: limit only the number of images */
+#ifndef LV_IMG_CACHE_DEF_BUDGET
+#  ifdef CONFIG_LV_IMG_CACHE_DEF_BUDGET
+#    define LV_IMG_CACHE_DEF_BUDGET CONFIG_LV_IMG_CACHE_DEF_BUDGET
+#  else
+#    define  LV_IMG_CACHE_DEF_BUDGET 0
+#  endif
+#endif
+
+/* Bytes the built-in decoder reads ahead from image files, starting on a 512 byte sector boundary.
+ * Lines are then served from this buffer instead of one seek + read per line.
+ * Size it to the display buffer (plus a sector for the alignment). 0: read line by line */
+#ifndef LV_IMG_DECODER_STRIP_SIZE
+#  ifdef CONFIG_LV_IMG_DECODER_STRIP_SIZE
+#    define LV_IMG_DECODER_STRIP_SIZE CONFIG_LV_IMG_DECODER_STRIP_SIZE
+#  else
+#    define  LV_IMG_DECODER_STRIP_SIZE 0
+#  endif
+#endif
+
+/* 1: Unpack the lines of indexed images a byte at a time with a table of the decoded pixels of every byte value.
+ * Costs 256 * (8 / bpp) * LV_IMG_PX_SIZE_ALPHA_BYTE bytes per opened indexed image (e.g. 1.5 kB with 4 bit at 16 bit color)*/
+#ifndef LV_IMG_DECODER_INDEXED_LUT
+#  ifdef CONFIG_LV_IMG_DECODER_INDEXED_LUT
+#    define LV_IMG_DECODER_INDEXED_LUT CONFIG_LV_IMG_DECODER_INDEXED_LUT
+#  else
+#    define  LV_IMG_DECODER_INDEXED_LUT 0
+#  endif
+#endif
+
+/* Load true color image files not greater than this (in bytes, without the header) to RAM when opened
+ * and draw them from there instead of reading them line by line on every redraw.
+ * Needs the image cache and the image has to fit into LV_IMG_CACHE_DEF_BUDGET. 0: always read line by line */
+#ifndef LV_IMG_DECODER_PRELOAD_SIZE
+#  ifdef CONFIG_LV_IMG_DECODER_PRELOAD_SIZE
+#    define LV_IMG_DECODER_PRELOAD_SIZE CONFIG_LV_IMG_DECODER_PRELOAD_SIZE
+#  else
+#    define  LV_IMG_DECODER_PRELOAD_SIZE 0
+#  endif
 #endif
 
  /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
@@ -23,6 +23,11 @@
     #include "../lv_widgets/lv_label.h"
 #endif
 
+#if LV_USE_REFR_PROF
+    #include "../lv_misc/lv_printf.h"
+    #include LV_REFR_PROF_INCLUDE
+#endif
+
 #if defined(LV_GC_INCLUDE)
     #include LV_GC_INCLUDE
 #endif /* LV_ENABLE_GC */
@@ -40,6 +45,10 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_REFR_TILE_TRACK
+static void lv_refr_tiles_to_areas(void);
+static bool lv_refr_tile_merge_gain(const lv_area_t * a1, const lv_area_t * a2, int32_t * gain);
+#endif
 static void lv_refr_join_area(void);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
@@ -48,6 +57,15 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
 static void lv_refr_vdb_flush(void);
+#if LV_USE_REFR_PROF
+static lv_refr_prof_rec_t * prof_add(lv_refr_prof_type_t type, const lv_area_t * area, uint32_t time);
+#endif
+#if LV_USE_REFR_GOV
+static void gov_frame(uint32_t cost);
+static void gov_idle(void);
+static uint32_t gov_active_period(lv_disp_t * disp);
+static void gov_set_period(lv_disp_t * disp, uint32_t period, bool idle);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -58,6 +76,12 @@ static lv_disp_t * disp_refr; /*Display being refreshed*/
     static uint32_t fps_sum_cnt;
     static uint32_t fps_sum_all;
 #endif
+#if LV_USE_REFR_PROF
+    static lv_refr_prof_rec_t prof_buf[LV_REFR_PROF_BUF_SIZE];
+    static uint32_t prof_cnt;        /*Number of records ever added*/
+    static uint32_t prof_frame;
+    static uint32_t prof_child_time; /*Time spent with the children of the object being drawn*/
+#endif
 
 /**********************
  *      MACROS
@@ -115,6 +139,9 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_REFR_TILE_TRACK
+        _lv_memset_00(disp->inv_tiles, sizeof(disp->inv_tiles));
+#endif
         return;
     }
 
@@ -131,8 +158,35 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
 
     /*The area is truncated to the screen*/
     if(suc != false) {
+#if LV_USE_REFR_GOV
+        /*Something changes, refresh with the target FPS again*/
+        if(disp->gov.idle) gov_set_period(disp, gov_active_period(disp), false);
+#endif
+
         if(disp->driver.rounder_cb) disp->driver.rounder_cb(&disp->driver, &com_area);
 
+#if LV_REFR_TILE_TRACK
+        /*Only mark the tiles, the areas are created in `lv_refr_tiles_to_areas`*/
+        if(!_lv_area_intersect(&com_area, &com_area, &scr_area)) return;
+
+        lv_coord_t col1 = com_area.x1 / LV_REFR_TILE_SIZE;
+        lv_coord_t col2 = com_area.x2 / LV_REFR_TILE_SIZE;
+        lv_coord_t row1 = com_area.y1 / LV_REFR_TILE_SIZE;
+        lv_coord_t row2 = com_area.y2 / LV_REFR_TILE_SIZE;
+        if(col2 >= LV_REFR_TILE_COLS) col2 = LV_REFR_TILE_COLS - 1;
+        if(row2 >= LV_REFR_TILE_ROWS) row2 = LV_REFR_TILE_ROWS - 1;
+
+        lv_coord_t row;
+        lv_coord_t col;
+        for(row = row1; row <= row2; row++) {
+            for(col = col1; col <= col2; col++) {
+                disp->inv_tiles[row][col >> 5] |= (uint32_t)1 << (col & 0x1F);
+            }
+        }
+        lv_task_set_prio(disp->refr_task, LV_REFR_TASK_PRIO);
+        return;
+#endif
+
         /*Save only if this area is not in one of the saved areas*/
         uint16_t i;
         for(i = 0; i < disp->inv_p; i++) {
@@ -185,9 +239,14 @@ void _lv_disp_refr_task(lv_task_t * task)
 
     disp_refr = task->user_data;
 
-#if LV_USE_PERF_MONITOR == 0
+#if LV_USE_REFR_PROF
+    prof_frame++;
+#endif
+
+#if LV_USE_PERF_MONITOR == 0 && LV_USE_REFR_GOV == 0
     /* Ensure the task does not run again automatically.
      * This is done before refreshing in case refreshing invalidates something else.
+     * The governor keeps the task running to notice when the display becomes idle.
      */
     lv_task_set_prio(task, LV_TASK_PRIO_OFF);
 #endif
@@ -195,9 +254,16 @@ void _lv_disp_refr_task(lv_task_t * task)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_REFR_TILE_TRACK
+        _lv_memset_00(disp_refr->inv_tiles, sizeof(disp_refr->inv_tiles));
+#endif
         return;
     }
 
+#if LV_REFR_TILE_TRACK
+    lv_refr_tiles_to_areas();
+#endif
+
     lv_refr_join_area();
 
     lv_refr_areas();
@@ -272,7 +338,16 @@ void _lv_disp_refr_task(lv_task_t * task)
         if(disp_refr->driver.monitor_cb) {
             disp_refr->driver.monitor_cb(&disp_refr->driver, elaps, px_num);
         }
+
+#if LV_USE_REFR_GOV
+        gov_frame(elaps);
+#endif
+    }
+#if LV_USE_REFR_GOV
+    else {
+        gov_idle();
     }
+#endif
 
     _lv_mem_buf_free_all();
     _lv_font_clean_up_fmt_txt();
@@ -332,10 +407,261 @@ uint32_t lv_refr_get_fps_avg(void)
 }
 #endif
 
+#if LV_USE_REFR_GOV
+/**
+ * Set the target frame rate of a display.
+ * The display is refreshed with this rate while something is invalidated
+ * (or as fast as the frames can be drawn if it's not possible).
+ * @param disp pointer to a display
+ * @param fps target frames per second
+ */
+void lv_refr_gov_set_fps(lv_disp_t * disp, uint32_t fps)
+{
+    if(fps == 0) fps = 1;
+    disp->gov.fps = fps;
+    gov_set_period(disp, gov_active_period(disp), false);
+}
+
+/**
+ * Get the target frame rate of a display
+ * @param disp pointer to a display
+ * @return target frames per second
+ */
+uint32_t lv_refr_gov_get_fps(const lv_disp_t * disp)
+{
+    return disp->gov.fps;
+}
+
+/**
+ * Get the statistics of the refresh governor since the previous call and reset them
+ * @param disp pointer to a display
+ * @param stats the statistics are copied here
+ */
+void lv_refr_gov_get_stats(lv_disp_t * disp, lv_refr_gov_stats_t * stats)
+{
+    lv_refr_gov_t * gov = &disp->gov;
+
+    stats->time = lv_tick_elaps(gov->stat_start);
+    stats->frames = gov->stat_frames;
+    stats->fps = stats->time ? (gov->stat_frames * 1000) / stats->time : 0;
+    stats->fps_target = gov->fps;
+    stats->missed = gov->stat_missed;
+    stats->cost_avg = gov->stat_frames ? gov->stat_cost_sum / gov->stat_frames : 0;
+    stats->cost_max = gov->stat_cost_max;
+    stats->period = disp->refr_task->period;
+    stats->idle_time = lv_tick_elaps(gov->last_frame);
+
+    gov->stat_start = lv_tick_get();
+    gov->stat_frames = 0;
+    gov->stat_missed = 0;
+    gov->stat_cost_sum = 0;
+    gov->stat_cost_max = 0;
+}
+#endif
+
+#if LV_USE_REFR_PROF
+/**
+ * Delete the records of the refresh profiler
+ */
+void lv_refr_prof_clear(void)
+{
+    prof_cnt = 0;
+}
+
+/**
+ * Get the number of stored records of the refresh profiler
+ * @return number of records (max. `LV_REFR_PROF_BUF_SIZE`)
+ */
+uint32_t lv_refr_prof_get_cnt(void)
+{
+    return prof_cnt < LV_REFR_PROF_BUF_SIZE ? prof_cnt : LV_REFR_PROF_BUF_SIZE;
+}
+
+/**
+ * Get a record of the refresh profiler
+ * @param id index of the record, 0: the oldest
+ * @return pointer to the record or NULL if `id` is too large
+ */
+const lv_refr_prof_rec_t * lv_refr_prof_get(uint32_t id)
+{
+    uint32_t cnt = lv_refr_prof_get_cnt();
+    if(id >= cnt) return NULL;
+
+    return &prof_buf[(prof_cnt - cnt + id) % LV_REFR_PROF_BUF_SIZE];
+}
+
+/**
+ * Print the records of the refresh profiler from the oldest to the newest
+ * @param print_cb called with every line
+ * @param fmt `LV_REFR_PROF_FMT_CSV` or `LV_REFR_PROF_FMT_JSON`
+ */
+void lv_refr_prof_dump(lv_refr_prof_print_cb_t print_cb, lv_refr_prof_fmt_t fmt)
+{
+    static const char * type_names[] = {"obj", "render", "flush"};
+    char line[160];
+    uint32_t cnt = lv_refr_prof_get_cnt();
+    uint32_t i;
+
+    if(fmt == LV_REFR_PROF_FMT_JSON) print_cb("[");
+    else print_cb("frame,type,time_us,px,x1,y1,x2,y2,obj,scr,obj_type");
+
+    for(i = 0; i < cnt; i++) {
+        const lv_refr_prof_rec_t * rec = lv_refr_prof_get(i);
+        const char * obj_type = rec->obj_type ? rec->obj_type : "";
+        if(fmt == LV_REFR_PROF_FMT_JSON) {
+            lv_snprintf(line, sizeof(line),
+                        "{\"frame\":%u,\"type\":\"%s\",\"time_us\":%u,\"px\":%u,\"area\":[%d,%d,%d,%d],"
+                        "\"obj\":\"%p\",\"scr\":\"%p\",\"obj_type\":\"%s\"}%s",
+                        rec->frame, type_names[rec->type], rec->time, rec->px,
+                        rec->area.x1, rec->area.y1, rec->area.x2, rec->area.y2,
+                        rec->obj, rec->scr, obj_type, i + 1 < cnt ? "," : "");
+        }
+        else {
+            lv_snprintf(line, sizeof(line), "%u,%s,%u,%u,%d,%d,%d,%d,%p,%p,%s",
+                        rec->frame, type_names[rec->type], rec->time, rec->px,
+                        rec->area.x1, rec->area.y1, rec->area.x2, rec->area.y2,
+                        rec->obj, rec->scr, obj_type);
+        }
+        print_cb(line);
+    }
+
+    if(fmt == LV_REFR_PROF_FMT_JSON) print_cb("]");
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_REFR_TILE_TRACK
+/**
+ * Convert the invalidated tiles of `disp_refr` to areas in `inv_areas`.
+ * Horizontal runs of dirty tiles are stacked into rectangles row by row,
+ * then the rectangles are merged while merging is cheaper than flushing them separately.
+ * The tile bitmap is cleared.
+ */
+static void lv_refr_tiles_to_areas(void)
+{
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint16_t area_cnt = 0;
+    lv_coord_t hor_res = lv_disp_get_hor_res(disp_refr);
+    lv_coord_t ver_res = lv_disp_get_ver_res(disp_refr);
+    lv_coord_t row;
+    lv_coord_t col;
+    uint16_t i;
+    uint16_t j;
+
+    for(row = 0; row < LV_REFR_TILE_ROWS; row++) {
+        col = 0;
+        while(col < LV_REFR_TILE_COLS) {
+            /*Skip the clean words quickly*/
+            if((col & 0x1F) == 0 && disp_refr->inv_tiles[row][col >> 5] == 0) {
+                col += 32;
+                continue;
+            }
+            if((disp_refr->inv_tiles[row][col >> 5] & ((uint32_t)1 << (col & 0x1F))) == 0) {
+                col++;
+                continue;
+            }
+
+            /*Find the end of the run of dirty tiles*/
+            lv_coord_t col_start = col;
+            while(col < LV_REFR_TILE_COLS &&
+                  (disp_refr->inv_tiles[row][col >> 5] & ((uint32_t)1 << (col & 0x1F)))) {
+                col++;
+            }
+
+            lv_area_t run;
+            run.x1 = col_start * LV_REFR_TILE_SIZE;
+            run.x2 = LV_MATH_MIN(col * LV_REFR_TILE_SIZE, hor_res) - 1;
+            run.y1 = row * LV_REFR_TILE_SIZE;
+            run.y2 = LV_MATH_MIN((row + 1) * LV_REFR_TILE_SIZE, ver_res) - 1;
+            if(run.x1 > run.x2 || run.y1 > run.y2) continue;
+
+            /*Grow an area of the previous row if it has the same width*/
+            for(i = 0; i < area_cnt; i++) {
+                if(areas[i].x1 == run.x1 && areas[i].x2 == run.x2 && areas[i].y2 + 1 == run.y1) {
+                    areas[i].y2 = run.y2;
+                    break;
+                }
+            }
+            if(i < area_cnt) continue;
+
+            if(area_cnt < LV_INV_BUF_SIZE) {
+                lv_area_copy(&areas[area_cnt], &run);
+                area_cnt++;
+            }
+            else {
+                /*No free place: add the run to the area where it's the cheapest*/
+                uint16_t best = 0;
+                int32_t best_gain = INT32_MIN;
+                for(i = 0; i < area_cnt; i++) {
+                    int32_t gain;
+                    lv_refr_tile_merge_gain(&areas[i], &run, &gain);
+                    if(gain > best_gain) {
+                        best_gain = gain;
+                        best = i;
+                    }
+                }
+                _lv_area_join(&areas[best], &areas[best], &run);
+            }
+        }
+    }
+
+    /*Merge the areas while it reduces the cost. Contained areas are always merged.*/
+    bool merged = true;
+    while(merged) {
+        merged = false;
+        for(i = 0; i < area_cnt; i++) {
+            for(j = i + 1; j < area_cnt; j++) {
+                int32_t gain;
+                if(lv_refr_tile_merge_gain(&areas[i], &areas[j], &gain) == false) continue;
+
+                _lv_area_join(&areas[i], &areas[i], &areas[j]);
+                area_cnt--;
+                lv_area_copy(&areas[j], &areas[area_cnt]);
+                merged = true;
+                j = i;  /*`areas[i]` has grown, check all the others again*/
+            }
+        }
+    }
+
+    if(disp_refr->driver.rounder_cb) {
+        for(i = 0; i < area_cnt; i++) {
+            disp_refr->driver.rounder_cb(&disp_refr->driver, &areas[i]);
+        }
+    }
+
+    disp_refr->inv_p = area_cnt;
+    _lv_memset_00(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
+    _lv_memset_00(disp_refr->inv_tiles, sizeof(disp_refr->inv_tiles));
+}
+
+/**
+ * Calculate how many pixels are saved by merging two areas.
+ * Every separate area costs `LV_REFR_TILE_AREA_COST` pixels, merging adds the pixels of the
+ * bounding box which are in none of the areas.
+ * @param a1 pointer to an area
+ * @param a2 pointer to an other area
+ * @param gain store the saved pixels here (can be negative)
+ * @return true: the areas should be merged
+ */
+static bool lv_refr_tile_merge_gain(const lv_area_t * a1, const lv_area_t * a2, int32_t * gain)
+{
+    lv_area_t joined;
+    lv_area_t common;
+    _lv_area_join(&joined, a1, a2);
+
+    int32_t separate = lv_area_get_size(a1) + lv_area_get_size(a2);
+    if(_lv_area_intersect(&common, a1, a2)) separate -= lv_area_get_size(&common);
+
+    *gain = separate + LV_REFR_TILE_AREA_COST - (int32_t)lv_area_get_size(&joined);
+
+    if(_lv_area_is_in(a1, a2, 0) || _lv_area_is_in(a2, a1, 0)) return true;
+    return *gain >= 0;
+}
+#endif
+
 /**
  * Join the areas which has got common parts
  */
@@ -512,6 +838,10 @@ static void lv_refr_area_part(const lv_area_t * area_p)
         }
     }
 
+#if LV_USE_REFR_PROF
+    uint32_t prof_start = LV_REFR_PROF_TIME_EXPR;
+#endif
+
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -575,6 +905,11 @@ static void lv_refr_area_part(const lv_area_t * area_p)
     lv_refr_obj_and_children(lv_disp_get_layer_top(disp_refr), &start_mask);
     lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), &start_mask);
 
+#if LV_USE_REFR_PROF
+    if(disp_refr->driver.gpu_wait_cb) disp_refr->driver.gpu_wait_cb(&disp_refr->driver);
+    prof_add(LV_REFR_PROF_RENDER, &start_mask, LV_REFR_PROF_TIME_EXPR - prof_start);
+#endif
+
     /* In true double buffered mode flush only once when all areas were rendered.
      * In normal mode flush after every area */
     if(lv_disp_is_true_double_buf(disp_refr) == false) {
@@ -694,6 +1029,11 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 
     /*Draw the parent and its children only if they ore on 'mask_parent'*/
     if(union_ok != false) {
+#if LV_USE_REFR_PROF
+        uint32_t prof_start = LV_REFR_PROF_TIME_EXPR;
+        uint32_t prof_child_time_parent = prof_child_time;
+        prof_child_time = 0;
+#endif
 
         /* Redraw the object */
         if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
@@ -743,6 +1083,19 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 
         /* If all the children are redrawn make 'post draw' design */
         if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+
+#if LV_USE_REFR_PROF
+        lv_refr_prof_rec_t * rec = prof_add(LV_REFR_PROF_OBJ, &obj_ext_mask,
+                                            LV_REFR_PROF_TIME_EXPR - prof_start - prof_child_time);
+        lv_obj_type_t types;
+        lv_obj_get_type(obj, &types);
+        rec->obj = obj;
+        rec->scr = lv_obj_get_screen(obj);
+        rec->obj_type = types.type[0];
+
+        /*The parent's time is measured without the children, including the profiler's overhead*/
+        prof_child_time = prof_child_time_parent + (LV_REFR_PROF_TIME_EXPR - prof_start);
+#endif
     }
 }
 
@@ -752,6 +1105,9 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 static void lv_refr_vdb_flush(void)
 {
     lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
+#if LV_USE_REFR_PROF
+    uint32_t prof_start = LV_REFR_PROF_TIME_EXPR;
+#endif
 
     /*In double buffered mode wait until the other buffer is flushed before flushing the current
      * one*/
@@ -772,6 +1128,10 @@ static void lv_refr_vdb_flush(void)
 
     if(disp->driver.flush_cb) disp->driver.flush_cb(&disp->driver, &vdb->area, vdb->buf_act);
 
+#if LV_USE_REFR_PROF
+    prof_add(LV_REFR_PROF_FLUSH, &vdb->area, LV_REFR_PROF_TIME_EXPR - prof_start);
+#endif
+
     if(vdb->buf1 && vdb->buf2) {
         if(vdb->buf_act == vdb->buf1)
             vdb->buf_act = vdb->buf2;
@@ -779,3 +1139,113 @@ static void lv_refr_vdb_flush(void)
             vdb->buf_act = vdb->buf1;
     }
 }
+
+#if LV_USE_REFR_PROF
+/**
+ * Add a new record to the profiler's ring buffer. Overwrites the oldest if it's full.
+ * @param type type of the record
+ * @param area the measured area
+ * @param time the measured time in us
+ * @return pointer to the new record to set its other fields
+ */
+static lv_refr_prof_rec_t * prof_add(lv_refr_prof_type_t type, const lv_area_t * area, uint32_t time)
+{
+    lv_refr_prof_rec_t * rec = &prof_buf[prof_cnt % LV_REFR_PROF_BUF_SIZE];
+    prof_cnt++;
+    /*Don't let the counter overflow to keep the order of the records*/
+    if(prof_cnt == 2 * LV_REFR_PROF_BUF_SIZE) prof_cnt = LV_REFR_PROF_BUF_SIZE;
+
+    rec->frame = prof_frame;
+    rec->time = time;
+    rec->px = lv_area_get_size(area);
+    lv_area_copy(&rec->area, area);
+    rec->obj = NULL;
+    rec->scr = NULL;
+    rec->obj_type = NULL;
+    rec->type = type;
+
+    return rec;
+}
+#endif
+
+#if LV_USE_REFR_GOV
+/**
+ * Update the governor after a frame is refreshed
+ * @param cost render + flush time of the frame [ms]
+ */
+static void gov_frame(uint32_t cost)
+{
+    lv_refr_gov_t * gov = &disp_refr->gov;
+
+    /*Moving average with 1/8 weight of the new frame*/
+    gov->cost_avg = gov->cost_avg - (gov->cost_avg >> 3) + (cost << 1);
+    gov->last_frame = lv_tick_get();
+
+    gov->stat_frames++;
+    gov->stat_cost_sum += cost;
+    if(cost > gov->stat_cost_max) gov->stat_cost_max = cost;
+    if(cost > 1000 / gov->fps) gov->stat_missed++;
+
+    uint32_t period = gov_active_period(disp_refr);
+    if(gov->idle || period != disp_refr->refr_task->period) gov_set_period(disp_refr, period, false);
+}
+
+/**
+ * Update the governor when there was nothing to refresh.
+ * Double the periods if there was no frame and input for `LV_REFR_GOV_IDLE_TIME`.
+ */
+static void gov_idle(void)
+{
+    lv_refr_gov_t * gov = &disp_refr->gov;
+    uint32_t idle_time = LV_MATH_MIN(lv_tick_elaps(gov->last_frame), lv_disp_get_inactive_time(disp_refr));
+    uint32_t period = disp_refr->refr_task->period;
+
+    if(idle_time < LV_REFR_GOV_IDLE_TIME) {
+        /*Input without changes on the screen: be ready to draw its response*/
+        if(gov->idle) gov_set_period(disp_refr, gov_active_period(disp_refr), false);
+        return;
+    }
+
+    if(period < LV_REFR_GOV_IDLE_PERIOD) {
+        period = LV_MATH_MIN(period * 2, LV_REFR_GOV_IDLE_PERIOD);
+        gov_set_period(disp_refr, period, true);
+    }
+}
+
+/**
+ * Get the period to use while something is invalidated:
+ * the period of the target FPS, or the time of a frame if the frames are slower.
+ * @param disp pointer to a display
+ * @return period of the refresh task [ms]
+ */
+static uint32_t gov_active_period(lv_disp_t * disp)
+{
+    uint32_t period = 1000 / disp->gov.fps;
+    uint32_t cost = disp->gov.cost_avg >> 4;
+
+    /*No need to check the animations and the input more often than a frame can be drawn*/
+    if(cost > period) period = cost;
+    if(period == 0) period = 1;
+
+    return period;
+}
+
+/**
+ * Set the period of the tasks driving the refreshing of a display
+ * @param disp pointer to a display
+ * @param period new period of the refresh task [ms]
+ * @param idle true: the display is idle, `period` is the slowed down one
+ */
+static void gov_set_period(lv_disp_t * disp, uint32_t period, bool idle)
+{
+    disp->gov.idle = idle ? 1 : 0;
+    lv_task_set_period(disp->refr_task, period);
+
+#if LV_USE_ANIMATION
+    /*Step the animations once per frame*/
+    if(disp == lv_disp_get_default()) _lv_anim_set_task_period(period);
+#endif
+
+    /*The input devices are still read every `LV_INDEV_DEF_READ_PERIOD`, an input ends the idle state at once*/
+}
+#endif
@@ -26,6 +26,53 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_REFR_PROF
+enum {
+    LV_REFR_PROF_OBJ,       /**< An object is drawn*/
+    LV_REFR_PROF_RENDER,    /**< A part of an invalidated area is rendered into the buffer*/
+    LV_REFR_PROF_FLUSH,     /**< The buffer is passed to `flush_cb`*/
+};
+typedef uint8_t lv_refr_prof_type_t;
+
+enum {
+    LV_REFR_PROF_FMT_CSV,
+    LV_REFR_PROF_FMT_JSON,
+};
+typedef uint8_t lv_refr_prof_fmt_t;
+
+/** One measurement of the refresh profiler*/
+typedef struct {
+    uint32_t frame;         /**< Counts the refresh cycles*/
+    uint32_t time;          /**< [us] OBJ: drawing the object without its children,
+                                      RENDER: drawing everything on the area,
+                                      FLUSH: waiting for the buffer and calling `flush_cb`*/
+    uint32_t px;            /**< Size of `area` in pixels*/
+    lv_area_t area;         /**< OBJ: the drawn part of the object, RENDER and FLUSH: the buffer's area*/
+    const void * obj;       /**< OBJ: the object. Only to identify it, it might be deleted already*/
+    const void * scr;       /**< OBJ: screen of the object*/
+    const char * obj_type;  /**< OBJ: type of the object, e.g. "lv_btn"*/
+    lv_refr_prof_type_t type;
+} lv_refr_prof_rec_t;
+
+/** Called by `lv_refr_prof_dump()` with every line (without new line character)*/
+typedef void (*lv_refr_prof_print_cb_t)(const char * line);
+#endif
+
+#if LV_USE_REFR_GOV
+/** Statistics of the refresh governor, see `lv_refr_gov_get_stats()`*/
+typedef struct {
+    uint32_t time;          /**< Length of the measuring window [ms]*/
+    uint32_t frames;        /**< Refreshed frames*/
+    uint32_t fps;           /**< Refreshed frames per second*/
+    uint32_t fps_target;
+    uint32_t missed;        /**< Frames which took longer than `1000 / fps_target`*/
+    uint32_t cost_avg;      /**< Average render + flush time of a frame [ms]*/
+    uint32_t cost_max;      /**< Longest render + flush time of a frame [ms]*/
+    uint32_t period;        /**< Current period of the refresh task [ms]*/
+    uint32_t idle_time;     /**< Time since the last refreshed frame [ms]*/
+} lv_refr_gov_stats_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -86,6 +133,58 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+#if LV_USE_REFR_PROF
+/**
+ * Delete the records of the refresh profiler
+ */
+void lv_refr_prof_clear(void);
+
+/**
+ * Get the number of stored records of the refresh profiler
+ * @return number of records (max. `LV_REFR_PROF_BUF_SIZE`)
+ */
+uint32_t lv_refr_prof_get_cnt(void);
+
+/**
+ * Get a record of the refresh profiler
+ * @param id index of the record, 0: the oldest
+ * @return pointer to the record or NULL if `id` is too large
+ */
+const lv_refr_prof_rec_t * lv_refr_prof_get(uint32_t id);
+
+/**
+ * Print the records of the refresh profiler from the oldest to the newest
+ * @param print_cb called with every line
+ * @param fmt `LV_REFR_PROF_FMT_CSV` or `LV_REFR_PROF_FMT_JSON`
+ */
+void lv_refr_prof_dump(lv_refr_prof_print_cb_t print_cb, lv_refr_prof_fmt_t fmt);
+#endif
+
+#if LV_USE_REFR_GOV
+/**
+ * Set the target frame rate of a display.
+ * The display is refreshed with this rate while something is invalidated
+ * (or as fast as the frames can be drawn if it's not possible).
+ * @param disp pointer to a display
+ * @param fps target frames per second
+ */
+void lv_refr_gov_set_fps(lv_disp_t * disp, uint32_t fps);
+
+/**
+ * Get the target frame rate of a display
+ * @param disp pointer to a display
+ * @return target frames per second
+ */
+uint32_t lv_refr_gov_get_fps(const lv_disp_t * disp);
+
+/**
+ * Get the statistics of the refresh governor since the previous call and reset them
+ * @param disp pointer to a display
+ * @param stats the statistics are copied here
+ */
+void lv_refr_gov_get_stats(lv_disp_t * disp, lv_refr_gov_stats_t * stats);
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param task pointer to the task itself
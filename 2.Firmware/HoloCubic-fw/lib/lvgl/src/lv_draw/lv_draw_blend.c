@@ -388,6 +388,8 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                     disp->driver.gpu_blend_cb(&disp->driver, disp_buf_first, blend_buf, draw_area_w, opa);
                     disp_buf_first += disp_w;
                 }
+                /*`blend_buf` is reused by the next call so wait until the GPU has read it*/
+                if(disp->driver.gpu_wait_cb) disp->driver.gpu_wait_cb(&disp->driver);
                 return;
             }
 #endif
@@ -751,6 +753,8 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                 disp_buf_first += disp_w;
                 map_buf_first += map_w;
             }
+            /*The map can be overwritten after returning (e.g. next decoded lines) so wait for the GPU*/
+            if(disp->driver.gpu_wait_cb) disp->driver.gpu_wait_cb(&disp->driver);
             return;
         }
 #endif
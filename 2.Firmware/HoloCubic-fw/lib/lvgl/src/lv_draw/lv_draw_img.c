@@ -6,6 +6,7 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <string.h>
 #include "lv_draw_img.h"
 #include "lv_img_cache.h"
 #include "../lv_hal/lv_hal_disp.h"
@@ -39,6 +40,27 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                                               const lv_draw_img_dsc_t * draw_dsc,
                                               bool chroma_key, bool alpha_byte);
 
+#if LV_USE_IMG_TRANSFORM
+static lv_res_t lv_img_draw_transformed(const lv_area_t * coords, const lv_area_t * mask_com,
+                                        lv_img_cache_entry_t * cdsc, const lv_draw_img_dsc_t * draw_dsc);
+
+LV_ATTRIBUTE_FAST_MEM static void lv_draw_map_transformed(const lv_area_t * map_area, const lv_area_t * clip_area,
+                                                          lv_img_transform_dsc_t * trans_dsc,
+                                                          const lv_draw_img_dsc_t * draw_dsc);
+
+LV_ATTRIBUTE_FAST_MEM static void draw_transformed_buf(const lv_area_t * clip_area, const lv_area_t * area,
+                                                       lv_color_t * map, lv_opa_t * mask_buf,
+                                                       const lv_draw_img_dsc_t * draw_dsc);
+
+static uint32_t transform_buf_size(const lv_area_t * area);
+
+static void transform_dsc_init(lv_img_transform_dsc_t * trans_dsc, const lv_draw_img_dsc_t * draw_dsc,
+                               const void * src, lv_coord_t w, lv_coord_t h, lv_img_cf_t cf);
+
+static lv_res_t transform_strip_load(lv_img_decoder_dsc_t * dec_dsc, uint8_t * strip, uint32_t line_size,
+                                     lv_coord_t * strip_y1, lv_coord_t * strip_cnt, lv_coord_t y1, lv_coord_t cnt);
+#endif
+
 static void show_error(const lv_area_t * coords, const lv_area_t * clip_area, const char * msg);
 static void draw_cleanup(lv_img_cache_entry_t * cache);
 
@@ -193,6 +215,25 @@ bool lv_img_cf_has_alpha(lv_img_cf_t cf)
     return has_alpha;
 }
 
+/**
+ * Check if the pixels of an image are in the byte order LVGL renders in (`LV_COLOR_16_SWAP`).
+ * Only 16 bit true color images marked with `LV_IMG_BYTE_ORDER_...` can be checked.
+ * @param header pointer to the header of the image
+ * @return true: same byte order or not known; false: the image has to be converted again
+ */
+bool lv_img_header_byte_order_ok(const lv_img_header_t * header)
+{
+#if LV_COLOR_DEPTH == 16
+    if(header->reserved == LV_IMG_BYTE_ORDER_UNKNOWN) return true;
+    if(header->cf < LV_IMG_CF_TRUE_COLOR || header->cf > LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) return true;
+
+    return header->reserved == (LV_COLOR_16_SWAP ? LV_IMG_BYTE_ORDER_565_SWAP : LV_IMG_BYTE_ORDER_565);
+#else
+    (void)header;
+    return true;
+#endif
+}
+
 /**
  * Get the type of an image source
  * @param src pointer to an image source:
@@ -243,6 +284,26 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
     bool chroma_keyed = lv_img_cf_is_chroma_keyed(cdsc->dec_dsc.header.cf);
     bool alpha_byte   = lv_img_cf_has_alpha(cdsc->dec_dsc.header.cf);
 
+#if LV_USE_IMG_TRANSFORM
+    bool transform = draw_dsc->angle != 0 || draw_dsc->zoom != LV_IMG_ZOOM_NONE ? true : false;
+#else
+    bool transform = false;
+#endif
+
+    lv_area_t map_area_rot;
+    lv_area_copy(&map_area_rot, coords);
+    if(transform) {
+        int32_t w = lv_area_get_width(coords);
+        int32_t h = lv_area_get_height(coords);
+
+        _lv_img_buf_get_transformed_area(&map_area_rot, w, h, draw_dsc->angle, draw_dsc->zoom, &draw_dsc->pivot);
+
+        map_area_rot.x1 += coords->x1;
+        map_area_rot.y1 += coords->y1;
+        map_area_rot.x2 += coords->x1;
+        map_area_rot.y2 += coords->y1;
+    }
+
     if(cdsc->dec_dsc.error_msg != NULL) {
         LV_LOG_WARN("Image draw error");
 
@@ -251,20 +312,6 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
     /* The decoder could open the image and gave the entire uncompressed image.
      * Just draw it!*/
     else if(cdsc->dec_dsc.img_data) {
-        lv_area_t map_area_rot;
-        lv_area_copy(&map_area_rot, coords);
-        if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
-            int32_t w = lv_area_get_width(coords);
-            int32_t h = lv_area_get_height(coords);
-
-            _lv_img_buf_get_transformed_area(&map_area_rot, w, h, draw_dsc->angle, draw_dsc->zoom, &draw_dsc->pivot);
-
-            map_area_rot.x1 += coords->x1;
-            map_area_rot.y1 += coords->y1;
-            map_area_rot.x2 += coords->x1;
-            map_area_rot.y2 += coords->y1;
-        }
-
         lv_area_t mask_com; /*Common area of mask and coords*/
         bool union_ok;
         union_ok = _lv_area_intersect(&mask_com, clip_area, &map_area_rot);
@@ -276,6 +323,23 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
 
         lv_draw_map(coords, &mask_com, cdsc->dec_dsc.img_data, draw_dsc, chroma_keyed, alpha_byte);
     }
+#if LV_USE_IMG_TRANSFORM
+    /* The whole uncompressed image is not available but it needs to be transformed.
+     * Read it from the image source directly or line-by-line into a strip*/
+    else if(transform) {
+        lv_area_t mask_com; /*Common area of mask and the transformed coords*/
+        bool union_ok;
+        union_ok = _lv_area_intersect(&mask_com, clip_area, &map_area_rot);
+        if(union_ok == false) {
+            draw_cleanup(cdsc);
+            return LV_RES_OK;
+        }
+
+        lv_res_t res = lv_img_draw_transformed(coords, &mask_com, cdsc, draw_dsc);
+        draw_cleanup(cdsc);
+        return res;
+    }
+#endif
     /* The whole uncompressed image is not available. Try to read it line-by-line*/
     else {
         lv_area_t mask_com; /*Common area of mask and coords*/
@@ -411,6 +475,20 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
 #else
         bool transform = false;
 #endif
+
+#if LV_USE_IMG_TRANSFORM
+        if(transform) {
+            lv_img_cf_t cf = LV_IMG_CF_TRUE_COLOR;
+            if(alpha_byte) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+            else if(chroma_key) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+
+            lv_img_transform_dsc_t trans_dsc;
+            transform_dsc_init(&trans_dsc, draw_dsc, map_p, map_w, lv_area_get_height(map_area), cf);
+            lv_draw_map_transformed(map_area, clip_area, &trans_dsc, draw_dsc);
+            return;
+        }
+#endif
+
         /*Simple ARGB image. Handle it as special case because it's very common*/
         if(other_mask_cnt == 0 && !transform && !chroma_key && draw_dsc->recolor_opa == LV_OPA_TRANSP && alpha_byte) {
 #if LV_USE_GPU_STM32_DMA2D && LV_COLOR_DEPTH == 32
@@ -472,7 +550,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
             _lv_mem_buf_release(mask_buf);
             _lv_mem_buf_release(map2);
         }
-        /*Most complicated case: transform or other mask or chroma keyed*/
+        /*Most complicated case: other mask or chroma keyed*/
         else {
             /*Build the image and a mask line-by-line*/
             uint32_t hor_res = (uint32_t) lv_disp_get_hor_res(disp);
@@ -480,28 +558,6 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
             lv_color_t * map2 = _lv_mem_buf_get(mask_buf_size * sizeof(lv_color_t));
             lv_opa_t * mask_buf = _lv_mem_buf_get(mask_buf_size);
 
-#if LV_USE_IMG_TRANSFORM
-            lv_img_transform_dsc_t trans_dsc;
-            _lv_memset_00(&trans_dsc, sizeof(lv_img_transform_dsc_t));
-            if(transform) {
-                lv_img_cf_t cf = LV_IMG_CF_TRUE_COLOR;
-                if(alpha_byte) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
-                else if(chroma_key) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
-
-                trans_dsc.cfg.angle = draw_dsc->angle;
-                trans_dsc.cfg.zoom = draw_dsc->zoom;
-                trans_dsc.cfg.src = map_p;
-                trans_dsc.cfg.src_w = map_w;
-                trans_dsc.cfg.src_h = lv_area_get_height(map_area);;
-                trans_dsc.cfg.cf = cf;
-                trans_dsc.cfg.pivot_x = draw_dsc->pivot.x;
-                trans_dsc.cfg.pivot_y = draw_dsc->pivot.y;
-                trans_dsc.cfg.color = draw_dsc->recolor;
-                trans_dsc.cfg.antialias = draw_dsc->antialias;
-
-                _lv_img_buf_transform_init(&trans_dsc);
-            }
-#endif
             uint16_t recolor_premult[3] = {0};
             lv_opa_t recolor_opa_inv = 255 - draw_dsc->recolor_opa;
             if(draw_dsc->recolor_opa != 0) {
@@ -509,8 +565,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
             }
 
             lv_draw_mask_res_t mask_res;
-            mask_res = (alpha_byte || chroma_key || draw_dsc->angle ||
-                        draw_dsc->zoom != LV_IMG_ZOOM_NONE) ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+            mask_res = (alpha_byte || chroma_key) ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
 
 
             /*Prepare the `mask_buf`if there are other masks*/
@@ -520,70 +575,42 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
 
             int32_t x;
             int32_t y;
-#if LV_USE_IMG_TRANSFORM
-            int32_t rot_y = disp_area->y1 + draw_area.y1 - map_area->y1;
-#endif
             for(y = 0; y < draw_area_h; y++) {
                 map_px = map_buf_tmp;
                 uint32_t px_i_start = px_i;
 
-#if LV_USE_IMG_TRANSFORM
-                int32_t rot_x = disp_area->x1 + draw_area.x1 - map_area->x1;
-#endif
                 for(x = 0; x < draw_area_w; x++, map_px += px_size_byte, px_i++) {
-
-
-#if LV_USE_IMG_TRANSFORM
-                    if(transform) {
-
-                        /*Transform*/
-                        bool ret;
-                        ret = _lv_img_buf_transform(&trans_dsc, rot_x + x, rot_y + y);
-                        if(ret == false) {
-                            mask_buf[px_i] = LV_OPA_TRANSP;
-                            continue;
-                        }
-                        else {
-                            mask_buf[px_i] = trans_dsc.res.opa;
-                            c.full = trans_dsc.res.color.full;
-                        }
-                    }
-                    /*No transform*/
-                    else
-#endif
-                    {
-                        if(alpha_byte) {
-                            lv_opa_t px_opa = map_px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
-                            mask_buf[px_i] = px_opa;
-                            if(px_opa == 0) {
+                    if(alpha_byte) {
+                        lv_opa_t px_opa = map_px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+                        mask_buf[px_i] = px_opa;
+                        if(px_opa == 0) {
 #if  LV_COLOR_DEPTH == 32
-                                map2[px_i].full = 0;
+                            map2[px_i].full = 0;
 #endif
-                                continue;
-                            }
-                        }
-                        else {
-                            mask_buf[px_i] = 0xFF;
+                            continue;
                         }
+                    }
+                    else {
+                        mask_buf[px_i] = 0xFF;
+                    }
 
 #if LV_COLOR_DEPTH == 1
-                        c.full = map_px[0];
+                    c.full = map_px[0];
 #elif LV_COLOR_DEPTH == 8
-                        c.full =  map_px[0];
+                    c.full =  map_px[0];
 #elif LV_COLOR_DEPTH == 16
-                        c.full =  map_px[0] + (map_px[1] << 8);
+                    c.full =  map_px[0] + (map_px[1] << 8);
 #elif LV_COLOR_DEPTH == 32
-                        c.full =  *((uint32_t *)map_px);
-                        c.ch.alpha = 0xFF;
+                    c.full =  *((uint32_t *)map_px);
+                    c.ch.alpha = 0xFF;
 #endif
-                        if(chroma_key) {
-                            if(c.full == chroma_keyed_color.full) {
-                                mask_buf[px_i] = LV_OPA_TRANSP;
+                    if(chroma_key) {
+                        if(c.full == chroma_keyed_color.full) {
+                            mask_buf[px_i] = LV_OPA_TRANSP;
 #if  LV_COLOR_DEPTH == 32
-                                map2[px_i].full = 0;
+                            map2[px_i].full = 0;
 #endif
-                                continue;
-                            }
+                            continue;
                         }
                     }
 
@@ -620,8 +647,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                     blend_area.y2 = blend_area.y1;
 
                     px_i = 0;
-                    mask_res = (alpha_byte || chroma_key || draw_dsc->angle ||
-                                draw_dsc->zoom != LV_IMG_ZOOM_NONE) ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+                    mask_res = (alpha_byte || chroma_key) ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
 
                     /*Prepare the `mask_buf`if there are other masks*/
                     if(other_mask_cnt) {
@@ -642,6 +668,269 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
     }
 }
 
+#if LV_USE_IMG_TRANSFORM
+/**
+ * Draw a transformed image which is not available as a whole uncompressed image.
+ * Indexed and alpha only images in the memory are transformed directly.
+ * The others are read line-by-line into a strip of `LV_IMG_TRANSFORM_STREAM_ROWS` lines:
+ * the strip goes down on the image once for every `LV_IMG_TRANSFORM_STREAM_ROWS` lines drawn,
+ * and the pixels coming from the lines in the strip are transformed.
+ * @param coords the coordinates of the image (not transformed)
+ * @param mask_com the common area of the mask and the transformed image
+ * @param cdsc the opened image
+ * @param draw_dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ * @return LV_RES_OK: drawn; LV_RES_INV: a line couldn't be read
+ */
+static lv_res_t lv_img_draw_transformed(const lv_area_t * coords, const lv_area_t * mask_com,
+                                        lv_img_cache_entry_t * cdsc, const lv_draw_img_dsc_t * draw_dsc)
+{
+    lv_img_decoder_dsc_t * dec_dsc = &cdsc->dec_dsc;
+    lv_img_cf_t cf = dec_dsc->header.cf;
+    lv_coord_t w = dec_dsc->header.w;
+    lv_coord_t h = dec_dsc->header.h;
+    lv_img_transform_dsc_t trans_dsc;
+
+    if(dec_dsc->src_type == LV_IMG_SRC_VARIABLE && cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_ALPHA_8BIT) {
+        transform_dsc_init(&trans_dsc, draw_dsc, ((const lv_img_dsc_t *)dec_dsc->src)->data, w, h, cf);
+        lv_draw_map_transformed(coords, mask_com, &trans_dsc, draw_dsc);
+        return LV_RES_OK;
+    }
+
+    /*The lines are read as true color, with alpha byte if the image has alpha*/
+    bool alpha_byte = lv_img_cf_has_alpha(cf);
+    lv_img_cf_t line_cf = LV_IMG_CF_TRUE_COLOR;
+    if(alpha_byte) line_cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    else if(lv_img_cf_is_chroma_keyed(cf)) line_cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+    uint32_t line_size = w * (alpha_byte ? LV_IMG_PX_SIZE_ALPHA_BYTE : LV_COLOR_SIZE >> 3);
+
+    /*At least a line with its neighbors above and below*/
+    lv_coord_t rows = LV_MATH_MAX(LV_IMG_TRANSFORM_STREAM_ROWS, 3);
+    if(rows > h) rows = h;
+    uint8_t * strip = _lv_mem_buf_get(line_size * rows);
+    lv_coord_t strip_y1 = 0;
+    lv_coord_t strip_cnt = 0;
+
+    transform_dsc_init(&trans_dsc, draw_dsc, strip, w, h, line_cf);
+
+    /*The drawn pixels of `rows` lines, but not more than fit into a `hor_res` long buffer*/
+    lv_coord_t draw_w = lv_area_get_width(mask_com);
+    uint32_t mask_buf_size = transform_buf_size(mask_com);
+    lv_coord_t draw_h = LV_MATH_MIN((lv_coord_t)(mask_buf_size / draw_w), rows);
+    lv_color_t * map = _lv_mem_buf_get(mask_buf_size * sizeof(lv_color_t));
+    lv_opa_t * mask_buf = _lv_mem_buf_get(mask_buf_size);
+
+    lv_res_t res = LV_RES_OK;
+    lv_area_t draw_area;
+    draw_area.x1 = mask_com->x1;
+    draw_area.x2 = mask_com->x2;
+    for(draw_area.y1 = mask_com->y1; draw_area.y1 <= mask_com->y2 && res == LV_RES_OK; draw_area.y1 += draw_h) {
+        draw_area.y2 = LV_MATH_MIN(draw_area.y1 + draw_h - 1, mask_com->y2);
+        _lv_memset_00(mask_buf, draw_w * draw_h);
+
+        /*The source lines of the drawn lines*/
+        lv_area_t rel_area;
+        rel_area.x1 = draw_area.x1 - coords->x1;
+        rel_area.y1 = draw_area.y1 - coords->y1;
+        rel_area.x2 = draw_area.x2 - coords->x1;
+        rel_area.y2 = draw_area.y2 - coords->y1;
+        lv_area_t src_area;
+        _lv_img_buf_transform_get_src_area(&trans_dsc, &rel_area, &src_area);
+        lv_coord_t src_y1 = LV_MATH_MAX(src_area.y1, 0);
+        lv_coord_t src_y2 = LV_MATH_MIN(src_area.y2, h - 1);
+
+        /*Go down with the strip. The middle lines of the strip are drawn, one line above and below is for the neighbors*/
+        lv_coord_t part_h = LV_MATH_MAX(rows - 2, 1);
+        lv_coord_t part_y1;
+        for(part_y1 = src_y1; part_y1 <= src_y2; part_y1 += part_h) {
+            lv_coord_t part_y2 = LV_MATH_MIN(part_y1 + part_h - 1, src_y2);
+            if(part_y2 == src_y2) part_y2 = h - 1;  /*The pixels below the image belong to the last line*/
+
+            lv_coord_t load_y1 = LV_MATH_MIN(LV_MATH_MAX(part_y1 - 1, 0), h - rows);
+            if(load_y1 != strip_y1 || strip_cnt != rows) {
+                res = transform_strip_load(dec_dsc, strip, line_size, &strip_y1, &strip_cnt, load_y1, rows);
+                if(res != LV_RES_OK) break;
+                trans_dsc.tmp.src_y1 = strip_y1;
+                trans_dsc.tmp.src_rows = strip_cnt;
+            }
+
+            lv_coord_t y;
+            for(y = rel_area.y1; y <= rel_area.y2; y++) {
+                lv_coord_t x_part;
+                lv_coord_t len = _lv_img_buf_transform_get_part(&trans_dsc, rel_area.x1, y, draw_w,
+                                                                part_y1 == src_y1 ? 0 : part_y1, part_y2, &x_part);
+                if(len == 0) continue;
+
+                uint32_t px_i = (y - rel_area.y1) * draw_w + (x_part - rel_area.x1);
+                _lv_img_buf_transform_line(&trans_dsc, x_part, y, len, &map[px_i], &mask_buf[px_i]);
+            }
+        }
+
+        if(res == LV_RES_OK) draw_transformed_buf(mask_com, &draw_area, map, mask_buf, draw_dsc);
+    }
+
+    if(res != LV_RES_OK) {
+        lv_img_decoder_close(dec_dsc);
+        LV_LOG_WARN("Image draw can't read the line");
+    }
+
+    _lv_mem_buf_release(mask_buf);
+    _lv_mem_buf_release(map);
+    _lv_mem_buf_release(strip);
+    return res;
+}
+
+/**
+ * Draw a rotated and/or zoomed image which is in the memory as a whole
+ * @param map_area coordinates of the image (not transformed)
+ * @param clip_area the image will be drawn only on this area (truncated to VDB area)
+ * @param trans_dsc a transformation descriptor initialized with the source of the image
+ * @param draw_dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ */
+LV_ATTRIBUTE_FAST_MEM static void lv_draw_map_transformed(const lv_area_t * map_area, const lv_area_t * clip_area,
+                                                          lv_img_transform_dsc_t * trans_dsc,
+                                                          const lv_draw_img_dsc_t * draw_dsc)
+{
+    lv_coord_t draw_w = lv_area_get_width(clip_area);
+
+    /*Transform as many lines at once as fit into a `hor_res` long buffer*/
+    uint32_t mask_buf_size = transform_buf_size(clip_area);
+    lv_coord_t draw_h = mask_buf_size / draw_w;
+    lv_color_t * map2 = _lv_mem_buf_get(mask_buf_size * sizeof(lv_color_t));
+    lv_opa_t * mask_buf = _lv_mem_buf_get(mask_buf_size);
+
+    lv_area_t draw_area;
+    draw_area.x1 = clip_area->x1;
+    draw_area.x2 = clip_area->x2;
+    for(draw_area.y1 = clip_area->y1; draw_area.y1 <= clip_area->y2; draw_area.y1 += draw_h) {
+        draw_area.y2 = LV_MATH_MIN(draw_area.y1 + draw_h - 1, clip_area->y2);
+
+        lv_coord_t y;
+        for(y = draw_area.y1; y <= draw_area.y2; y++) {
+            uint32_t px_i = (y - draw_area.y1) * draw_w;
+            _lv_img_buf_transform_line(trans_dsc, draw_area.x1 - map_area->x1, y - map_area->y1, draw_w,
+                                       &map2[px_i], &mask_buf[px_i]);
+        }
+
+        draw_transformed_buf(clip_area, &draw_area, map2, mask_buf, draw_dsc);
+    }
+
+    _lv_mem_buf_release(mask_buf);
+    _lv_mem_buf_release(map2);
+}
+
+/**
+ * Recolor, mask and blend transformed pixels
+ * @param clip_area the pixels will be drawn only on this area
+ * @param area the area of the pixels
+ * @param map the colors of the pixels, recolored in place
+ * @param mask_buf the opacities of the pixels, masked in place
+ * @param draw_dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ */
+LV_ATTRIBUTE_FAST_MEM static void draw_transformed_buf(const lv_area_t * clip_area, const lv_area_t * area,
+                                                       lv_color_t * map, lv_opa_t * mask_buf,
+                                                       const lv_draw_img_dsc_t * draw_dsc)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    uint32_t px_cnt = lv_area_get_size(area);
+    uint32_t i;
+
+    if(draw_dsc->recolor_opa != 0) {
+        uint16_t recolor_premult[3];
+        lv_opa_t recolor_opa_inv = 255 - draw_dsc->recolor_opa;
+        lv_color_premult(draw_dsc->recolor, draw_dsc->recolor_opa, recolor_premult);
+        for(i = 0; i < px_cnt; i++) {
+            if(mask_buf[i] == LV_OPA_TRANSP) continue;
+            map[i] = lv_color_mix_premult(recolor_premult, map[i], recolor_opa_inv);
+        }
+    }
+
+    /*Apply the masks if any*/
+    if(lv_draw_mask_get_cnt()) {
+        lv_coord_t y;
+        for(y = area->y1; y <= area->y2; y++) {
+            lv_opa_t * mask_line = &mask_buf[(y - area->y1) * w];
+            lv_draw_mask_res_t mask_res_sub = lv_draw_mask_apply(mask_line, area->x1, y, w);
+            if(mask_res_sub == LV_DRAW_MASK_RES_TRANSP) {
+                _lv_memset_00(mask_line, w);
+            }
+        }
+    }
+
+    _lv_blend_map(clip_area, area, map, mask_buf, LV_DRAW_MASK_RES_CHANGED, draw_dsc->opa, draw_dsc->blend_mode);
+}
+
+/**
+ * Pixels in the buffers the transformed lines are collected in: `hor_res` like the other image paths,
+ * but at least a line. The same size every time lets `_lv_mem_buf_get` reuse the buffers,
+ * buffers of varying size are reallocated and fragment the built-in heap.
+ * @param area the area to draw
+ * @return the number of pixels, at least the width of `area`
+ */
+static uint32_t transform_buf_size(const lv_area_t * area)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    uint32_t hor_res = (uint32_t) lv_disp_get_hor_res(disp);
+    uint32_t draw_w = lv_area_get_width(area);
+    uint32_t size = lv_area_get_size(area) > hor_res ? hor_res : lv_area_get_size(area);
+    if(size < draw_w) size = draw_w;
+    return size;
+}
+
+static void transform_dsc_init(lv_img_transform_dsc_t * trans_dsc, const lv_draw_img_dsc_t * draw_dsc,
+                               const void * src, lv_coord_t w, lv_coord_t h, lv_img_cf_t cf)
+{
+    _lv_memset_00(trans_dsc, sizeof(lv_img_transform_dsc_t));
+    trans_dsc->cfg.angle = draw_dsc->angle;
+    trans_dsc->cfg.zoom = draw_dsc->zoom;
+    trans_dsc->cfg.src = src;
+    trans_dsc->cfg.src_w = w;
+    trans_dsc->cfg.src_h = h;
+    trans_dsc->cfg.cf = cf;
+    trans_dsc->cfg.pivot_x = draw_dsc->pivot.x;
+    trans_dsc->cfg.pivot_y = draw_dsc->pivot.y;
+    trans_dsc->cfg.color = draw_dsc->recolor;
+    trans_dsc->cfg.antialias = draw_dsc->antialias;
+
+    _lv_img_buf_transform_init(trans_dsc);
+}
+
+/**
+ * Make the strip hold `cnt` lines of the image from `y1`. The lines already in the strip are moved, not read again.
+ * @param dec_dsc the opened image
+ * @param strip buffer for the lines
+ * @param line_size size of a line in bytes
+ * @param strip_y1 the first line in the strip, updated
+ * @param strip_cnt number of lines in the strip, updated
+ * @param y1 the first line to have in the strip
+ * @param cnt number of lines to have in the strip
+ * @return LV_RES_OK: ready; LV_RES_INV: a line couldn't be read
+ */
+static lv_res_t transform_strip_load(lv_img_decoder_dsc_t * dec_dsc, uint8_t * strip, uint32_t line_size,
+                                     lv_coord_t * strip_y1, lv_coord_t * strip_cnt, lv_coord_t y1, lv_coord_t cnt)
+{
+    lv_coord_t keep_y1 = LV_MATH_MAX(*strip_y1, y1);
+    lv_coord_t keep_y2 = LV_MATH_MIN(*strip_y1 + *strip_cnt, y1 + cnt) - 1;
+    if(keep_y1 <= keep_y2) {
+        memmove(strip + (keep_y1 - y1) * line_size, strip + (keep_y1 - *strip_y1) * line_size,
+                (keep_y2 - keep_y1 + 1) * line_size);
+    }
+
+    /*Read the others from top to bottom*/
+    lv_coord_t row;
+    for(row = y1; row < y1 + cnt; row++) {
+        if(row >= keep_y1 && row <= keep_y2) continue;
+        if(lv_img_decoder_read_line(dec_dsc, 0, row, dec_dsc->header.w, strip + (row - y1) * line_size) != LV_RES_OK) {
+            *strip_cnt = 0;
+            return LV_RES_INV;
+        }
+    }
+
+    *strip_y1 = y1;
+    *strip_cnt = cnt;
+    return LV_RES_OK;
+}
+#endif
+
 static void show_error(const lv_area_t * coords, const lv_area_t * clip_area, const char * msg)
 {
     lv_draw_rect_dsc_t rect_dsc;
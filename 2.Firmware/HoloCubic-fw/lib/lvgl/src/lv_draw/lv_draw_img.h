@@ -88,6 +88,14 @@ bool lv_img_cf_is_chroma_keyed(lv_img_cf_t cf);
  */
 bool lv_img_cf_has_alpha(lv_img_cf_t cf);
 
+/**
+ * Check if the pixels of an image are in the byte order LVGL renders in (`LV_COLOR_16_SWAP`).
+ * Only 16 bit true color images marked with `LV_IMG_BYTE_ORDER_...` can be checked.
+ * @param header pointer to the header of the image
+ * @return true: same byte order or not known; false: the image has to be converted again
+ */
+bool lv_img_header_byte_order_ok(const lv_img_header_t * header);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
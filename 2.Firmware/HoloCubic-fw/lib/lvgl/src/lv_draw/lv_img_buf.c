@@ -17,6 +17,9 @@
 /*********************
  *      DEFINES
  *********************/
+/*Upscale of the source coordinates in `_lv_img_buf_transform_line`:
+ *`sinma` and `cosma` are upscaled by `_LV_TRANSFORM_TRIGO_SHIFT`, `zoom_inv` by 8 + `_LV_ZOOM_INV_UPSCALE`*/
+#define TRANSFORM_LINE_SHIFT (_LV_TRANSFORM_TRIGO_SHIFT + 8 + _LV_ZOOM_INV_UPSCALE)
 
 /**********************
  *      TYPEDEFS
@@ -25,6 +28,11 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_USE_IMG_TRANSFORM
+static void transform_start(const lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                            int64_t * xs, int64_t * ys, int64_t * xs_step, int64_t * ys_step);
+static int64_t floor_div(int64_t a, int64_t b);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -459,6 +467,9 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc)
      *  + dsc->cfg.zoom / 2 for rounding*/
     dsc->tmp.zoom_inv = (((256 * 256) << _LV_ZOOM_INV_UPSCALE) + dsc->cfg.zoom / 2) / dsc->cfg.zoom;
 
+    dsc->tmp.src_y1 = 0;
+    dsc->tmp.src_rows = dsc->cfg.src_h;
+
     dsc->res.opa = LV_OPA_COVER;
     dsc->res.color = dsc->cfg.color;
 }
@@ -679,8 +690,254 @@ bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc)
 
     return true;
 }
+
+/**
+ * Get the source area of an area: the bounding box of the source pixels, can be out of the image
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param area an area to transform
+ * @param res store the source area here
+ */
+void _lv_img_buf_transform_get_src_area(const lv_img_transform_dsc_t * dsc, const lv_area_t * area, lv_area_t * res)
+{
+    int64_t xs1;
+    int64_t ys1;
+    int64_t xs2;
+    int64_t ys2;
+    int64_t xs_step;
+    int64_t ys_step;
+    transform_start(dsc, area->x1, area->y1, &xs1, &ys1, &xs_step, &ys_step);
+    transform_start(dsc, area->x1, area->y2, &xs2, &ys2, &xs_step, &ys_step);
+
+    /*The corners of the area*/
+    int64_t steps = (lv_area_get_width(area) - 1) * xs_step;
+    int64_t xs[4] = {xs1, xs2, xs1 + steps, xs2 + steps};
+    steps = (lv_area_get_width(area) - 1) * ys_step;
+    int64_t ys[4] = {ys1, ys2, ys1 + steps, ys2 + steps};
+
+    int64_t xs_min = LV_MATH_MIN(LV_MATH_MIN(xs[0], xs[1]), LV_MATH_MIN(xs[2], xs[3]));
+    int64_t xs_max = LV_MATH_MAX(LV_MATH_MAX(xs[0], xs[1]), LV_MATH_MAX(xs[2], xs[3]));
+    int64_t ys_min = LV_MATH_MIN(LV_MATH_MIN(ys[0], ys[1]), LV_MATH_MIN(ys[2], ys[3]));
+    int64_t ys_max = LV_MATH_MAX(LV_MATH_MAX(ys[0], ys[1]), LV_MATH_MAX(ys[2], ys[3]));
+    res->x1 = (lv_coord_t)(xs_min >> TRANSFORM_LINE_SHIFT);
+    res->x2 = (lv_coord_t)(xs_max >> TRANSFORM_LINE_SHIFT);
+    res->y1 = (lv_coord_t)(ys_min >> TRANSFORM_LINE_SHIFT);
+    res->y2 = (lv_coord_t)(ys_max >> TRANSFORM_LINE_SHIFT);
+}
+
+/**
+ * Get the part of a line of pixels which is transformed from the source lines `src_y1..src_y2`.
+ * Pixels above or below the image belong to its first or last line, like in `_lv_img_buf_transform_line`
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param x the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels in the line
+ * @param src_y1 the first source line
+ * @param src_y2 the last source line
+ * @param x_part store the first pixel of the part here
+ * @return number of pixels in the part (0 if none)
+ */
+lv_coord_t _lv_img_buf_transform_get_part(const lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                          lv_coord_t len, lv_coord_t src_y1, lv_coord_t src_y2, lv_coord_t * x_part)
+{
+    int64_t xs;
+    int64_t ys;
+    int64_t xs_step;
+    int64_t ys_step;
+    transform_start(dsc, x, y, &xs, &ys, &xs_step, &ys_step);
+
+    /*The pixels `k` with `lo <= ys + k * ys_step < hi`*/
+    int64_t lo = src_y1 > 0 ? (int64_t)src_y1 << TRANSFORM_LINE_SHIFT : INT64_MIN / 2;
+    int64_t hi = src_y2 < dsc->cfg.src_h - 1 ? (int64_t)(src_y2 + 1) << TRANSFORM_LINE_SHIFT : INT64_MAX / 2;
+    int64_t k1 = 0;
+    int64_t k2 = len - 1;
+    if(ys_step > 0) {
+        k1 = LV_MATH_MAX(k1, -floor_div(ys - lo, ys_step));
+        k2 = LV_MATH_MIN(k2, -floor_div(ys - hi, ys_step) - 1);
+    }
+    else if(ys_step < 0) {
+        k1 = LV_MATH_MAX(k1, floor_div(ys - hi, -ys_step) + 1);
+        k2 = LV_MATH_MIN(k2, floor_div(ys - lo, -ys_step));
+    }
+    else if(ys < lo || ys >= hi) {
+        return 0;
+    }
+
+    if(k1 > k2) return 0;
+    *x_part = x + (lv_coord_t)k1;
+    return (lv_coord_t)(k2 - k1 + 1);
+}
+
+/**
+ * Transform a horizontal line of pixels at once. The source coordinates are stepped incrementally.
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param x the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels
+ * @param cbuf store the colors here (`len` elements)
+ * @param abuf store the opacities here (`len` elements), `LV_OPA_TRANSP` where the pixel is out of the image
+ */
+LV_ATTRIBUTE_FAST_MEM void _lv_img_buf_transform_line(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                                      lv_coord_t len, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    int64_t xs;
+    int64_t ys;
+    int64_t xs_step;
+    int64_t ys_step;
+    transform_start(dsc, x, y, &xs, &ys, &xs_step, &ys_step);
+
+    const uint8_t * src_u8 = (const uint8_t *)dsc->cfg.src;
+    lv_coord_t src_w = dsc->cfg.src_w;
+    lv_coord_t src_h = dsc->cfg.src_h;
+    lv_coord_t src_y1 = dsc->tmp.src_y1;
+    lv_coord_t src_y2 = dsc->tmp.src_y1 + dsc->tmp.src_rows - 1;
+    uint8_t px_size = dsc->tmp.has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : LV_COLOR_SIZE >> 3;
+    bool antialias = dsc->cfg.antialias;
+    lv_color_t chroma_keyed_color = LV_COLOR_TRANSP;
+
+    /*The palette of indexed images is at the beginning of the data*/
+    const lv_color32_t * palette = NULL;
+    if(dsc->cfg.cf >= LV_IMG_CF_INDEXED_1BIT && dsc->cfg.cf <= LV_IMG_CF_INDEXED_8BIT) {
+        palette = (const lv_color32_t *)dsc->cfg.src;
+    }
+
+    /*Pixels less than half pixel out of the image are drawn too, faded by how much they cover the image*/
+#if LV_IMG_TRANSFORM_AA_EDGE
+    int32_t edge = antialias ? 128 : 0;
+#else
+    int32_t edge = 0;
+#endif
+    /*Limits of the image in 1/256 pixels*/
+    int32_t xs_max = src_w * 256 + edge;
+    int32_t ys_max = src_h * 256 + edge;
+
+    lv_coord_t i;
+    for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+        int32_t xs_256 = (int32_t)(xs >> (TRANSFORM_LINE_SHIFT - 8));
+        int32_t ys_256 = (int32_t)(ys >> (TRANSFORM_LINE_SHIFT - 8));
+        if(xs_256 < -edge || xs_256 >= xs_max || ys_256 < -edge || ys_256 >= ys_max) {
+            abuf[i] = LV_OPA_TRANSP;
+            continue;
+        }
+
+        /*The faded pixels next to the image take the color of the edge*/
+        int32_t xs_int = xs_256 >> 8;
+        int32_t ys_int = ys_256 >> 8;
+        if(xs_int < 0) xs_int = 0;
+        else if(xs_int >= src_w) xs_int = src_w - 1;
+        if(ys_int < 0) ys_int = 0;
+        else if(ys_int >= src_h) ys_int = src_h - 1;
+
+        lv_color_t c;
+        lv_opa_t opa;
+        uint32_t pxi = 0;
+        if(dsc->tmp.native_color) {
+            /*Only `src_rows` lines are in the memory*/
+            if(ys_int < src_y1 || ys_int > src_y2) {
+                abuf[i] = LV_OPA_TRANSP;
+                continue;
+            }
+
+            pxi = ((ys_int - src_y1) * src_w + xs_int) * px_size;
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+            c.full = src_u8[pxi];
+#elif LV_COLOR_DEPTH == 16
+            c.full = src_u8[pxi] + (src_u8[pxi + 1] << 8);
+#elif LV_COLOR_DEPTH == 32
+            _lv_memcpy_small(&c, &src_u8[pxi], sizeof(lv_color_t));
+            c.ch.alpha = 0xFF;
+#endif
+            opa = dsc->tmp.has_alpha ? src_u8[pxi + px_size - 1] : LV_OPA_COVER;
+        }
+        else if(palette) {
+            lv_color32_t c32 = palette[lv_img_buf_get_px_color(&dsc->tmp.img_dsc, xs_int, ys_int, dsc->cfg.color).full];
+            c = lv_color_make(c32.ch.red, c32.ch.green, c32.ch.blue);
+            opa = c32.ch.alpha;
+        }
+        else {
+            c = lv_img_buf_get_px_color(&dsc->tmp.img_dsc, xs_int, ys_int, dsc->cfg.color);
+            opa = lv_img_buf_get_px_alpha(&dsc->tmp.img_dsc, xs_int, ys_int);
+        }
+
+        if(dsc->tmp.chroma_keyed && c.full == chroma_keyed_color.full) {
+            abuf[i] = LV_OPA_TRANSP;
+            continue;
+        }
+
+        if(antialias) {
+#if LV_IMG_TRANSFORM_AA_EDGE
+            /*Inside the image take the nearest pixel, around the edges the covered part of it*/
+            if(xs_256 < 128 || xs_256 > xs_max - 256 || ys_256 < 128 || ys_256 > ys_max - 256) {
+                int32_t cover_x = LV_MATH_MIN(LV_MATH_MIN(xs_256 + 128, xs_max - xs_256), 256);
+                int32_t cover_y = LV_MATH_MIN(LV_MATH_MIN(ys_256 + 128, ys_max - ys_256), 256);
+                opa = (opa * ((cover_x * cover_y) >> 8)) >> 8;
+            }
+#else
+            /*Mix with the neighbors, but not with lines out of the strip in the memory.
+             *The neighbors of indexed pixels would be read as palette indices, use the nearest pixel for them*/
+            bool strip_edge = (ys_int == src_y1 && ys_int > 0) || (ys_int == src_y2 && ys_int < src_h - 1);
+            if(palette == NULL && !(dsc->tmp.native_color && strip_edge)) {
+                dsc->tmp.xs = xs_256;
+                dsc->tmp.ys = ys_256;
+                dsc->tmp.xs_int = xs_int;
+                dsc->tmp.ys_int = ys_int;
+                dsc->tmp.pxi = pxi;
+                dsc->tmp.px_size = px_size;
+                dsc->res.color = c;
+                dsc->res.opa = opa;
+                if(_lv_img_buf_transform_anti_alias(dsc) == false) {
+                    abuf[i] = LV_OPA_TRANSP;
+                    continue;
+                }
+                c = dsc->res.color;
+                opa = dsc->res.opa;
+            }
+#endif
+        }
+
+        cbuf[i] = c;
+        abuf[i] = opa;
+    }
+}
 #endif
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_USE_IMG_TRANSFORM
+/**
+ * Get the source coordinates of a pixel and their change to the right, upscaled by `TRANSFORM_LINE_SHIFT`.
+ * The values are exact, so stepping from any pixel gives the same coordinates.
+ */
+static void transform_start(const lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                            int64_t * xs, int64_t * ys, int64_t * xs_step, int64_t * ys_step)
+{
+    int64_t sinma = dsc->tmp.sinma;
+    int64_t cosma = dsc->tmp.cosma;
+    /*Without rotation use exactly 1 and 0 like `_lv_img_buf_transform`*/
+    if(dsc->cfg.angle == 0) {
+        sinma = 0;
+        cosma = 1 << _LV_TRANSFORM_TRIGO_SHIFT;
+    }
+
+    int64_t zoom_inv = dsc->tmp.zoom_inv;
+    int64_t xt = x - dsc->cfg.pivot_x;
+    int64_t yt = y - dsc->cfg.pivot_y;
+
+    *xs = (cosma * xt - sinma * yt) * zoom_inv + ((int64_t)dsc->cfg.pivot_x << TRANSFORM_LINE_SHIFT);
+    *ys = (sinma * xt + cosma * yt) * zoom_inv + ((int64_t)dsc->cfg.pivot_y << TRANSFORM_LINE_SHIFT);
+    *xs_step = cosma * zoom_inv;
+    *ys_step = sinma * zoom_inv;
+}
+
+/**
+ * Divide and round towards minus infinity
+ */
+static int64_t floor_div(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    if((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+#endif
+
+
@@ -30,6 +30,12 @@ extern "C" {
 #define LV_IMG_PX_SIZE_ALPHA_BYTE 4
 #endif
 
+/*Byte order of RGB565 pixels in `lv_img_header_t.reserved`, written by HoloCubic's ImageToHolo.
+ *0 (other converters): not known, see `lv_img_header_byte_order_ok()`*/
+#define LV_IMG_BYTE_ORDER_UNKNOWN  0
+#define LV_IMG_BYTE_ORDER_565      1    /*Like LV_COLOR_16_SWAP 0*/
+#define LV_IMG_BYTE_ORDER_565_SWAP 2    /*Like LV_COLOR_16_SWAP 1*/
+
 #define LV_IMG_BUF_SIZE_TRUE_COLOR(w, h) ((LV_COLOR_SIZE / 8) * w * h)
 #define LV_IMG_BUF_SIZE_TRUE_COLOR_CHROMA_KEYED(w, h) ((LV_COLOR_SIZE / 8) * w * h)
 #define LV_IMG_BUF_SIZE_TRUE_COLOR_ALPHA(w, h) (LV_IMG_PX_SIZE_ALPHA_BYTE * w * h)
@@ -115,7 +121,7 @@ typedef struct {
 
     uint32_t h : 11; /*Height of     the image map*/
     uint32_t w : 11; /*Width of the image map*/
-    uint32_t reserved : 2; /*Reserved to be used later*/
+    uint32_t reserved : 2; /*Reserved to be used later, `LV_IMG_BYTE_ORDER_...` in HoloCubic's files*/
     uint32_t always_zero : 3; /*It the upper bits of the first byte. Always zero to look like a
                                  non-printable character*/
     uint32_t cf : 5;          /* Color format: See `lv_img_color_format_t`*/
@@ -129,7 +135,7 @@ typedef struct {
     uint32_t always_zero : 3; /*It the upper bits of the first byte. Always zero to look like a
                                  non-printable character*/
 
-    uint32_t reserved : 2; /*Reserved to be used later*/
+    uint32_t reserved : 2; /*Reserved to be used later, `LV_IMG_BYTE_ORDER_...` in HoloCubic's files*/
 
     uint32_t w : 11; /*Width of the image map*/
     uint32_t h : 11; /*Height of     the image map*/
@@ -177,6 +183,11 @@ typedef struct {
 
         uint32_t zoom_inv;
 
+        /*Rows of the image in `cfg.src` (true color only): `src_y1` is the first one.
+         *The whole image by default, set them after `_lv_img_buf_transform_init` to use a strip*/
+        lv_coord_t src_y1;
+        lv_coord_t src_rows;
+
         /*Runtime data*/
         lv_coord_t xs;
         lv_coord_t ys;
@@ -283,6 +294,45 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc);
  */
 bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc);
 
+/**
+ * Get the source area of an area: the bounding box of the source pixels, can be out of the image
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param area an area to transform
+ * @param res store the source area here
+ */
+void _lv_img_buf_transform_get_src_area(const lv_img_transform_dsc_t * dsc, const lv_area_t * area, lv_area_t * res);
+
+/**
+ * Get the part of a line of pixels which is transformed from the source lines `src_y1..src_y2`.
+ * Pixels above or below the image belong to its first or last line, like in `_lv_img_buf_transform_line`
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param x the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels in the line
+ * @param src_y1 the first source line
+ * @param src_y2 the last source line
+ * @param x_part store the first pixel of the part here
+ * @return number of pixels in the part (0 if none)
+ */
+lv_coord_t _lv_img_buf_transform_get_part(const lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                          lv_coord_t len, lv_coord_t src_y1, lv_coord_t src_y2, lv_coord_t * x_part);
+
+/**
+ * Transform a horizontal line of pixels at once. Like `_lv_img_buf_transform` for every pixel,
+ * but the source coordinates are stepped with constant fixed-point deltas instead of being recalculated.
+ * With `tmp.src_y1/src_rows` only a strip of a true color image needs to be in `cfg.src`,
+ * the pixels from other lines are `LV_OPA_TRANSP`.
+ * With `antialias` and `LV_IMG_TRANSFORM_AA_EDGE` only the edges of the image are smoothed.
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param x the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels
+ * @param cbuf store the colors here (`len` elements)
+ * @param abuf store the opacities here (`len` elements), `LV_OPA_TRANSP` where the pixel is out of the image
+ */
+void _lv_img_buf_transform_line(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                lv_color_t * cbuf, lv_opa_t * abuf);
+
 
 /**
  * Get which color and opa would come to a pixel if it were rotated
@@ -19,9 +19,6 @@
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
-
 /*Boost life by this factor (multiply time_to_open with this value)*/
 #define LV_IMG_CACHE_LIFE_GAIN 1
 
@@ -29,6 +26,9 @@
  * "die" from very high values */
 #define LV_IMG_CACHE_LIFE_LIMIT 1000
 
+/*End of a hash bucket's chain*/
+#define ENTRY_NONE 0xFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -38,6 +38,13 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE == 0
     static lv_img_cache_entry_t cache_temp;
+#else
+    static uint32_t src_hash(const void * src, lv_img_src_t src_type);
+    static bool entry_match(const lv_img_cache_entry_t * entry, const void * src, lv_img_src_t src_type, uint32_t hash);
+    static void entry_life_update(lv_img_cache_entry_t * entry);
+    static void entry_remove(lv_img_cache_entry_t * entry);
+    static bool evict(const lv_img_cache_entry_t * keep);
+    static void fit_budget(const lv_img_cache_entry_t * keep);
 #endif
 
 /**********************
@@ -45,6 +52,14 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint16_t * buckets;      /*First entry of every hash bucket, allocated after the entries*/
+    static uint16_t bucket_mask;    /*Number of buckets - 1, the number is a power of 2*/
+    static uint32_t budget = LV_IMG_CACHE_DEF_BUDGET;
+    static uint32_t cache_size;     /*Bytes of the cached images*/
+    static uint16_t cache_used;     /*Number of cached images*/
+    static int32_t life_base;       /*Life of the last evicted entry*/
+    static uint32_t open_cnt;       /*Incremented on every open*/
+    static lv_img_cache_stats_t cache_stats;
 #endif
 
 /**********************
@@ -76,55 +91,37 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
 
     lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    /*Decrement all lifes. Make the entries older*/
+    /*Look for the image only in its hash bucket*/
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    uint32_t hash = src_hash(src, src_type);
+    open_cnt++;
     uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        bool match = false;
-        lv_img_src_t src_type = lv_img_src_get_type(cache[i].dec_dsc.src);
-        if(src_type == LV_IMG_SRC_VARIABLE) {
-            if(cache[i].dec_dsc.src == src && cache[i].dec_dsc.color.full == color.full) match = true;
-        }
-        else if(src_type == LV_IMG_SRC_FILE) {
-            if(strcmp(cache[i].dec_dsc.src, src) == 0) match = true;
-        }
-
-        if(match) {
-            /* If opened increment its life.
-             * Image difficult to open should live longer to keep avoid frequent their recaching.
-             * Therefore increase `life` with `time_to_open`*/
+    for(i = buckets[hash & bucket_mask]; i != ENTRY_NONE; i = cache[i].next) {
+        if(entry_match(&cache[i], src, src_type, hash) &&
+           (src_type != LV_IMG_SRC_VARIABLE || cache[i].dec_dsc.color.full == color.full)) {
+            /* Image difficult to open should live longer to keep avoid frequent their recaching.
+             * Therefore set `life` with `time_to_open`*/
             cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
+            entry_life_update(cached_src);
+            cached_src->hits++;
+            cache_stats.hits++;
             LV_LOG_TRACE("image draw: image found in the cache");
-            break;
-        }
-    }
-
-    /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
-
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
+            return cached_src;
         }
     }
 
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
+    /*The image is not cached then cache it now. Use a free entry or evict the entry with the least life.
+     *If the budget is used up make room before the open, the decoder might need what the cached images hold*/
+    if(budget) {
+        while(cache_size >= budget && evict(NULL));
     }
-    else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+    if(cache_used == entry_cnt) evict(NULL);
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL) break;
     }
+    cached_src = &cache[i];
+    LV_LOG_INFO("image draw: cache miss");
+    cache_stats.misses++;
 
 #else
     cached_src = &cache_temp;
@@ -139,12 +136,9 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
         lv_img_decoder_close(&cached_src->dec_dsc);
         _lv_memset_00(&cached_src->dec_dsc, sizeof(lv_img_decoder_dsc_t));
         _lv_memset_00(cached_src, sizeof(lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its use  */
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -152,6 +146,27 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+    cache_stats.open_time += cached_src->dec_dsc.time_to_open;
+
+    /*If the decoder didn't tell its memory usage count the decoded image loaded from a file*/
+    cached_src->size = cached_src->dec_dsc.mem_size;
+    if(cached_src->size == 0 && cached_src->dec_dsc.img_data && cached_src->dec_dsc.src_type == LV_IMG_SRC_FILE) {
+        lv_img_header_t * header = &cached_src->dec_dsc.header;
+        cached_src->size = lv_img_buf_get_img_size(header->w, header->h, header->cf);
+    }
+
+    cached_src->hash = hash;
+    cached_src->hits = 0;
+    cached_src->next = buckets[hash & bucket_mask];
+    buckets[hash & bucket_mask] = cached_src - cache;
+    entry_life_update(cached_src);
+    cache_size += cached_src->size;
+    cache_used++;
+
+    if(budget) fit_budget(cached_src);
+#endif
+
     return cached_src;
 }
 
@@ -173,14 +188,21 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(lv_img_cache_entry_t) * new_entry_cnt);
+    /*At least as many buckets as entries to keep the chains short*/
+    uint32_t bucket_cnt = 1;
+    while(bucket_cnt < new_entry_cnt) bucket_cnt <<= 1;
+
+    /*Reallocate the cache, the buckets are after the entries*/
+    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(lv_img_cache_entry_t) * new_entry_cnt +
+                                                   sizeof(uint16_t) * bucket_cnt);
     LV_ASSERT_MEM(LV_GC_ROOT(_lv_img_cache_array));
-    if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
+    if(LV_GC_ROOT(_lv_img_cache_array) == NULL || new_entry_cnt >= ENTRY_NONE) {
         entry_cnt = 0;
         return;
     }
     entry_cnt = new_entry_cnt;
+    buckets = (uint16_t *)&LV_GC_ROOT(_lv_img_cache_array)[entry_cnt];
+    bucket_mask = bucket_cnt - 1;
 
     /*Clean the cache*/
     uint16_t i;
@@ -188,13 +210,63 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         _lv_memset_00(&LV_GC_ROOT(_lv_img_cache_array)[i].dec_dsc, sizeof(lv_img_decoder_dsc_t));
         _lv_memset_00(&LV_GC_ROOT(_lv_img_cache_array)[i], sizeof(lv_img_cache_entry_t));
     }
+    for(i = 0; i < bucket_cnt; i++) buckets[i] = ENTRY_NONE;
+    cache_size = 0;
+    cache_used = 0;
+    life_base = 0;
+#endif
+}
+
+/**
+ * Set the bytes the cached images can keep allocated (see `lv_img_decoder_dsc_t::mem_size`).
+ * The least valuable images are closed until the cache fits into the budget,
+ * but one image (the last opened) is always kept even if it's greater than the budget.
+ * @param bytes the byte budget, 0: limit only the number of images
+ */
+void lv_img_cache_set_budget(uint32_t bytes)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(bytes);
+    LV_LOG_WARN("Can't change cache budget because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
+#else
+    budget = bytes;
+    if(budget && entry_cnt) fit_budget(NULL);
+#endif
+}
+
+/**
+ * Get the bytes the cached images can keep allocated
+ * @return the byte budget, 0: not limited or no cache
+ */
+uint32_t lv_img_cache_get_budget(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    return 0;
+#else
+    return budget;
+#endif
+}
+
+/**
+ * Get the statistics of the cache. The counters are reset.
+ * @param stats the counters accumulated since the previous call and the current size are stored here
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    _lv_memset_00(stats, sizeof(lv_img_cache_stats_t));
+#else
+    cache_stats.size = cache_size;
+    cache_stats.entry_cnt = cache_used;
+    *stats = cache_stats;
+    _lv_memset_00(&cache_stats, sizeof(cache_stats));
 #endif
 }
 
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
- * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable. NULL to invalidate all.
  */
 void lv_img_cache_invalidate_src(const void * src)
 {
@@ -202,15 +274,21 @@ void lv_img_cache_invalidate_src(const void * src)
     lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
     uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].dec_dsc.src == src || src == NULL) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
-
-            _lv_memset_00(&cache[i].dec_dsc, sizeof(lv_img_decoder_dsc_t));
-            _lv_memset_00(&cache[i], sizeof(lv_img_cache_entry_t));
+    if(src == NULL) {
+        for(i = 0; i < entry_cnt; i++) {
+            if(cache[i].dec_dsc.src != NULL) entry_remove(&cache[i]);
         }
+        return;
+    }
+
+    /*Every color of the image*/
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    uint32_t hash = src_hash(src, src_type);
+    i = buckets[hash & bucket_mask];
+    while(i != ENTRY_NONE) {
+        uint16_t next = cache[i].next;
+        if(entry_match(&cache[i], src, src_type, hash)) entry_remove(&cache[i]);
+        i = next;
     }
 #endif
 }
@@ -218,3 +296,119 @@ void lv_img_cache_invalidate_src(const void * src)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_IMG_CACHE_DEF_SIZE
+/**
+ * Hash an image source: the path of files, the pointer of variables and symbols
+ * @param src the image source
+ * @param src_type type of `src`
+ * @return the hash
+ */
+static uint32_t src_hash(const void * src, lv_img_src_t src_type)
+{
+    if(src_type == LV_IMG_SRC_FILE) {
+        /*FNV-1a*/
+        const uint8_t * c = src;
+        uint32_t hash = 2166136261u;
+        while(*c) {
+            hash ^= *c;
+            hash *= 16777619u;
+            c++;
+        }
+        return hash;
+    }
+
+    /*The low bits of aligned pointers are always 0*/
+    uintptr_t p = (uintptr_t)src;
+    return (uint32_t)((p >> 2) ^ (p >> 12));
+}
+
+/**
+ * Tell whether a cache entry holds an image source (with any color)
+ * @param entry the cache entry
+ * @param src the image source
+ * @param src_type type of `src`
+ * @param hash hash of `src`
+ * @return true: the entry holds `src`
+ */
+static bool entry_match(const lv_img_cache_entry_t * entry, const void * src, lv_img_src_t src_type, uint32_t hash)
+{
+    if(entry->hash != hash || entry->dec_dsc.src_type != src_type) return false;
+
+    /*The decoder keeps a copy of the paths*/
+    if(src_type == LV_IMG_SRC_FILE) return strcmp(entry->dec_dsc.src, src) == 0;
+    else return entry->dec_dsc.src == src;
+}
+
+/**
+ * Give life to a used entry. It starts from the life of the last evicted entry,
+ * so the entries not used since the last eviction "age" without touching them.
+ * From the entries with the same life the least recently used is evicted first.
+ * @param entry the used cache entry
+ */
+static void entry_life_update(lv_img_cache_entry_t * entry)
+{
+    uint32_t gain = entry->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
+    if(gain > LV_IMG_CACHE_LIFE_LIMIT) gain = LV_IMG_CACHE_LIFE_LIMIT;
+    entry->life = life_base + gain;
+    entry->used = open_cnt;
+}
+
+/**
+ * Close the image of an entry and remove it from its hash bucket
+ * @param entry a used cache entry
+ */
+static void entry_remove(lv_img_cache_entry_t * entry)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t id = entry - cache;
+    uint16_t * link = &buckets[entry->hash & bucket_mask];
+    while(*link != id) link = &cache[*link].next;
+    *link = entry->next;
+
+    lv_img_decoder_close(&entry->dec_dsc);
+    cache_size -= entry->size;
+    cache_used--;
+
+    _lv_memset_00(&entry->dec_dsc, sizeof(lv_img_decoder_dsc_t));
+    _lv_memset_00(entry, sizeof(lv_img_cache_entry_t));
+}
+
+/**
+ * Close the image with the least life
+ * @param keep don't close this entry (can be NULL)
+ * @return true: an image was closed; false: there was nothing to close
+ */
+static bool evict(const lv_img_cache_entry_t * keep)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    lv_img_cache_entry_t * victim = NULL;
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL || &cache[i] == keep) continue;
+        if(victim == NULL || cache[i].life < victim->life ||
+           (cache[i].life == victim->life && (int32_t)(cache[i].used - victim->used) < 0)) {
+            victim = &cache[i];
+        }
+    }
+    if(victim == NULL) return false;
+
+    /*The new lifes start from here, i.e. the others got older*/
+    life_base = victim->life;
+    entry_remove(victim);
+    cache_stats.evictions++;
+    LV_LOG_INFO("image draw: close an image to make room in the cache");
+    return true;
+}
+
+/**
+ * Close images until the cached images fit into the byte budget or only one is left
+ * @param keep don't close this entry (can be NULL)
+ */
+static void fit_budget(const lv_img_cache_entry_t * keep)
+{
+    while(cache_size > budget && cache_used > 1) {
+        if(!evict(keep)) break;
+    }
+}
+#endif
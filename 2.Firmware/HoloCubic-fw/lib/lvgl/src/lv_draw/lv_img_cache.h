@@ -31,12 +31,27 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information */
 
-    /** Count the cache entries's life. Add `time_tio_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused */
+    /** Priority to stay in the cache. Set to the life of the last evicted entry plus `time_to_open`
+     * when the entry is used, so entries not used for long or cheap to open are evicted first.
+     * The entry with the least life is evicted */
     int32_t life;
+
+    uint32_t hash;      /**< Hash of the source (path or pointer) */
+    uint32_t size;      /**< Bytes the opened image keeps allocated, counted in the cache's byte budget */
+    uint32_t hits;      /**< Number of draws served by this entry since it was opened */
+    uint32_t used;      /**< Value of the cache's open counter when the entry was last used, breaks the ties of `life` */
+    uint16_t next;      /**< Index of the next entry in the same hash bucket */
 } lv_img_cache_entry_t;
 
+typedef struct {
+    uint32_t hits;      /**< Images found in the cache */
+    uint32_t misses;    /**< Images opened by the decoders */
+    uint32_t evictions; /**< Images closed to make room for other images */
+    uint32_t open_time; /**< Time spent in opening the missed images [ms] */
+    uint32_t size;      /**< Bytes kept by the cached images now */
+    uint16_t entry_cnt; /**< Number of cached images now */
+} lv_img_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -59,10 +74,30 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color);
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Set the bytes the cached images can keep allocated (see `lv_img_decoder_dsc_t::mem_size`).
+ * The least valuable images are closed until the cache fits into the budget,
+ * but one image (the last opened) is always kept even if it's greater than the budget.
+ * @param bytes the byte budget, 0: limit only the number of images
+ */
+void lv_img_cache_set_budget(uint32_t bytes);
+
+/**
+ * Get the bytes the cached images can keep allocated
+ * @return the byte budget, 0: not limited or no cache
+ */
+uint32_t lv_img_cache_get_budget(void);
+
+/**
+ * Get the statistics of the cache. The counters are reset.
+ * @param stats the counters accumulated since the previous call and the current size are stored here
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
- * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable. NULL to invalidate all.
  */
 void lv_img_cache_invalidate_src(const void * src);
 
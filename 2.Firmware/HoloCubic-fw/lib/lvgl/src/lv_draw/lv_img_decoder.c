@@ -12,6 +12,8 @@
 #include "../lv_misc/lv_ll.h"
 #include "../lv_misc/lv_color.h"
 #include "../lv_misc/lv_gc.h"
+#include "lv_img_cache.h"
+#include <string.h>
 
 #if defined(LV_GC_INCLUDE)
     #include LV_GC_INCLUDE
@@ -23,15 +25,35 @@
 #define CF_BUILT_IN_FIRST LV_IMG_CF_TRUE_COLOR
 #define CF_BUILT_IN_LAST LV_IMG_CF_ALPHA_8BIT
 
+/*Whole images are loaded only if the image cache keeps them open*/
+#define PRELOAD (LV_USE_FILESYSTEM && LV_IMG_DECODER_PRELOAD_SIZE && LV_IMG_CACHE_DEF_SIZE)
+
+#if LV_IMG_DECODER_STRIP_SIZE
+#define STRIP_ALIGN 512 /*File system sector, whole sectors can be read without copying*/
+#define STRIP_SIZE ((LV_IMG_DECODER_STRIP_SIZE + STRIP_ALIGN - 1) & ~(STRIP_ALIGN - 1))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 typedef struct {
 #if LV_USE_FILESYSTEM
     lv_fs_file_t * f;
+#if LV_IMG_DECODER_STRIP_SIZE
+    uint8_t * strip;     /*Data read ahead from the file*/
+    uint32_t strip_pos;  /*File position of `strip[0]`*/
+    uint32_t strip_len;  /*Valid bytes in `strip`*/
+#endif
+    uint8_t * fs_buf;    /*Line of an indexed image read from the file*/
+#endif
+#if PRELOAD
+    uint8_t * img_buf;   /*The whole image loaded from the file*/
 #endif
     lv_color_t * palette;
     lv_opa_t * opa;
+#if LV_IMG_DECODER_INDEXED_LUT
+    uint8_t * lut;       /*The pixels of every byte value, see `indexed_lut_init`*/
+#endif
 } lv_img_decoder_built_in_data_t;
 
 /**********************
@@ -43,6 +65,19 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
                                                    lv_coord_t len, uint8_t * buf);
 static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                      lv_coord_t len, uint8_t * buf);
+#if PRELOAD
+static lv_res_t preload(lv_img_decoder_dsc_t * dsc);
+#endif
+#if LV_IMG_CF_INDEXED
+static inline void indexed_px_write(uint8_t * buf, lv_color_t color, lv_opa_t opa);
+#if LV_IMG_DECODER_INDEXED_LUT
+static void indexed_lut_init(lv_img_decoder_built_in_data_t * user_data, uint8_t px_size);
+#endif
+#endif
+#if LV_USE_FILESYSTEM
+static const uint8_t * file_read_at(lv_img_decoder_built_in_data_t * user_data, uint32_t pos, uint32_t len,
+                                    uint8_t * buf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -51,6 +86,15 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
 /**********************
  *      MACROS
  **********************/
+/*Copy the table entries of the whole bytes of a line in `lv_img_decoder_built_in_line_indexed`.
+ *`memcpy` with a constant size is inlined by the compiler, `_lv_memcpy_small` copies byte by byte*/
+#define INDEXED_LUT_COPY(entry_size)                                        \
+    while(len >= px_per_byte) {                                             \
+        memcpy(buf, &lut[*data_tmp * (entry_size)], (entry_size));          \
+        buf += (entry_size);                                                \
+        len -= px_per_byte;                                                 \
+        data_tmp++;                                                         \
+    }
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -145,6 +189,7 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 
         dsc->error_msg = NULL;
         dsc->img_data  = NULL;
+        dsc->mem_size  = 0;
         dsc->decoder   = d;
 
         res = d->open_cb(d, dsc);
@@ -153,6 +198,12 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
         if(res == LV_RES_OK) break;
     }
 
+    /*`lv_img_decoder_close` frees the copy of the file name only if a decoder took the image*/
+    if(res != LV_RES_OK && dsc->src_type == LV_IMG_SRC_FILE) {
+        lv_mem_free(dsc->src);
+        dsc->src = NULL;
+    }
+
     return res;
 }
 
@@ -292,6 +343,10 @@ lv_res_t lv_img_decoder_built_in_info(lv_img_decoder_t * decoder, const void * s
 
         if(header->cf < CF_BUILT_IN_FIRST || header->cf > CF_BUILT_IN_LAST) return LV_RES_INV;
 
+        if(!lv_img_header_byte_order_ok(header)) {
+            LV_LOG_WARN("Image get info: the RGB565 bytes of the file are in the other order than LV_COLOR_16_SWAP");
+            return LV_RES_INV;
+        }
     }
 #endif
     else if(src_type == LV_IMG_SRC_SYMBOL) {
@@ -354,6 +409,13 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
 
         _lv_memcpy_small(user_data->f, &f, sizeof(f));
 
+        /*Memory kept until the image is closed (the strip is allocated on the first read)*/
+        dsc->mem_size = sizeof(lv_img_decoder_built_in_data_t) + sizeof(f) + f.drv->file_size +
+                        f.drv->file_extra_size;
+#if LV_IMG_DECODER_STRIP_SIZE
+        dsc->mem_size += STRIP_SIZE;
+#endif
+
 #else
         LV_LOG_WARN("Image built-in decoder cannot read file because LV_USE_FILESYSTEM = 0");
         return LV_RES_INV;
@@ -376,6 +438,10 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
             return LV_RES_OK;
         }
         else {
+#if PRELOAD
+            /*Small images are loaded to RAM and drawn like variables*/
+            if(preload(dsc) == LV_RES_OK) return LV_RES_OK;
+#endif
             /*If it's a file it need to be read line by line later*/
             dsc->img_data = NULL;
             return LV_RES_OK;
@@ -399,6 +465,7 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
                 return LV_RES_INV;
             }
             _lv_memset_00(dsc->user_data, sizeof(lv_img_decoder_built_in_data_t));
+            dsc->mem_size += sizeof(lv_img_decoder_built_in_data_t);
         }
 
         lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
@@ -440,6 +507,12 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
             }
         }
 
+        dsc->mem_size += palette_size * (sizeof(lv_color_t) + sizeof(lv_opa_t));
+
+#if LV_IMG_DECODER_INDEXED_LUT
+        indexed_lut_init(user_data, px_size);
+        if(user_data->lut) dsc->mem_size += 256 * (8 / px_size) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+#endif
         dsc->img_data = NULL;
         return LV_RES_OK;
 #else
@@ -527,9 +600,19 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
             lv_fs_close(user_data->f);
             lv_mem_free(user_data->f);
         }
+#if LV_IMG_DECODER_STRIP_SIZE
+        if(user_data->strip) lv_mem_free(user_data->strip);
+#endif
+        if(user_data->fs_buf) lv_mem_free(user_data->fs_buf);
+#endif
+#if PRELOAD
+        if(user_data->img_buf) lv_mem_free(user_data->img_buf);
 #endif
         if(user_data->palette) lv_mem_free(user_data->palette);
         if(user_data->opa) lv_mem_free(user_data->opa);
+#if LV_IMG_DECODER_INDEXED_LUT
+        if(user_data->lut) lv_mem_free(user_data->lut);
+#endif
 
         lv_mem_free(user_data);
 
@@ -547,23 +630,17 @@ static lv_res_t lv_img_decoder_built_in_line_true_color(lv_img_decoder_dsc_t * d
 {
 #if LV_USE_FILESYSTEM
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
-    lv_fs_res_t res;
     uint8_t px_size = lv_img_cf_get_px_size(dsc->header.cf);
 
     uint32_t pos = ((y * dsc->header.w + x) * px_size) >> 3;
     pos += 4; /*Skip the header*/
-    res = lv_fs_seek(user_data->f, pos);
-    if(res != LV_FS_RES_OK) {
-        LV_LOG_WARN("Built-in image decoder seek failed");
-        return LV_RES_INV;
-    }
     uint32_t btr = len * (px_size >> 3);
-    uint32_t br  = 0;
-    res = lv_fs_read(user_data->f, buf, btr, &br);
-    if(res != LV_FS_RES_OK || btr != br) {
+    const uint8_t * data = file_read_at(user_data, pos, btr, buf);
+    if(data == NULL) {
         LV_LOG_WARN("Built-in image decoder read failed");
         return LV_RES_INV;
     }
+    if(data != buf) _lv_memcpy(buf, data, btr);
 
     return LV_RES_OK;
 #else
@@ -654,9 +731,13 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
     }
     else {
 #if LV_USE_FILESYSTEM
-        lv_fs_seek(user_data->f, ofs + 4); /*+4 to skip the header*/
-        lv_fs_read(user_data->f, fs_buf, w, NULL);
-        data_tmp = fs_buf;
+        /*Only the bytes of the `len` pixels, the rest of the row may be beyond the end of the file*/
+        uint32_t btr = (8 - px_size - pos + len * px_size + 7) >> 3;
+        data_tmp = file_read_at(user_data, ofs + 4, btr, fs_buf); /*+4 to skip the header*/
+        if(data_tmp == NULL) {
+            _lv_mem_buf_release(fs_buf);
+            return LV_RES_INV;
+        }
 #else
         LV_LOG_WARN("Image built-in alpha line reader can't read file because LV_USE_FILESYSTEM = 0");
         data_tmp = NULL; /*To avoid warnings*/
@@ -730,9 +811,6 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
 
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
 
-#if LV_USE_FILESYSTEM
-    uint8_t * fs_buf = _lv_mem_buf_get(w);
-#endif
     const uint8_t * data_tmp = NULL;
     if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         const lv_img_dsc_t * img_dsc = dsc->src;
@@ -740,9 +818,17 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
     }
     else {
 #if LV_USE_FILESYSTEM
-        lv_fs_seek(user_data->f, ofs + 4); /*+4 to skip the header*/
-        lv_fs_read(user_data->f, fs_buf, w, NULL);
-        data_tmp = fs_buf;
+        /*Kept until the image is closed instead of getting a buffer for every line*/
+        if(user_data->fs_buf == NULL) {
+            user_data->fs_buf = lv_mem_alloc(w);
+            LV_ASSERT_MEM(user_data->fs_buf);
+            if(user_data->fs_buf == NULL) return LV_RES_INV;
+        }
+
+        /*Only the bytes of the `len` pixels, the rest of the row may be beyond the end of the file*/
+        uint32_t btr = (8 - px_size - pos + len * px_size + 7) >> 3;
+        data_tmp = file_read_at(user_data, ofs + 4, btr, user_data->fs_buf); /*+4 to skip the header*/
+        if(data_tmp == NULL) return LV_RES_INV;
 #else
         LV_LOG_WARN("Image built-in indexed line reader can't read file because LV_USE_FILESYSTEM = 0");
         data_tmp = NULL; /*To avoid warnings*/
@@ -750,23 +836,48 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
 #endif
     }
 
+#if LV_IMG_DECODER_INDEXED_LUT
+    if(user_data->lut) {
+        /*Copy the pixels of a byte from the table. Only the first and last byte can be partial*/
+        const uint8_t * lut = user_data->lut;
+        lv_coord_t px_per_byte = 8 / px_size;
+        uint32_t entry_size = px_per_byte * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        lv_coord_t skip = (8 - px_size - pos) / px_size; /*Pixels of the first byte before `x`*/
+        if(skip) {
+            lv_coord_t n = LV_MATH_MIN(px_per_byte - skip, len);
+            _lv_memcpy_small(buf, &lut[*data_tmp * entry_size + skip * LV_IMG_PX_SIZE_ALPHA_BYTE],
+                             n * LV_IMG_PX_SIZE_ALPHA_BYTE);
+            buf += n * LV_IMG_PX_SIZE_ALPHA_BYTE;
+            len -= n;
+            data_tmp++;
+        }
+
+        /*A constant entry size for every format*/
+        switch(px_size) {
+            case 1:
+                INDEXED_LUT_COPY(8 * LV_IMG_PX_SIZE_ALPHA_BYTE);
+                break;
+            case 2:
+                INDEXED_LUT_COPY(4 * LV_IMG_PX_SIZE_ALPHA_BYTE);
+                break;
+            case 4:
+                INDEXED_LUT_COPY(2 * LV_IMG_PX_SIZE_ALPHA_BYTE);
+                break;
+            default:
+                INDEXED_LUT_COPY(LV_IMG_PX_SIZE_ALPHA_BYTE);
+                break;
+        }
+
+        if(len > 0) _lv_memcpy_small(buf, &lut[*data_tmp * entry_size], len * LV_IMG_PX_SIZE_ALPHA_BYTE);
+        return LV_RES_OK;
+    }
+#endif
+
     lv_coord_t i;
     for(i = 0; i < len; i++) {
         uint8_t val_act = (*data_tmp & (mask << pos)) >> pos;
 
-        lv_color_t color = user_data->palette[val_act];
-#if LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
-        buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE] = color.full;
-#elif LV_COLOR_DEPTH == 16
-        /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
-        buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE] = color.full & 0xFF;
-        buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 1] = (color.full >> 8) & 0xFF;
-#elif LV_COLOR_DEPTH == 32
-        *((uint32_t *)&buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE]) = color.full;
-#else
-#error "Invalid LV_COLOR_DEPTH. Check it in lv_conf.h"
-#endif
-        buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = user_data->opa[val_act];
+        indexed_px_write(&buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE], user_data->palette[val_act], user_data->opa[val_act]);
 
         pos -= px_size;
         if(pos < 0) {
@@ -774,12 +885,152 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
             data_tmp++;
         }
     }
-#if LV_USE_FILESYSTEM
-    _lv_mem_buf_release(fs_buf);
-#endif
     return LV_RES_OK;
 #else
     LV_LOG_WARN("Image built-in indexed line reader failed because LV_IMG_CF_INDEXED is 0 in lv_conf.h");
     return LV_RES_INV;
 #endif
 }
+
+#if PRELOAD
+/**
+ * Load a whole true color image file to RAM if it's not greater than `LV_IMG_DECODER_PRELOAD_SIZE`
+ * and fits into the budget of the image cache which keeps it open. The file is closed then.
+ * @param dsc the decoder descriptor of an opened file
+ * @return LV_RES_OK: `dsc->img_data` is set; LV_RES_INV: the image is read line by line
+ */
+static lv_res_t preload(lv_img_decoder_dsc_t * dsc)
+{
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    uint32_t size = lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+    uint32_t budget = lv_img_cache_get_budget();
+    if(size > LV_IMG_DECODER_PRELOAD_SIZE || (budget && size > budget)) return LV_RES_INV;
+
+    user_data->img_buf = lv_mem_alloc(size);
+    if(user_data->img_buf == NULL) {
+        LV_LOG_INFO("img_decoder_built_in_open: no memory to load the image, read it line by line");
+        return LV_RES_INV;
+    }
+
+    uint32_t br = 0;
+    if(lv_fs_seek(user_data->f, 4) != LV_FS_RES_OK ||  /*Skip the header*/
+       lv_fs_read(user_data->f, user_data->img_buf, size, &br) != LV_FS_RES_OK || br != size) {
+        LV_LOG_WARN("img_decoder_built_in_open: can't load the image");
+        lv_mem_free(user_data->img_buf);
+        user_data->img_buf = NULL;
+        return LV_RES_INV;
+    }
+
+    lv_fs_close(user_data->f);
+    lv_mem_free(user_data->f);
+    user_data->f = NULL;
+
+    dsc->img_data = user_data->img_buf;
+    dsc->mem_size = sizeof(lv_img_decoder_built_in_data_t) + size;
+    return LV_RES_OK;
+}
+#endif
+
+#if LV_IMG_CF_INDEXED
+/**
+ * Write a pixel of an indexed image in the format of the decoded lines (color + opacity)
+ * @param buf destination, can be unaligned
+ * @param color color of the pixel
+ * @param opa opacity of the pixel
+ */
+static inline void indexed_px_write(uint8_t * buf, lv_color_t color, lv_opa_t opa)
+{
+#if LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
+    buf[0] = color.full;
+#elif LV_COLOR_DEPTH == 16
+    /*Because of Alpha byte 16 bit color can start on odd address which can cause crash*/
+    buf[0] = color.full & 0xFF;
+    buf[1] = (color.full >> 8) & 0xFF;
+#elif LV_COLOR_DEPTH == 32
+    _lv_memcpy_small(buf, &color.full, sizeof(color.full));
+#else
+#error "Invalid LV_COLOR_DEPTH. Check it in lv_conf.h"
+#endif
+    buf[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = opa;
+}
+
+#if LV_IMG_DECODER_INDEXED_LUT
+/**
+ * Build the table of the decoded pixels of every byte value of an indexed image:
+ * 256 entries of `8 / px_size` pixels (color + opacity), e.g. 2 pixels per byte with 4 bit indices.
+ * The lines are then unpacked a byte at a time instead of pixel by pixel.
+ * Without memory for the table the pixels are looked up in the palette one by one.
+ * @param user_data the palette of the image, the table is stored here
+ * @param px_size bits per pixel (1, 2, 4 or 8)
+ */
+static void indexed_lut_init(lv_img_decoder_built_in_data_t * user_data, uint8_t px_size)
+{
+    uint8_t px_per_byte = 8 / px_size;
+    uint8_t mask        = (1 << px_size) - 1;
+
+    user_data->lut = lv_mem_alloc(256 * px_per_byte * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    if(user_data->lut == NULL) {
+        LV_LOG_WARN("img_decoder_built_in_open: no memory for the indexed pixel table");
+        return;
+    }
+
+    uint8_t * entry = user_data->lut;
+    uint32_t b;
+    for(b = 0; b < 256; b++) {
+        int8_t pos;
+        for(pos = 8 - px_size; pos >= 0; pos -= px_size) {
+            uint8_t val = (b >> pos) & mask;
+            indexed_px_write(entry, user_data->palette[val], user_data->opa[val]);
+            entry += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+}
+#endif
+#endif
+
+#if LV_USE_FILESYSTEM
+/**
+ * Read `len` bytes from position `pos` of an image file.
+ * With `LV_IMG_DECODER_STRIP_SIZE` a strip starting on a sector boundary is read ahead
+ * and the following calls are served from it while they fall into it.
+ * @param user_data the file and the strip of the image
+ * @param pos position in the file
+ * @param len number of bytes
+ * @param buf the bytes are read here if they don't fit into the strip
+ * @return pointer to the bytes (in the strip or `buf`) or NULL on error
+ */
+static const uint8_t * file_read_at(lv_img_decoder_built_in_data_t * user_data, uint32_t pos, uint32_t len,
+                                    uint8_t * buf)
+{
+    uint32_t br = 0;
+
+#if LV_IMG_DECODER_STRIP_SIZE
+    if(len <= STRIP_SIZE - STRIP_ALIGN) {
+        if(user_data->strip == NULL) {
+            user_data->strip = lv_mem_alloc(STRIP_SIZE);
+            user_data->strip_len = 0;
+        }
+
+        if(user_data->strip) {
+            if(pos < user_data->strip_pos || pos + len > user_data->strip_pos + user_data->strip_len) {
+                uint32_t start = pos & ~(STRIP_ALIGN - 1);
+                user_data->strip_len = 0;
+                if(lv_fs_seek(user_data->f, start) != LV_FS_RES_OK) return NULL;
+                /*Reading past the end of the file gives less bytes*/
+                lv_fs_read(user_data->f, user_data->strip, STRIP_SIZE, &br);
+                user_data->strip_pos = start;
+                user_data->strip_len = br;
+                if(pos + len > start + br) return NULL;
+            }
+
+            return &user_data->strip[pos - user_data->strip_pos];
+        }
+    }
+#endif
+
+    if(lv_fs_seek(user_data->f, pos) != LV_FS_RES_OK) return NULL;
+    if(lv_fs_read(user_data->f, buf, len, &br) != LV_FS_RES_OK || br != len) return NULL;
+
+    return buf;
+}
+#endif
@@ -144,6 +144,10 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
     disp->inv_p = 0;
     disp->last_activity_time = 0;
 
+#if LV_USE_REFR_GOV
+    lv_refr_gov_set_fps(disp, LV_REFR_GOV_DEF_FPS);
+#endif
+
     disp->bg_color = LV_COLOR_WHITE;
     disp->bg_img = NULL;
 #if LV_COLOR_SCREEN_TRANSP
@@ -34,6 +34,12 @@ extern "C" {
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
 
+#if LV_REFR_TILE_TRACK
+#define LV_REFR_TILE_COLS ((LV_HOR_RES_MAX + LV_REFR_TILE_SIZE - 1) / LV_REFR_TILE_SIZE)
+#define LV_REFR_TILE_ROWS ((LV_VER_RES_MAX + LV_REFR_TILE_SIZE - 1) / LV_REFR_TILE_SIZE)
+#define LV_REFR_TILE_WORDS ((LV_REFR_TILE_COLS + 31) / 32)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -119,7 +125,8 @@ typedef struct _disp_drv_t {
 
 #if LV_USE_GPU
 
-    /** OPTIONAL: Blend two memories using opacity (GPU only)*/
+    /** OPTIONAL: Blend two memories using opacity (GPU only)
+     * It may return before the blending is finished. `gpu_wait_cb` is called before `src` is reused*/
     void (*gpu_blend_cb)(struct _disp_drv_t * disp_drv, lv_color_t * dest, const lv_color_t * src, uint32_t length,
                          lv_opa_t opa);
 
@@ -140,6 +147,25 @@ typedef struct _disp_drv_t {
 
 struct _lv_obj_t;
 
+#if LV_USE_REFR_GOV
+/**
+ * State of the refresh governor of a display.
+ */
+typedef struct {
+    uint32_t fps;           /**< Target FPS*/
+    uint32_t cost_avg;      /**< Average render + flush time of a frame [1/16 ms]*/
+    uint32_t last_frame;    /**< Time of the last refreshed frame*/
+    uint8_t idle : 1;       /**< 1: the tasks are slowed down*/
+
+    /*Statistics since the last `lv_refr_gov_get_stats`*/
+    uint32_t stat_start;
+    uint32_t stat_frames;
+    uint32_t stat_missed;
+    uint32_t stat_cost_sum;
+    uint32_t stat_cost_max;
+} lv_refr_gov_t;
+#endif
+
 /**
  * Display structure.
  * @note `lv_disp_drv_t` should be the first member of the structure.
@@ -173,6 +199,16 @@ uint8_t del_prev  :
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p : 10;
 
+#if LV_REFR_TILE_TRACK
+    /** Invalidated tiles, one bit per `LV_REFR_TILE_SIZE` sized tile.
+     * Converted to `inv_areas` when the refresh starts*/
+    uint32_t inv_tiles[LV_REFR_TILE_ROWS][LV_REFR_TILE_WORDS];
+#endif
+
+#if LV_USE_REFR_GOV
+    lv_refr_gov_t gov;
+#endif
+
     /*Miscellaneous data*/
     uint32_t last_activity_time; /**< Last time there was activity on this display */
 } lv_disp_t;
@@ -216,6 +216,16 @@ void lv_anim_refr_now(void)
     anim_task(NULL);
 }
 
+/**
+ * Set how often the animations are updated.
+ * Used by the refresh governor to step the animations once per frame.
+ * @param period new period of the animation task [ms]
+ */
+void _lv_anim_set_task_period(uint32_t period)
+{
+    lv_task_set_period(_lv_anim_task, period);
+}
+
 /**
  * Calculate the current value of an animation applying linear characteristic
  * @param a pointer to an animation
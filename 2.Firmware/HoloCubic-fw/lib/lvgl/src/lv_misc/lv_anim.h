@@ -366,6 +366,13 @@ uint16_t lv_anim_speed_to_time(uint16_t speed, lv_anim_value_t start, lv_anim_va
  */
 void lv_anim_refr_now(void);
 
+/**
+ * Set how often the animations are updated.
+ * Used by the refresh governor to step the animations once per frame.
+ * @param period new period of the animation task [ms]
+ */
+void _lv_anim_set_task_period(uint32_t period);
+
 /**
  * Calculate the current value of an animation applying linear characteristic
  * @param a pointer to an animation
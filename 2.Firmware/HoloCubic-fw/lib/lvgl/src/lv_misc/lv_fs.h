@@ -64,6 +64,7 @@ typedef struct _lv_fs_drv_t {
     char letter;
     uint16_t file_size;
     uint16_t rddir_size;
+    uint32_t file_extra_size; /**< Bytes the driver allocates for an opened file besides `file_size` (e.g. a read cache)*/
     bool (*ready_cb)(struct _lv_fs_drv_t * drv);
 
     lv_fs_res_t (*open_cb)(struct _lv_fs_drv_t * drv, void * file_p, const char * path, lv_fs_mode_t mode);
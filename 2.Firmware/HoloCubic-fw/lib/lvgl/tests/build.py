@@ -217,6 +217,7 @@ all_obj_all_features = {
   "LV_USE_ANIMATION":1,
   "LV_ANTIALIAS":1,
   "LV_GPU":1,
+  "LV_REFR_TILE_TRACK":1,
   "LV_USE_FILESYSTEM":1,
   "LV_USE_IMG_TRANSFORM":1,
   "LV_USE_API_EXTENSION_V6":1,
@@ -298,6 +299,12 @@ advanced_features = {
   "LV_USE_ANIMATION":1,
   "LV_ANTIALIAS":1,
   "LV_GPU":1,
+  "LV_REFR_TILE_TRACK":1,
+  "LV_USE_REFR_PROF":1,
+  "LV_USE_REFR_GOV":1,
+  "LV_IMG_DECODER_STRIP_SIZE":1024,
+  "LV_IMG_DECODER_INDEXED_LUT":1,
+  "LV_IMG_DECODER_PRELOAD_SIZE":1024,
   "LV_USE_FILESYSTEM":1,
   "LV_USE_IMG_TRANSFORM":1,
   "LV_USE_API_EXTENSION_V6":1,
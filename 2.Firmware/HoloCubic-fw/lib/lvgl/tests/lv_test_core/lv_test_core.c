@@ -13,6 +13,9 @@
 #include "lv_test_obj.h"
 #include "lv_test_style.h"
 #include "lv_test_font_loader.h"
+#include "lv_test_refr.h"
+#include "lv_test_img_decoder.h"
+#include "lv_test_img_cache.h"
 
 /*********************
  *      DEFINES
@@ -48,6 +51,9 @@ void lv_test_core(void)
     lv_test_obj();
     lv_test_style();
     lv_test_font_loader();
+    lv_test_refr();
+    lv_test_img_decoder();
+    lv_test_img_cache();
 }
 
 
@@ -0,0 +1,209 @@
+/**
+ * @file lv_test_img_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_cache.h"
+#include <stdio.h>
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_FN_A    "lv_test_img_cache_a.bin"
+#define IMG_FN_B    "lv_test_img_cache_b.bin"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_IMG_CACHE_DEF_SIZE
+static void lookup_and_lru(void);
+static void invalidate(void);
+#if LV_USE_FILESYSTEM
+static void budget(void);
+static void img_file_write(const char * fn);
+#endif
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_IMG_CACHE_DEF_SIZE
+static lv_color_t img_px[3][4];
+static lv_img_dsc_t img[3];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_cache(void)
+{
+    lv_test_print("");
+    lv_test_print("===========================");
+    lv_test_print("Start lv_img_cache testing");
+    lv_test_print("===========================");
+
+#if LV_IMG_CACHE_DEF_SIZE
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        img[i].header.cf = LV_IMG_CF_TRUE_COLOR;
+        img[i].header.w = 2;
+        img[i].header.h = 2;
+        img[i].data_size = sizeof(img_px[i]);
+        img[i].data = (const uint8_t *)img_px[i];
+    }
+
+    lookup_and_lru();
+    invalidate();
+#if LV_USE_FILESYSTEM
+    budget();
+#endif
+
+    /*Restore the default cache*/
+    lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+    lv_img_cache_set_budget(LV_IMG_CACHE_DEF_BUDGET);
+#else
+    lv_test_print("Skip: LV_IMG_CACHE_DEF_SIZE is 0");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_IMG_CACHE_DEF_SIZE
+static void lookup_and_lru(void)
+{
+    lv_test_print("Find the cached images and close the least recently used");
+
+    lv_img_cache_set_size(2);
+    lv_img_cache_set_budget(0);
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+
+    lv_img_cache_entry_t * a = _lv_img_cache_open(&img[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&img[1], LV_COLOR_BLACK);
+    lv_test_assert_ptr_eq(a, _lv_img_cache_open(&img[0], LV_COLOR_BLACK), "The same entry for the same image");
+    lv_test_assert_int_eq(1, a->hits, "Hits of the entry");
+
+    /*`img[1]` is the least recently used*/
+    _lv_img_cache_open(&img[2], LV_COLOR_BLACK);
+    _lv_img_cache_open(&img[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&img[1], LV_COLOR_BLACK);
+
+    lv_img_cache_get_stats(&stats);
+    lv_test_assert_int_eq(2, stats.hits, "Hits");
+    lv_test_assert_int_eq(4, stats.misses, "Misses");
+    lv_test_assert_int_eq(2, stats.evictions, "Evictions");
+    lv_test_assert_int_eq(2, stats.entry_cnt, "Cached images");
+    lv_test_assert_int_eq(0, stats.size, "Variables take no memory");
+}
+
+static void invalidate(void)
+{
+    lv_test_print("Invalidate a cached image");
+
+    lv_img_cache_set_size(4);
+    lv_img_cache_stats_t stats;
+    _lv_img_cache_open(&img[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&img[1], LV_COLOR_BLACK);
+    lv_img_cache_get_stats(&stats);
+
+    lv_img_cache_invalidate_src(&img[0]);
+    _lv_img_cache_open(&img[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&img[1], LV_COLOR_BLACK);
+
+    lv_img_cache_get_stats(&stats);
+    lv_test_assert_int_eq(1, stats.hits, "The other image is still cached");
+    lv_test_assert_int_eq(1, stats.misses, "The invalidated image is opened again");
+}
+
+#if LV_USE_FILESYSTEM
+static void budget(void)
+{
+    lv_test_print("Keep the cached files in the byte budget");
+
+    img_file_write(IMG_FN_A);
+    img_file_write(IMG_FN_B);
+
+    lv_img_cache_set_size(4);
+    lv_img_cache_set_budget(1);
+    lv_img_cache_stats_t stats;
+    lv_img_cache_get_stats(&stats);
+
+    _lv_img_cache_open(&img[0], LV_COLOR_BLACK);
+    _lv_img_cache_open("f:" IMG_FN_A, LV_COLOR_BLACK);
+    lv_img_cache_get_stats(&stats);
+    lv_test_assert_int_eq(1, stats.entry_cnt, "Only the last image is kept over the budget");
+    lv_test_assert_true(stats.size > 0, "Files take memory");
+    uint32_t file_size = stats.size;
+
+    /*The second file fits into the budget now, so it's loaded to RAM: it keeps its pixels instead of
+     *the open file and the strip. The first file is still read line by line*/
+    uint32_t preload_size = file_size;
+#if LV_IMG_DECODER_PRELOAD_SIZE
+    lv_fs_drv_t * drv = lv_fs_get_drv('f');
+    preload_size -= sizeof(lv_fs_file_t) + drv->file_size + drv->file_extra_size;
+#if LV_IMG_DECODER_STRIP_SIZE
+    preload_size -= (LV_IMG_DECODER_STRIP_SIZE + 511) & ~511;
+#endif
+    preload_size += lv_img_buf_get_img_size(2, 2, LV_IMG_CF_TRUE_COLOR);
+#endif
+
+    lv_img_cache_set_budget(file_size * 2);
+    _lv_img_cache_open("f:" IMG_FN_B, LV_COLOR_BLACK);
+    _lv_img_cache_open("f:" IMG_FN_A, LV_COLOR_BLACK);
+    lv_img_cache_get_stats(&stats);
+    lv_test_assert_int_eq(1, stats.hits, "Both files fit into the budget");
+    lv_test_assert_int_eq(file_size + preload_size, stats.size, "Size of two files");
+
+    /*The paths are copied by the decoder, look them up by value*/
+    char path[32];
+    lv_snprintf(path, sizeof(path), "f:%s", IMG_FN_B);
+    lv_img_cache_invalidate_src(path);
+    lv_img_cache_get_stats(&stats);
+    lv_test_assert_int_eq(1, stats.entry_cnt, "Invalidate a file by its path");
+
+    lv_img_cache_set_budget(1);
+    lv_img_cache_get_stats(&stats);
+    lv_test_assert_int_eq(1, stats.entry_cnt, "A smaller budget keeps one image");
+
+    lv_img_cache_invalidate_src(NULL);
+    remove(IMG_FN_A);
+    remove(IMG_FN_B);
+}
+
+static void img_file_write(const char * fn)
+{
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = LV_IMG_CF_TRUE_COLOR;
+    header.w = 2;
+    header.h = 2;
+
+    FILE * fp = fopen(fn, "wb");
+    fwrite(&header, sizeof(header), 1, fp);
+    lv_color_t px[4];
+    _lv_memset_00(px, sizeof(px));
+    fwrite(px, sizeof(px), 1, fp);
+    fclose(fp);
+}
+#endif
+#endif
+
+#endif
@@ -0,0 +1,322 @@
+/**
+ * @file lv_test_img_decoder.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_decoder.h"
+#include <stdio.h>
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W       57  /*Rows not aligned to the sectors*/
+#define IMG_H       41
+#define IMG_FN      "lv_test_img_decoder.bin"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_FILESYSTEM
+static void file_true_color(void);
+#if LV_IMG_DECODER_PRELOAD_SIZE && LV_IMG_CACHE_DEF_SIZE
+static void file_preload(void);
+#endif
+#if LV_IMG_CF_ALPHA
+static void file_alpha(void);
+#endif
+#if LV_IMG_CF_INDEXED
+static void file_indexed(lv_img_cf_t cf, uint8_t bpp);
+#endif
+static void file_byte_order(void);
+static void img_file_write(lv_img_cf_t cf, uint32_t px_bits);
+static void img_file_write_size(lv_img_cf_t cf, uint32_t px_bits, lv_coord_t w, lv_coord_t h);
+static void img_file_set_order(uint8_t order);
+static uint8_t px_byte(uint32_t i);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_decoder(void)
+{
+    lv_test_print("");
+    lv_test_print("===========================");
+    lv_test_print("Start lv_img_decoder testing");
+    lv_test_print("===========================");
+
+#if LV_USE_FILESYSTEM
+    file_true_color();
+#if LV_IMG_DECODER_PRELOAD_SIZE && LV_IMG_CACHE_DEF_SIZE
+    file_preload();
+#endif
+#if LV_IMG_CF_ALPHA
+    file_alpha();
+#endif
+#if LV_IMG_CF_INDEXED
+    file_indexed(LV_IMG_CF_INDEXED_1BIT, 1);
+    file_indexed(LV_IMG_CF_INDEXED_2BIT, 2);
+    file_indexed(LV_IMG_CF_INDEXED_4BIT, 4);
+    file_indexed(LV_IMG_CF_INDEXED_8BIT, 8);
+#endif
+    file_byte_order();
+    remove(IMG_FN);
+#else
+    lv_test_print("Skip: LV_USE_FILESYSTEM is disabled");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_FILESYSTEM
+static void file_true_color(void)
+{
+    lv_test_print("Read lines of a true color image file");
+
+    img_file_write(LV_IMG_CF_TRUE_COLOR, LV_COLOR_SIZE);
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "Open the file");
+    lv_test_assert_ptr_eq(NULL, dsc.img_data, "Read line by line");
+
+    uint32_t px_size = LV_COLOR_SIZE / 8;
+    uint8_t buf[IMG_W * 4];
+    uint8_t ref[IMG_W * 4];
+    bool ok = true;
+    uint32_t i;
+
+    /*Downwards like the drawing, then backwards and partial lines*/
+    lv_coord_t y;
+    for(y = 0; y < IMG_H; y++) {
+        if(lv_img_decoder_read_line(&dsc, 0, y, IMG_W, buf) != LV_RES_OK) ok = false;
+        for(i = 0; i < IMG_W * px_size; i++) ref[i] = px_byte(y * IMG_W * px_size + i);
+        if(memcmp(buf, ref, IMG_W * px_size)) ok = false;
+    }
+    for(y = IMG_H - 1; y >= 0; y -= 3) {
+        lv_coord_t x = y % 7;
+        lv_coord_t len = IMG_W - x - y % 5;
+        if(lv_img_decoder_read_line(&dsc, x, y, len, buf) != LV_RES_OK) ok = false;
+        for(i = 0; i < len * px_size; i++) ref[i] = px_byte((y * IMG_W + x) * px_size + i);
+        if(memcmp(buf, ref, len * px_size)) ok = false;
+    }
+    lv_test_assert_true(ok, "The lines are the file's pixels");
+
+    res = lv_img_decoder_read_line(&dsc, 0, IMG_H, IMG_W, buf);
+    lv_test_assert_int_eq(LV_RES_INV, res, "A line after the end is an error");
+
+    lv_img_decoder_close(&dsc);
+}
+
+#if LV_IMG_DECODER_PRELOAD_SIZE && LV_IMG_CACHE_DEF_SIZE
+static void file_preload(void)
+{
+    lv_test_print("Load a small image file to RAM");
+
+    /*The test image above is too large*/
+    lv_coord_t w = 8;
+    lv_coord_t h = LV_IMG_DECODER_PRELOAD_SIZE / (w * LV_COLOR_SIZE / 8);
+    img_file_write_size(LV_IMG_CF_TRUE_COLOR, LV_COLOR_SIZE, w, h);
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "Open the file");
+    lv_test_assert_true(dsc.img_data != NULL, "The image is in RAM");
+
+    bool ok = true;
+    uint32_t i;
+    for(i = 0; i < (uint32_t)w * h * LV_COLOR_SIZE / 8; i++) {
+        if(dsc.img_data[i] != px_byte(i)) ok = false;
+    }
+    lv_test_assert_true(ok, "The pixels are the file's pixels");
+    lv_img_decoder_close(&dsc);
+
+    /*The cache couldn't keep it*/
+    uint32_t budget = lv_img_cache_get_budget();
+    lv_img_cache_set_budget(16);
+    lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_ptr_eq(NULL, dsc.img_data, "Read line by line over the cache's budget");
+    lv_img_decoder_close(&dsc);
+    lv_img_cache_set_budget(budget);
+
+    img_file_write_size(LV_IMG_CF_TRUE_COLOR, LV_COLOR_SIZE, w, h + 1);
+    lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_ptr_eq(NULL, dsc.img_data, "Read a greater image line by line");
+    lv_img_decoder_close(&dsc);
+}
+#endif
+
+#if LV_IMG_CF_ALPHA
+static void file_alpha(void)
+{
+    lv_test_print("Read lines of an alpha image file");
+
+    img_file_write(LV_IMG_CF_ALPHA_8BIT, 8);
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "Open the file");
+
+    uint8_t buf[IMG_W * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    bool ok = true;
+    lv_coord_t y;
+    for(y = IMG_H - 1; y >= 0; y--) {
+        /*The last line ends at the end of the file*/
+        lv_coord_t x = y == IMG_H - 1 ? 0 : y % 11;
+        lv_coord_t len = IMG_W - x;
+        if(lv_img_decoder_read_line(&dsc, x, y, len, buf) != LV_RES_OK) ok = false;
+        lv_coord_t i;
+        for(i = 0; i < len; i++) {
+            uint8_t opa = buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            if(opa != px_byte(y * IMG_W + x + i)) ok = false;
+        }
+    }
+    lv_test_assert_true(ok, "The opacities are the file's bytes");
+
+    lv_img_decoder_close(&dsc);
+}
+#endif
+
+#if LV_IMG_CF_INDEXED
+static void file_indexed(lv_img_cf_t cf, uint8_t bpp)
+{
+    char msg[64];
+    lv_snprintf(msg, sizeof(msg), "Read lines of a %d bit indexed image file", bpp);
+    lv_test_print(msg);
+
+    /*The palette then the rows, each row starts on a new byte*/
+    uint32_t palette_size = 1 << bpp;
+    uint32_t row_size = (IMG_W * bpp + 7) / 8;
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = cf;
+    header.w = IMG_W;
+    header.h = IMG_H;
+
+    FILE * fp = fopen(IMG_FN, "wb");
+    fwrite(&header, sizeof(header), 1, fp);
+    uint32_t i;
+    for(i = 0; i < palette_size * sizeof(lv_color32_t); i++) fputc(px_byte(i + 1000), fp);
+    for(i = 0; i < row_size * IMG_H; i++) fputc(px_byte(i), fp);
+    fclose(fp);
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "Open the file");
+
+    uint8_t buf[IMG_W * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    bool ok = true;
+    lv_coord_t y;
+    for(y = 0; y < IMG_H; y++) {
+        /*Start and end in the middle of the bytes too*/
+        lv_coord_t x = y % 9;
+        lv_coord_t len = IMG_W - x - y % 4;
+        if(lv_img_decoder_read_line(&dsc, x, y, len, buf) != LV_RES_OK) ok = false;
+        lv_coord_t j;
+        for(j = 0; j < len; j++) {
+            uint32_t bit = (x + j) * bpp;
+            uint8_t byte = px_byte(y * row_size + bit / 8);
+            uint8_t idx = (byte >> (8 - bpp - bit % 8)) & (palette_size - 1);
+            const uint8_t * px = &buf[j * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            lv_color32_t c32;
+            c32.ch.blue = px_byte(idx * 4 + 1000);
+            c32.ch.green = px_byte(idx * 4 + 1001);
+            c32.ch.red = px_byte(idx * 4 + 1002);
+            c32.ch.alpha = px_byte(idx * 4 + 1003);
+            lv_color_t c = lv_color_make(c32.ch.red, c32.ch.green, c32.ch.blue);
+            if(memcmp(px, &c, LV_IMG_PX_SIZE_ALPHA_BYTE - 1)) ok = false;
+            if(px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] != c32.ch.alpha) ok = false;
+        }
+    }
+    lv_test_assert_true(ok, "The pixels are the palette colors of the indices");
+
+    lv_img_decoder_close(&dsc);
+}
+#endif
+
+static void file_byte_order(void)
+{
+    lv_test_print("Check the RGB565 byte order of true color files");
+
+    lv_img_header_t header;
+    lv_img_decoder_dsc_t dsc;
+    img_file_write(LV_IMG_CF_TRUE_COLOR, LV_COLOR_SIZE);
+    lv_test_assert_int_eq(LV_RES_OK, lv_img_decoder_get_info("f:" IMG_FN, &header), "Open a file without order");
+
+    uint8_t order_same = LV_COLOR_16_SWAP ? LV_IMG_BYTE_ORDER_565_SWAP : LV_IMG_BYTE_ORDER_565;
+    uint8_t order_other = LV_COLOR_16_SWAP ? LV_IMG_BYTE_ORDER_565 : LV_IMG_BYTE_ORDER_565_SWAP;
+    img_file_set_order(order_same);
+    lv_test_assert_int_eq(LV_RES_OK, lv_img_decoder_get_info("f:" IMG_FN, &header), "Open a file of the same order");
+
+    /*Only RGB565 has a byte order*/
+    img_file_set_order(order_other);
+    lv_res_t res = lv_img_decoder_open(&dsc, "f:" IMG_FN, LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_COLOR_DEPTH == 16 ? LV_RES_INV : LV_RES_OK, res, "Refuse a file of the other order");
+    if(res == LV_RES_OK) lv_img_decoder_close(&dsc);
+
+    img_file_write(LV_IMG_CF_ALPHA_8BIT, 8);
+    img_file_set_order(order_other);
+    lv_test_assert_int_eq(LV_RES_OK, lv_img_decoder_get_info("f:" IMG_FN, &header), "Open an alpha only file");
+}
+
+static void img_file_write(lv_img_cf_t cf, uint32_t px_bits)
+{
+    img_file_write_size(cf, px_bits, IMG_W, IMG_H);
+}
+
+static void img_file_write_size(lv_img_cf_t cf, uint32_t px_bits, lv_coord_t w, lv_coord_t h)
+{
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = cf;
+    header.w = w;
+    header.h = h;
+
+    FILE * fp = fopen(IMG_FN, "wb");
+    fwrite(&header, sizeof(header), 1, fp);
+    uint32_t i;
+    for(i = 0; i < w * h * px_bits / 8; i++) fputc(px_byte(i), fp);
+    fclose(fp);
+}
+
+/*Set the `LV_IMG_BYTE_ORDER_...` of the image file like ImageToHolo*/
+static void img_file_set_order(uint8_t order)
+{
+    lv_img_header_t header;
+    FILE * fp = fopen(IMG_FN, "r+b");
+    if(fread(&header, sizeof(header), 1, fp) == 1) {
+        header.reserved = order;
+        fseek(fp, 0, SEEK_SET);
+        fwrite(&header, sizeof(header), 1, fp);
+    }
+    fclose(fp);
+}
+
+static uint8_t px_byte(uint32_t i)
+{
+    return (i * 7 + (i >> 8)) & 0xFF;
+}
+#endif
+
+#endif
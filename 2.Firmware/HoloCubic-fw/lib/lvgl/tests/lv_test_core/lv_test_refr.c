@@ -0,0 +1,300 @@
+/**
+ * @file lv_test_refr.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_refr.h"
+#include <string.h>
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define OBJ_CNT     36
+#define OBJ_SIZE    10
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_REFR_TILE_TRACK
+static void scattered_areas(void);
+static void test_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+static void test_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px);
+#endif
+#if LV_USE_REFR_PROF
+static void profiler(void);
+static void test_print_cb(const char * line);
+#endif
+#if LV_USE_REFR_GOV
+static void governor(void);
+static bool test_read_cb(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_REFR_TILE_TRACK
+static uint8_t flushed[LV_VER_RES_MAX][LV_HOR_RES_MAX];
+static uint32_t px_refr;
+#endif
+#if LV_USE_REFR_PROF
+static uint32_t print_cnt;
+static char print_last[160];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_refr(void)
+{
+    lv_test_print("");
+    lv_test_print("====================");
+    lv_test_print("Start lv_refr testing");
+    lv_test_print("====================");
+
+#if LV_REFR_TILE_TRACK
+    scattered_areas();
+#else
+    lv_test_print("Skip: LV_REFR_TILE_TRACK is disabled");
+#endif
+
+#if LV_USE_REFR_PROF
+    profiler();
+#else
+    lv_test_print("Skip: LV_USE_REFR_PROF is disabled");
+#endif
+
+#if LV_USE_REFR_GOV
+    governor();
+#else
+    lv_test_print("Skip: LV_USE_REFR_GOV is disabled");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_REFR_TILE_TRACK
+static void scattered_areas(void)
+{
+    lv_test_print("Refresh scattered small areas");
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_coord_t hor_res = lv_disp_get_hor_res(disp);
+    lv_coord_t ver_res = lv_disp_get_ver_res(disp);
+
+    lv_obj_t * objs[OBJ_CNT];
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT; i++) {
+        objs[i] = lv_obj_create(lv_scr_act(), NULL);
+        lv_obj_set_size(objs[i], OBJ_SIZE, OBJ_SIZE);
+        /*On a grid but not aligned to the tiles*/
+        lv_obj_set_pos(objs[i], (i % 6) * (hor_res / 6) + 3, (i / 6) * (ver_res / 7) + 5);
+    }
+    lv_refr_now(disp);
+
+    void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver.flush_cb;
+    disp->driver.flush_cb = test_flush_cb;
+    disp->driver.monitor_cb = test_monitor_cb;
+    _lv_memset_00(flushed, sizeof(flushed));
+    px_refr = 0;
+
+    /*More areas than `LV_INV_BUF_SIZE` which would redraw the whole screen without tiles*/
+    for(i = 0; i < OBJ_CNT; i++) lv_obj_invalidate(objs[i]);
+    lv_refr_now(disp);
+
+    lv_test_assert_int_gt(0, px_refr, "Something is refreshed");
+    lv_test_assert_int_lt(hor_res * ver_res / 2, px_refr, "Not the whole screen is refreshed");
+
+    bool covered = true;
+    for(i = 0; i < OBJ_CNT; i++) {
+        lv_area_t a;
+        lv_obj_get_coords(objs[i], &a);
+        lv_coord_t x;
+        lv_coord_t y;
+        for(y = a.y1; y <= a.y2; y++) {
+            for(x = a.x1; x <= a.x2; x++) {
+                if(flushed[y][x] == 0) covered = false;
+            }
+        }
+    }
+    lv_test_assert_true(covered, "All invalidated areas are flushed");
+
+    disp->driver.flush_cb = flush_cb_ori;
+    disp->driver.monitor_cb = NULL;
+    for(i = 0; i < OBJ_CNT; i++) lv_obj_del(objs[i]);
+    lv_refr_now(disp);
+}
+
+static void test_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    (void) color_p;
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            flushed[y][x] = 1;
+        }
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void test_monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    (void) disp_drv;
+    (void) time;
+
+    px_refr = px;
+}
+#endif
+
+#if LV_USE_REFR_PROF
+static void profiler(void)
+{
+    lv_test_print("Profile a refresh");
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_size(obj, 50, 40);
+    lv_refr_now(NULL);
+
+    lv_refr_prof_clear();
+    lv_test_assert_int_eq(0, lv_refr_prof_get_cnt(), "No records after clear");
+
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+
+    uint32_t cnt = lv_refr_prof_get_cnt();
+    lv_test_assert_int_gt(0, cnt, "Records are added");
+
+    uint32_t i;
+    bool obj_found = false;
+    bool render_found = false;
+    bool flush_found = false;
+    for(i = 0; i < cnt; i++) {
+        const lv_refr_prof_rec_t * rec = lv_refr_prof_get(i);
+        if(rec->type == LV_REFR_PROF_OBJ && rec->obj == obj) {
+            obj_found = true;
+            lv_test_assert_ptr_eq(lv_scr_act(), rec->scr, "Screen of the object");
+            lv_test_assert_str_eq("lv_obj", rec->obj_type, "Type of the object");
+        }
+        if(rec->type == LV_REFR_PROF_RENDER) render_found = true;
+        if(rec->type == LV_REFR_PROF_FLUSH) {
+            flush_found = true;
+            lv_test_assert_int_eq(lv_area_get_size(&rec->area), rec->px, "Flushed pixels");
+        }
+    }
+    lv_test_assert_true(obj_found, "The object is recorded");
+    lv_test_assert_true(render_found, "Rendering is recorded");
+    lv_test_assert_true(flush_found, "Flushing is recorded");
+    lv_test_assert_ptr_eq(NULL, lv_refr_prof_get(cnt), "No record after the last");
+
+    print_cnt = 0;
+    lv_refr_prof_dump(test_print_cb, LV_REFR_PROF_FMT_CSV);
+    lv_test_assert_int_eq(cnt + 1, print_cnt, "CSV: header and a line per record");
+
+    print_cnt = 0;
+    lv_refr_prof_dump(test_print_cb, LV_REFR_PROF_FMT_JSON);
+    lv_test_assert_int_eq(cnt + 2, print_cnt, "JSON: brackets and a line per record");
+    lv_test_assert_str_eq("]", print_last, "JSON: closing bracket");
+
+    /*Keep only the newest records when the buffer is full*/
+    for(i = 0; i < LV_REFR_PROF_BUF_SIZE; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+    }
+    lv_test_assert_int_eq(LV_REFR_PROF_BUF_SIZE, lv_refr_prof_get_cnt(), "Buffer is full");
+    lv_test_assert_true(lv_refr_prof_get(0)->frame <= lv_refr_prof_get(LV_REFR_PROF_BUF_SIZE - 1)->frame,
+                        "Records are ordered");
+
+    lv_obj_del(obj);
+    lv_refr_now(NULL);
+}
+
+static void test_print_cb(const char * line)
+{
+    print_cnt++;
+    strncpy(print_last, line, sizeof(print_last) - 1);
+}
+#endif
+
+#if LV_USE_REFR_GOV
+static void governor(void)
+{
+    lv_test_print("Adapt the refresh period");
+
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t fps_ori = lv_refr_gov_get_fps(disp);
+    lv_obj_t * obj = lv_obj_create(lv_scr_act(), NULL);
+
+    lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.read_cb = test_read_cb;
+    lv_indev_t * indev = lv_indev_drv_register(&indev_drv);
+    lv_refr_now(disp);
+
+    lv_refr_gov_set_fps(disp, 50);
+    lv_test_assert_int_eq(50, lv_refr_gov_get_fps(disp), "Target FPS");
+    lv_test_assert_int_eq(20, disp->refr_task->period, "Refresh period of the target FPS");
+
+    lv_refr_gov_stats_t stats;
+    lv_refr_gov_get_stats(disp, &stats);
+    lv_obj_invalidate(obj);
+    lv_refr_now(disp);
+    lv_refr_gov_get_stats(disp, &stats);
+    lv_test_assert_int_eq(1, stats.frames, "A frame is counted");
+    lv_test_assert_int_eq(50, stats.fps_target, "Target FPS in the stats");
+    lv_test_assert_int_eq(20, stats.period, "Refresh period in the stats");
+
+    lv_refr_gov_get_stats(disp, &stats);
+    lv_test_assert_int_eq(0, stats.frames, "The stats are reset");
+
+    /*Nothing happens for a while*/
+    lv_tick_inc(LV_REFR_GOV_IDLE_TIME);
+    lv_refr_now(disp);
+    lv_test_assert_int_gt(20, disp->refr_task->period, "Slow down when idle");
+
+    uint32_t i;
+    for(i = 0; i < 16; i++) lv_refr_now(disp);
+    lv_test_assert_int_eq(LV_REFR_GOV_IDLE_PERIOD, disp->refr_task->period, "Slow down to the idle period");
+    lv_test_assert_int_eq(LV_INDEV_DEF_READ_PERIOD, indev->driver.read_task->period,
+                          "Keep reading the input devices when idle");
+
+    lv_obj_invalidate(obj);
+    lv_test_assert_int_eq(20, disp->refr_task->period, "Speed up when something is invalidated");
+    lv_refr_now(disp);
+    lv_test_assert_int_eq(20, disp->refr_task->period, "Keep the target FPS while refreshing");
+
+    lv_indev_enable(indev, false);
+    lv_obj_del(obj);
+    lv_refr_now(disp);
+    lv_refr_gov_set_fps(disp, fps_ori);
+}
+
+static bool test_read_cb(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
+{
+    (void)indev_drv;
+    data->state = LV_INDEV_STATE_REL;
+    return false;
+}
+#endif
+
+#endif
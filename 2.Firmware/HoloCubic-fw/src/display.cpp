@@ -1,5 +1,7 @@
 #include "display.h"
+#include "lv_port_gpu.h"
 #include <TFT_eSPI.h>
+#include <atomic>
 
 /*
 TFT pins should be set in path/to/Arduino/libraries/TFT_eSPI/User_Setups/Setup24_ST7789.h
@@ -7,7 +9,39 @@ TFT pins should be set in path/to/Arduino/libraries/TFT_eSPI/User_Setups/Setup24
 TFT_eSPI tft = TFT_eSPI();
 
 static lv_disp_buf_t disp_buf;
-static lv_color_t buf[LV_HOR_RES_MAX * 10];
+#if LCD_FLUSH_MODE == LCD_FLUSH_DMA
+/* Static DRAM is DMA capable on the ESP32 */
+static lv_color_t buf1[LV_HOR_RES_MAX * LCD_BUF_LINES];
+static lv_color_t buf2[LV_HOR_RES_MAX * LCD_BUF_LINES];
+static lv_disp_drv_t* volatile flushing_drv = NULL;
+#elif LCD_FLUSH_MODE == LCD_FLUSH_TASK
+struct Stripe
+{
+	lv_area_t area;
+};
+
+/*
+ * Single producer (my_disp_flush on the LVGL core), single consumer (flush task).
+ * Stripe buffers are used strictly in order: LVGL renders into slot `head`,
+ * the flush task pushes slot `tail`, a slot is free again once `tail` passed it.
+ */
+static lv_color_t stripe_bufs[LCD_FLUSH_QUEUE_LEN][LV_HOR_RES_MAX * LCD_BUF_LINES];
+static Stripe stripes[LCD_FLUSH_QUEUE_LEN];
+static std::atomic<uint32_t> stripe_head(0);
+static std::atomic<uint32_t> stripe_tail(0);
+
+static TaskHandle_t flush_task = NULL;
+/* Set only while LVGL waits for a free slot */
+static std::atomic<TaskHandle_t> render_task(NULL);
+
+static std::atomic<uint32_t> stat_stall_us(0);
+static std::atomic<uint32_t> stat_busy_us(0);
+static std::atomic<uint32_t> stat_stripes(0);
+static std::atomic<uint32_t> stat_depth_max(0);
+static uint32_t stat_last_ms = 0;
+#else
+static lv_color_t buf[LV_HOR_RES_MAX * LCD_BUF_LINES];
+#endif
 
 
 void my_print(lv_log_level_t level, const char* file, uint32_t line, const char* fun, const char* dsc)
@@ -17,6 +51,90 @@ void my_print(lv_log_level_t level, const char* file, uint32_t line, const char*
 }
 
 
+#if LCD_FLUSH_MODE == LCD_FLUSH_DMA
+/* Runs in the SPI interrupt once the stripe has left the buffer */
+void IRAM_ATTR my_dma_done()
+{
+	if (flushing_drv)
+	{
+		lv_disp_drv_t* disp = flushing_drv;
+		flushing_drv = NULL;
+		lv_disp_flush_ready(disp);
+	}
+}
+
+void my_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p)
+{
+	uint32_t w = (area->x2 - area->x1 + 1);
+	uint32_t h = (area->y2 - area->y1 + 1);
+
+	/* LVGL keeps drawing into the other buffer until my_dma_done() releases this one */
+	flushing_drv = disp;
+	tft.pushImageDMA(area->x1, area->y1, w, h, &color_p->full);
+}
+#elif LCD_FLUSH_MODE == LCD_FLUSH_TASK
+/* Drains the stripe queue on LCD_FLUSH_TASK_CORE */
+void flush_task_loop(void* param)
+{
+	for (;;)
+	{
+		uint32_t tail = stripe_tail.load(std::memory_order_relaxed);
+		while (tail == stripe_head.load(std::memory_order_acquire))
+		{
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		}
+
+		uint32_t slot = tail % LCD_FLUSH_QUEUE_LEN;
+		const lv_area_t* area = &stripes[slot].area;
+		uint32_t w = (area->x2 - area->x1 + 1);
+		uint32_t h = (area->y2 - area->y1 + 1);
+
+		uint32_t start = micros();
+		tft.startWrite();
+		tft.setAddrWindow(area->x1, area->y1, w, h);
+		tft.pushColors(&stripe_bufs[slot][0].full, w * h, LCD_SWAP_BYTES);
+		tft.endWrite();
+		stat_busy_us += micros() - start;
+		stat_stripes++;
+
+		/* Store, then look for a waiter: my_disp_flush() announces itself, then looks at the tail */
+		stripe_tail.store(tail + 1);
+		TaskHandle_t waiting = render_task.load();
+		if (waiting) xTaskNotifyGive(waiting);
+	}
+}
+
+void my_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p)
+{
+	uint32_t head = stripe_head.load(std::memory_order_relaxed);
+
+	/* Hand the rendered stripe to the flush task */
+	lv_area_copy(&stripes[head % LCD_FLUSH_QUEUE_LEN].area, area);
+	stripe_head.store(++head, std::memory_order_release);
+	xTaskNotifyGive(flush_task);
+
+	uint32_t depth = head - stripe_tail.load(std::memory_order_acquire);
+	if (depth > stat_depth_max) stat_depth_max = depth;
+
+	/* Wait until the next slot is no longer queued or being pushed */
+	if (depth >= LCD_FLUSH_QUEUE_LEN)
+	{
+		uint32_t start = micros();
+		render_task.store(xTaskGetCurrentTaskHandle());
+		while (head - stripe_tail.load() >= LCD_FLUSH_QUEUE_LEN)
+		{
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		}
+		render_task.store(NULL);
+		stat_stall_us += micros() - start;
+	}
+
+	/* Keep rendering into the next slot of the ring */
+	disp->buffer->buf1 = stripe_bufs[head % LCD_FLUSH_QUEUE_LEN];
+	disp->buffer->buf_act = disp->buffer->buf1;
+	lv_disp_flush_ready(disp);
+}
+#else
 void my_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p)
 {
 	uint32_t w = (area->x2 - area->x1 + 1);
@@ -24,11 +142,12 @@ void my_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color
 
 	tft.startWrite();
 	tft.setAddrWindow(area->x1, area->y1, w, h);
-	tft.pushColors(&color_p->full, w * h, true);
+	tft.pushColors(&color_p->full, w * h, LCD_SWAP_BYTES);
 	tft.endWrite();
 
 	lv_disp_flush_ready(disp);
 }
+#endif
 
 
 void Display::init()
@@ -43,7 +162,23 @@ void Display::init()
 	tft.begin(); /* TFT init */
 	tft.setRotation(4); /* mirror */
 
-	lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * 10);
+#if LCD_FLUSH_MODE == LCD_FLUSH_DMA
+	tft.setSwapBytes(LCD_SWAP_BYTES); /* if needed swapped in place inside the draw buffer */
+	tft.initDMA();
+	tft.setDMACallback(my_dma_done);
+	tft.startWrite(); /* keep CS low, DMA transfers run back to back */
+
+	lv_disp_buf_init(&disp_buf, buf1, buf2, LV_HOR_RES_MAX * LCD_BUF_LINES);
+#elif LCD_FLUSH_MODE == LCD_FLUSH_TASK
+	/* Only one draw buffer for LVGL, my_disp_flush() moves it along the ring */
+	lv_disp_buf_init(&disp_buf, stripe_bufs[0], NULL, LV_HOR_RES_MAX * LCD_BUF_LINES);
+
+	stat_last_ms = millis();
+	xTaskCreatePinnedToCore(flush_task_loop, "lv_flush", LCD_FLUSH_TASK_STACK, NULL,
+		LCD_FLUSH_TASK_PRIO, &flush_task, LCD_FLUSH_TASK_CORE);
+#else
+	lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * LCD_BUF_LINES);
+#endif
 
 	/*Initialize the display*/
 	lv_disp_drv_t disp_drv;
@@ -52,12 +187,37 @@ void Display::init()
 	disp_drv.ver_res = 240;
 	disp_drv.flush_cb = my_disp_flush;
 	disp_drv.buffer = &disp_buf;
+#if LCD_GPU_WORKER
+	lv_port_gpu_init(&disp_drv); /* large fills and blends shared with core 0 */
+#endif
 	lv_disp_drv_register(&disp_drv);
 }
 
-void Display::routine()
+uint32_t Display::routine()
+{
+	return lv_task_handler();
+}
+
+void Display::getFlushStats(FlushStats* stats)
 {
-	lv_task_handler();
+	memset(stats, 0, sizeof(FlushStats));
+
+#if LCD_FLUSH_MODE == LCD_FLUSH_TASK
+	uint32_t now = millis();
+	stats->period_ms = now - stat_last_ms;
+	stat_last_ms = now;
+
+	stats->queue_depth = stripe_head.load() - stripe_tail.load();
+	stats->queue_depth_max = stat_depth_max.exchange(0);
+	stats->stall_us = stat_stall_us.exchange(0);
+	stats->busy_us = stat_busy_us.exchange(0);
+	stats->stripes = stat_stripes.exchange(0);
+	stats->stack_free = uxTaskGetStackHighWaterMark(flush_task);
+	if (stats->period_ms)
+	{
+		stats->stripes_per_sec = stats->stripes * 1000.0f / stats->period_ms;
+	}
+#endif
 }
 
 void Display::setBackLight(float duty)
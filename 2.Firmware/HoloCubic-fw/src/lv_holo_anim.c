@@ -0,0 +1,391 @@
+/**
+ * @file lv_holo_anim.c
+ * Image decoder, RLE and delta frames of the animation container (see lv_holo_anim.h)
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_anim.h"
+#include <string.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+	lv_fs_file_t file;
+	lv_holo_anim_entry_t entry;
+	uint32_t px_size;
+	lv_holo_anim_rle_file_t rf;	/* of RLE frames */
+} anim_dec_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+static bool src_parse(const void* src, char* path, uint32_t* index);
+static bool anim_open(lv_fs_file_t* file, const char* path, lv_holo_anim_header_t* header);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_holo_anim_decoder_init(void)
+{
+	lv_img_decoder_t* decoder = lv_img_decoder_create();
+	lv_img_decoder_set_info_cb(decoder, decoder_info);
+	lv_img_decoder_set_open_cb(decoder, decoder_open);
+	lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+	lv_img_decoder_set_close_cb(decoder, decoder_close);
+}
+
+bool lv_holo_anim_header_check(const lv_holo_anim_header_t* header)
+{
+	if (memcmp(header->magic, LV_HOLO_ANIM_MAGIC, 4) != 0) return false;
+	if (header->version != LV_HOLO_ANIM_VERSION) return false;
+	if (header->rle_unit == 0 || header->rle_unit > 4) return false;
+	if (!lv_img_header_byte_order_ok(&header->header)) return false;
+
+	return header->header.cf == LV_IMG_CF_TRUE_COLOR ||
+		header->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
+		header->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+}
+
+uint32_t lv_holo_anim_frame_size(const lv_holo_anim_header_t* header)
+{
+	return lv_img_buf_get_img_size(header->header.w, header->header.h, header->header.cf);
+}
+
+uint32_t lv_holo_anim_delta_bitmap_size(const lv_holo_anim_header_t* header)
+{
+	if (header->tile_size == 0) return 0;
+
+	uint32_t tiles_x = (header->header.w + header->tile_size - 1) / header->tile_size;
+	uint32_t tiles_y = (header->header.h + header->tile_size - 1) / header->tile_size;
+	return (tiles_x * tiles_y + 7) / 8;
+}
+
+bool lv_holo_anim_frame_apply(const lv_holo_anim_header_t* header, uint32_t size, const uint8_t* data,
+	uint8_t* frame, lv_obj_t* img)
+{
+	bool rle = size & LV_HOLO_ANIM_RLE;
+	uint32_t in_len = size & LV_HOLO_ANIM_SIZE_MASK;
+	uint32_t frame_size = lv_holo_anim_frame_size(header);
+	uint32_t used;
+	lv_holo_anim_rle_t rle_state;
+	lv_holo_anim_rle_init(&rle_state, header->rle_unit);
+
+	if ((size & LV_HOLO_ANIM_DELTA) == 0)
+	{
+		if (rle)
+		{
+			if (lv_holo_anim_rle_decode(&rle_state, data, in_len, &used, frame, frame_size) != frame_size) return false;
+		}
+		else
+		{
+			if (in_len != frame_size) return false;
+			memcpy(frame, data, frame_size);
+		}
+		lv_obj_invalidate(img);
+		return true;
+	}
+
+	uint32_t bitmap_size = lv_holo_anim_delta_bitmap_size(header);
+	if (bitmap_size == 0 || in_len < bitmap_size) return false;
+
+	const uint8_t* bitmap = data;
+	const uint8_t* in = data + bitmap_size;
+	in_len -= bitmap_size;
+
+	lv_coord_t w = header->header.w;
+	lv_coord_t h = header->header.h;
+	lv_coord_t tile = header->tile_size;
+	uint32_t px_size = lv_img_cf_get_px_size(header->header.cf) >> 3;
+	uint32_t tile_id = 0;
+	lv_coord_t ty;
+	for (ty = 0; ty < h; ty += tile)
+	{
+		lv_coord_t th = LV_MATH_MIN(tile, h - ty);
+		lv_coord_t x1 = -1;
+		lv_coord_t x2 = -1;
+		lv_coord_t tx;
+		for (tx = 0; tx < w; tx += tile, tile_id++)
+		{
+			if ((bitmap[tile_id >> 3] & (1 << (tile_id & 7))) == 0) continue;
+
+			lv_coord_t tw = LV_MATH_MIN(tile, w - tx);
+			uint32_t line_len = tw * px_size;
+			lv_coord_t y;
+			for (y = ty; y < ty + th; y++)
+			{
+				uint8_t* dst = &frame[((uint32_t)y * w + tx) * px_size];
+				if (rle)
+				{
+					if (lv_holo_anim_rle_decode(&rle_state, in, in_len, &used, dst, line_len) != line_len) return false;
+				}
+				else
+				{
+					if (in_len < line_len) return false;
+					memcpy(dst, in, line_len);
+					used = line_len;
+				}
+				in += used;
+				in_len -= used;
+			}
+
+			if (x1 < 0) x1 = tx;
+			x2 = tx + tw - 1;
+		}
+
+		/* One area per row of tiles, a display can collect only `LV_INV_BUF_SIZE` areas */
+		if (x1 >= 0)
+		{
+			lv_area_t area;
+			area.x1 = img->coords.x1 + x1;
+			area.y1 = img->coords.y1 + ty;
+			area.x2 = img->coords.x1 + x2;
+			area.y2 = img->coords.y1 + ty + th - 1;
+			lv_obj_invalidate_area(img, &area);
+		}
+	}
+	return true;
+}
+
+void lv_holo_anim_rle_init(lv_holo_anim_rle_t* rle, uint8_t unit)
+{
+	memset(rle, 0, sizeof(lv_holo_anim_rle_t));
+	rle->unit = unit;
+	rle->run_px_got = unit;
+}
+
+uint32_t lv_holo_anim_rle_decode(lv_holo_anim_rle_t* rle, const uint8_t* in, uint32_t in_len, uint32_t* in_used,
+	uint8_t* out, uint32_t out_len)
+{
+	uint32_t in_i = 0;
+	uint32_t out_i = 0;
+
+	while (out_i < out_len)
+	{
+		if (rle->lit_left)
+		{
+			uint32_t n = LV_MATH_MIN(rle->lit_left, LV_MATH_MIN(in_len - in_i, out_len - out_i));
+			if (n == 0) break;
+			memcpy(&out[out_i], &in[in_i], n);
+			in_i += n;
+			out_i += n;
+			rle->lit_left -= n;
+		}
+		else if (rle->run_px_got < rle->unit)
+		{
+			if (in_i == in_len) break;
+			rle->run_px[rle->run_px_got++] = in[in_i++];
+		}
+		else if (rle->run_left)
+		{
+			uint32_t n = LV_MATH_MIN(rle->run_left, out_len - out_i);
+			uint8_t pos = rle->run_pos;
+			rle->run_left -= n;
+			while (n--)
+			{
+				out[out_i++] = rle->run_px[pos];
+				if (++pos == rle->unit) pos = 0;
+			}
+			rle->run_pos = pos;
+		}
+		else
+		{
+			if (in_i == in_len) break;
+			uint8_t c = in[in_i++];
+			if (c & 0x80)
+			{
+				rle->run_left = ((c & 0x7F) + 1) * rle->unit;
+				rle->run_px_got = 0;
+				rle->run_pos = 0;
+			}
+			else
+			{
+				rle->lit_left = (c + 1) * rle->unit;
+			}
+		}
+	}
+
+	*in_used = in_i;
+	return out_i;
+}
+
+bool lv_holo_anim_rle_file_start(lv_holo_anim_rle_file_t* rf, lv_fs_file_t* file, uint32_t offset,
+	uint8_t unit, uint32_t decoded)
+{
+	rf->file = file;
+	lv_holo_anim_rle_init(&rf->rle, unit);
+	rf->decoded = decoded;
+	rf->in_len = 0;
+	rf->in_pos = 0;
+	return lv_fs_seek(file, offset) == LV_FS_RES_OK;
+}
+
+bool lv_holo_anim_rle_file_read(lv_holo_anim_rle_file_t* rf, uint8_t* buf, uint32_t len)
+{
+	uint32_t out = 0;
+	while (out < len)
+	{
+		if (rf->in_pos == rf->in_len)
+		{
+			if (lv_fs_read(rf->file, rf->in_buf, sizeof(rf->in_buf), &rf->in_len) != LV_FS_RES_OK) return false;
+			if (rf->in_len == 0) return false;
+			rf->in_pos = 0;
+		}
+
+		uint32_t used;
+		out += lv_holo_anim_rle_decode(&rf->rle, &rf->in_buf[rf->in_pos], rf->in_len - rf->in_pos, &used,
+			&buf[out], len - out);
+		rf->in_pos += used;
+	}
+
+	rf->decoded += len;
+	return true;
+}
+
+bool lv_holo_anim_rle_file_skip_to(lv_holo_anim_rle_file_t* rf, uint32_t pos)
+{
+	uint8_t skip_buf[64];
+	while (rf->decoded < pos)
+	{
+		if (!lv_holo_anim_rle_file_read(rf, skip_buf, LV_MATH_MIN(sizeof(skip_buf), pos - rf->decoded))) return false;
+	}
+	return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+	char path[LV_HOLO_ANIM_PATH_MAX];
+	uint32_t index;
+	if (!src_parse(src, path, &index)) return LV_RES_INV;
+
+	lv_fs_file_t file;
+	lv_holo_anim_header_t anim_header;
+	if (!anim_open(&file, path, &anim_header)) return LV_RES_INV;
+	lv_fs_close(&file);
+
+	if (index >= anim_header.frame_cnt) return LV_RES_INV;
+
+	*header = anim_header.header;
+	return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	char path[LV_HOLO_ANIM_PATH_MAX];
+	uint32_t index;
+	if (!src_parse(dsc->src, path, &index)) return LV_RES_INV;
+
+	anim_dec_t* dec = lv_mem_alloc(sizeof(anim_dec_t));
+	LV_ASSERT_MEM(dec);
+	if (dec == NULL) return LV_RES_INV;
+
+	/* Only the offset table entry of this frame is read */
+	lv_holo_anim_header_t header;
+	uint32_t rn;
+	if (!anim_open(&dec->file, path, &header))
+	{
+		lv_mem_free(dec);
+		return LV_RES_INV;
+	}
+	if (index >= header.frame_cnt ||
+		lv_fs_seek(&dec->file, sizeof(header) + index * sizeof(lv_holo_anim_entry_t)) != LV_FS_RES_OK ||
+		lv_fs_read(&dec->file, &dec->entry, sizeof(dec->entry), &rn) != LV_FS_RES_OK || rn != sizeof(dec->entry) ||
+		!lv_holo_anim_rle_file_start(&dec->rf, &dec->file, dec->entry.offset, header.rle_unit, 0) ||
+		(dec->entry.size & LV_HOLO_ANIM_DELTA))
+	{
+		lv_fs_close(&dec->file);
+		lv_mem_free(dec);
+		return LV_RES_INV;
+	}
+
+	dec->px_size = lv_img_cf_get_px_size(header.header.cf) >> 3;
+
+	dsc->header = header.header;
+	dsc->img_data = NULL;	/* read line by line */
+	dsc->user_data = dec;
+	dsc->mem_size = sizeof(anim_dec_t) + dec->file.drv->file_size + dec->file.drv->file_extra_size;	/* for the image cache's budget */
+	return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf)
+{
+	anim_dec_t* dec = dsc->user_data;
+	uint32_t pos = ((uint32_t)y * dsc->header.w + x) * dec->px_size;
+	uint32_t btr = len * dec->px_size;
+
+	if ((dec->entry.size & LV_HOLO_ANIM_RLE) == 0)
+	{
+		uint32_t rn;
+		if (lv_fs_seek(&dec->file, dec->entry.offset + pos) != LV_FS_RES_OK) return LV_RES_INV;
+		if (lv_fs_read(&dec->file, buf, btr, &rn) != LV_FS_RES_OK || rn != btr) return LV_RES_INV;
+		return LV_RES_OK;
+	}
+
+	/* RLE frames can only be decoded from the beginning, lines are usually read downwards */
+	if (pos < dec->rf.decoded &&
+		!lv_holo_anim_rle_file_start(&dec->rf, &dec->file, dec->entry.offset, dec->rf.rle.unit, 0)) return LV_RES_INV;
+	if (!lv_holo_anim_rle_file_skip_to(&dec->rf, pos)) return LV_RES_INV;
+	return lv_holo_anim_rle_file_read(&dec->rf, buf, btr) ? LV_RES_OK : LV_RES_INV;
+}
+
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	anim_dec_t* dec = dsc->user_data;
+	if (dec == NULL) return;
+
+	lv_fs_close(&dec->file);
+	lv_mem_free(dec);
+	dsc->user_data = NULL;
+}
+
+/* "S:/a/scene.hanim#12" -> "S:/a/scene.hanim" and 12 */
+static bool src_parse(const void* src, char* path, uint32_t* index)
+{
+	if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return false;
+
+	const char* hash = strrchr(src, '#');
+	uint32_t path_len = hash ? (uint32_t)(hash - (const char*)src) : strlen(src);
+	uint32_t ext_len = strlen(LV_HOLO_ANIM_EXT);
+	if (path_len >= LV_HOLO_ANIM_PATH_MAX || path_len < ext_len) return false;
+	if (strncmp((const char*)src + path_len - ext_len, LV_HOLO_ANIM_EXT, ext_len) != 0) return false;
+
+	memcpy(path, src, path_len);
+	path[path_len] = '\0';
+	*index = hash ? strtoul(hash + 1, NULL, 10) : 0;
+	return true;
+}
+
+static bool anim_open(lv_fs_file_t* file, const char* path, lv_holo_anim_header_t* header)
+{
+	uint32_t rn;
+	if (lv_fs_open(file, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return false;
+
+	if (lv_fs_read(file, header, sizeof(lv_holo_anim_header_t), &rn) != LV_FS_RES_OK ||
+		rn != sizeof(lv_holo_anim_header_t) || !lv_holo_anim_header_check(header))
+	{
+		LV_LOG_WARN("lv_holo_anim: not a supported animation file");
+		lv_fs_close(file);
+		return false;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+/**
+ * @file lv_holo_img.c
+ * Image decoder of the compressed image files (see lv_holo_img.h)
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_img.h"
+#include "lv_holo_anim.h"
+#include <string.h>
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+	lv_fs_file_t file;
+	uint32_t* marks;			/* restart markers from the file */
+	uint32_t block_size;		/* decompressed bytes between two markers */
+	uint32_t px_size;
+	lv_holo_anim_rle_file_t rf;
+} img_dec_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+static bool src_check(const void* src);
+static bool img_open(lv_fs_file_t* file, const char* path, lv_holo_img_header_t* header);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_holo_img_decoder_init(void)
+{
+	lv_img_decoder_t* decoder = lv_img_decoder_create();
+	lv_img_decoder_set_info_cb(decoder, decoder_info);
+	lv_img_decoder_set_open_cb(decoder, decoder_open);
+	lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+	lv_img_decoder_set_close_cb(decoder, decoder_close);
+}
+
+bool lv_holo_img_header_check(const lv_holo_img_header_t* header)
+{
+	if (memcmp(header->magic, LV_HOLO_IMG_MAGIC, 4) != 0) return false;
+	if (header->version != LV_HOLO_IMG_VERSION) return false;
+	if (header->rle_unit == 0 || header->rle_unit > 4) return false;
+	if (header->restart_rows == 0) return false;
+	if (!lv_img_header_byte_order_ok(&header->header)) return false;
+
+	return header->header.cf == LV_IMG_CF_TRUE_COLOR ||
+		header->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
+		header->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+}
+
+uint32_t lv_holo_img_block_cnt(const lv_holo_img_header_t* header)
+{
+	return (header->header.h + header->restart_rows - 1) / header->restart_rows;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+	if (!src_check(src)) return LV_RES_INV;
+
+	lv_fs_file_t file;
+	lv_holo_img_header_t img_header;
+	if (!img_open(&file, src, &img_header)) return LV_RES_INV;
+	lv_fs_close(&file);
+
+	*header = img_header.header;
+	return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	if (!src_check(dsc->src)) return LV_RES_INV;
+
+	img_dec_t* dec = lv_mem_alloc(sizeof(img_dec_t));
+	LV_ASSERT_MEM(dec);
+	if (dec == NULL) return LV_RES_INV;
+
+	lv_holo_img_header_t header;
+	if (!img_open(&dec->file, dsc->src, &header))
+	{
+		lv_mem_free(dec);
+		return LV_RES_INV;
+	}
+
+	/* The markers are read at once, the data follows them */
+	uint32_t marks_size = lv_holo_img_block_cnt(&header) * sizeof(uint32_t);
+	uint32_t rn;
+	dec->marks = lv_mem_alloc(marks_size);
+	LV_ASSERT_MEM(dec->marks);
+	if (dec->marks == NULL ||
+		lv_fs_read(&dec->file, dec->marks, marks_size, &rn) != LV_FS_RES_OK || rn != marks_size ||
+		!lv_holo_anim_rle_file_start(&dec->rf, &dec->file, dec->marks[0], header.rle_unit, 0))
+	{
+		if (dec->marks) lv_mem_free(dec->marks);
+		lv_fs_close(&dec->file);
+		lv_mem_free(dec);
+		return LV_RES_INV;
+	}
+
+	dec->px_size = lv_img_cf_get_px_size(header.header.cf) >> 3;
+	dec->block_size = (uint32_t)header.restart_rows * header.header.w * dec->px_size;
+
+	dsc->header = header.header;
+	dsc->img_data = NULL;	/* read line by line */
+	dsc->user_data = dec;
+	dsc->mem_size = sizeof(img_dec_t) + marks_size + dec->file.drv->file_size +
+		dec->file.drv->file_extra_size;	/* for the image cache's budget */
+	return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf)
+{
+	img_dec_t* dec = dsc->user_data;
+	uint32_t pos = ((uint32_t)y * dsc->header.w + x) * dec->px_size;
+
+	/* Lines are usually read downwards and continue the decoding.
+	 * Going back or over a marker restarts at the marker before `pos` */
+	uint32_t block = pos / dec->block_size;
+	if (pos < dec->rf.decoded || block > dec->rf.decoded / dec->block_size)
+	{
+		if (!lv_holo_anim_rle_file_start(&dec->rf, &dec->file, dec->marks[block], dec->rf.rle.unit,
+			block * dec->block_size)) return LV_RES_INV;
+	}
+
+	if (!lv_holo_anim_rle_file_skip_to(&dec->rf, pos)) return LV_RES_INV;
+	return lv_holo_anim_rle_file_read(&dec->rf, buf, len * dec->px_size) ? LV_RES_OK : LV_RES_INV;
+}
+
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	img_dec_t* dec = dsc->user_data;
+	if (dec == NULL) return;
+
+	lv_fs_close(&dec->file);
+	lv_mem_free(dec->marks);
+	lv_mem_free(dec);
+	dsc->user_data = NULL;
+}
+
+static bool src_check(const void* src)
+{
+	if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return false;
+
+	uint32_t path_len = strlen(src);
+	uint32_t ext_len = strlen(LV_HOLO_IMG_EXT);
+	if (path_len >= LV_HOLO_ANIM_PATH_MAX || path_len < ext_len) return false;
+	return strcmp((const char*)src + path_len - ext_len, LV_HOLO_IMG_EXT) == 0;
+}
+
+static bool img_open(lv_fs_file_t* file, const char* path, lv_holo_img_header_t* header)
+{
+	uint32_t rn;
+	if (lv_fs_open(file, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return false;
+
+	if (lv_fs_read(file, header, sizeof(lv_holo_img_header_t), &rn) != LV_FS_RES_OK ||
+		rn != sizeof(lv_holo_img_header_t) || !lv_holo_img_header_check(header))
+	{
+		LV_LOG_WARN("lv_holo_img: not a supported image file");
+		lv_fs_close(file);
+		return false;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,493 @@
+/**
+ * @file lv_holo_io.c
+ * Storage service. The requests are in a fixed pool, their states are handed over with atomics:
+ * FREE -> QUEUED by the LVGL core, QUEUED -> RUNNING -> DONE by the worker, DONE -> FREE by the LVGL core
+ * after the callback. lv_async_call() is not thread safe, so the worker doesn't call it: an lv_task
+ * of the LVGL core calls the callbacks of the DONE requests, it only runs while requests are pending.
+ * The worker uses FATFS directly (LVGL's lv_fs and lv_mem are not thread safe), on a PC build stdio.
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_io.h"
+#include "lv_holo_meta.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "ff.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum
+{
+	REQ_FREE,
+	REQ_QUEUED,
+	REQ_RUNNING,
+	REQ_DONE,
+} req_state_t;
+
+typedef struct
+{
+	uint32_t state;				/* req_state_t */
+	uint32_t seq;				/* order of the requests, the oldest of the highest priority is done first */
+	lv_holo_io_prio_t prio;
+	lv_holo_io_op_t op;
+	bool ok;
+	bool own_buf;				/* `buf` is freed after the callback */
+	char path[LV_HOLO_IO_PATH_MAX];
+	uint32_t pos;
+	uint8_t* buf;
+	uint32_t len;				/* requested, then done */
+	uint32_t size;
+	uint32_t queued_us;
+	lv_holo_io_cb_t cb;
+	void* user_data;
+} req_t;
+
+#if defined(ESP_PLATFORM)
+typedef FIL file_t;
+#else
+typedef FILE* file_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static req_t* req_queue(const char* path, lv_holo_io_op_t op, lv_holo_io_prio_t prio, lv_holo_io_cb_t cb,
+	void* user_data);
+static void done_task_cb(lv_task_t* task);
+static bool req_run(req_t* req);
+static uint32_t time_us(void);
+
+static bool file_open(file_t* f, const char* path, lv_holo_io_op_t op);
+static uint32_t file_size(file_t* f);
+static bool file_seek(file_t* f, uint32_t pos);
+static uint32_t file_read(file_t* f, void* buf, uint32_t len);
+static uint32_t file_write(file_t* f, const void* buf, uint32_t len);
+static void file_close(file_t* f);
+
+static void worker_loop(void);
+static void worker_start(void);
+static void worker_sleep(void);
+static void worker_wake(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static req_t reqs[LV_HOLO_IO_REQ_MAX];
+static uint32_t req_pending;	/* LVGL core only */
+static uint32_t seq_next;
+static lv_task_t* done_task;
+static char file_root[LV_HOLO_IO_PATH_MAX];
+static uint32_t worker_sleeping;
+
+static uint32_t stat_done;
+static uint32_t stat_failed;
+static uint32_t stat_bytes_read;
+static uint32_t stat_bytes_written;
+static uint32_t stat_busy_us;
+static uint32_t stat_wait_us_max[_LV_HOLO_IO_PRIO_NUM];
+static uint32_t stat_full;
+
+#if defined(ESP_PLATFORM)
+static TaskHandle_t worker_task;
+#else
+static pthread_t worker_thread;
+static pthread_mutex_t worker_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t worker_cond = PTHREAD_COND_INITIALIZER;
+static bool worker_woken;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_holo_io_init(const char* root)
+{
+	if (done_task) return;
+
+	strncpy(file_root, root, LV_HOLO_IO_PATH_MAX - 1);
+	file_root[LV_HOLO_IO_PATH_MAX - 1] = '\0';
+
+	done_task = lv_task_create(done_task_cb, LV_HOLO_IO_POLL_MS, LV_TASK_PRIO_OFF, NULL);
+	worker_start();
+}
+
+bool lv_holo_io_read(const char* path, uint32_t pos, void* buf, uint32_t len, lv_holo_io_prio_t prio,
+	lv_holo_io_cb_t cb, void* user_data)
+{
+	req_t* req = req_queue(path, LV_HOLO_IO_READ, prio, cb, user_data);
+	if (req == NULL) return false;
+
+	req->pos = pos;
+	req->buf = buf;
+	req->len = len;
+	__atomic_store_n(&req->state, REQ_QUEUED, __ATOMIC_RELEASE);
+	worker_wake();
+	return true;
+}
+
+bool lv_holo_io_write(const char* path, lv_holo_io_op_t op, const void* data, uint32_t len,
+	lv_holo_io_prio_t prio, lv_holo_io_cb_t cb, void* user_data)
+{
+	if (op != LV_HOLO_IO_WRITE && op != LV_HOLO_IO_APPEND) return false;
+
+	req_t* req = req_queue(path, op, prio, cb, user_data);
+	if (req == NULL) return false;
+
+	/* The caller's data may be on the stack */
+	req->buf = malloc(LV_MATH_MAX(len, 1));
+	if (req->buf == NULL)
+	{
+		/* Still FREE, the lv_task stops itself if nothing else is pending */
+		req_pending--;
+		return false;
+	}
+	memcpy(req->buf, data, len);
+	req->own_buf = true;
+	req->len = len;
+	__atomic_store_n(&req->state, REQ_QUEUED, __ATOMIC_RELEASE);
+	worker_wake();
+	return true;
+}
+
+bool lv_holo_io_stat(const char* path, lv_holo_io_prio_t prio, lv_holo_io_cb_t cb, void* user_data)
+{
+	req_t* req = req_queue(path, LV_HOLO_IO_STAT, prio, cb, user_data);
+	if (req == NULL) return false;
+
+	__atomic_store_n(&req->state, REQ_QUEUED, __ATOMIC_RELEASE);
+	worker_wake();
+	return true;
+}
+
+uint32_t lv_holo_io_pending(void)
+{
+	return req_pending;
+}
+
+void lv_holo_io_get_stats(lv_holo_io_stats_t* stats)
+{
+	stats->done = stat_done;
+	stats->failed = stat_failed;
+	stats->bytes_read = stat_bytes_read;
+	stats->bytes_written = stat_bytes_written;
+	stats->busy_us = __atomic_exchange_n(&stat_busy_us, 0, __ATOMIC_RELAXED);
+	memcpy(stats->wait_us_max, stat_wait_us_max, sizeof(stat_wait_us_max));
+	stats->full = stat_full;
+
+	stat_done = 0;
+	stat_failed = 0;
+	stat_bytes_read = 0;
+	stat_bytes_written = 0;
+	memset(stat_wait_us_max, 0, sizeof(stat_wait_us_max));
+	stat_full = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Take a free request, the caller fills the rest and queues it.
+ * The LVGL core is the only caller: a FREE request stays FREE for the worker until it's QUEUED */
+static req_t* req_queue(const char* path, lv_holo_io_op_t op, lv_holo_io_prio_t prio, lv_holo_io_cb_t cb,
+	void* user_data)
+{
+	if (done_task == NULL || strlen(path) >= LV_HOLO_IO_PATH_MAX) return NULL;
+
+	uint32_t i;
+	for (i = 0; i < LV_HOLO_IO_REQ_MAX; i++)
+	{
+		if (__atomic_load_n(&reqs[i].state, __ATOMIC_ACQUIRE) == REQ_FREE) break;
+	}
+	if (i == LV_HOLO_IO_REQ_MAX)
+	{
+		stat_full++;
+		return NULL;
+	}
+
+	req_t* req = &reqs[i];
+	strcpy(req->path, path);
+	req->seq = seq_next++;
+	req->prio = LV_MATH_MIN(prio, _LV_HOLO_IO_PRIO_NUM - 1);
+	req->op = op;
+	req->ok = false;
+	req->own_buf = false;
+	req->pos = 0;
+	req->buf = NULL;
+	req->len = 0;
+	req->size = 0;
+	req->queued_us = time_us();
+	req->cb = cb;
+	req->user_data = user_data;
+
+	if (req_pending++ == 0) lv_task_set_prio(done_task, LV_TASK_PRIO_MID);
+	return req;
+}
+
+/* LVGL core: call the callbacks of the finished requests and free them */
+static void done_task_cb(lv_task_t* task)
+{
+	uint32_t i;
+	for (i = 0; i < LV_HOLO_IO_REQ_MAX; i++)
+	{
+		req_t* req = &reqs[i];
+		if (__atomic_load_n(&req->state, __ATOMIC_ACQUIRE) != REQ_DONE) continue;
+
+		uint32_t wait_us = time_us() - req->queued_us;
+		stat_wait_us_max[req->prio] = LV_MATH_MAX(stat_wait_us_max[req->prio], wait_us);
+		stat_done++;
+		if (!req->ok) stat_failed++;
+		if (req->op == LV_HOLO_IO_READ) stat_bytes_read += req->len;
+		if (req->op == LV_HOLO_IO_WRITE || req->op == LV_HOLO_IO_APPEND)
+		{
+			stat_bytes_written += req->len;
+			lv_holo_meta_invalidate(req->path);	/* even if it failed, it may be partly written */
+		}
+
+		lv_holo_io_res_t res;
+		res.op = req->op;
+		res.path = req->path;
+		res.ok = req->ok;
+		res.data = req->op == LV_HOLO_IO_READ ? req->buf : NULL;
+		res.len = req->len;
+		res.size = req->size;
+		res.user_data = req->user_data;
+		if (req->cb) req->cb(&res);
+
+		/* The callback can keep a read buffer */
+		if (req->own_buf && (req->op != LV_HOLO_IO_READ || res.data)) free(req->buf);
+		req->buf = NULL;
+
+		__atomic_store_n(&req->state, REQ_FREE, __ATOMIC_RELEASE);
+		req_pending--;
+	}
+
+	if (req_pending == 0) lv_task_set_prio(task, LV_TASK_PRIO_OFF);
+}
+
+/* Worker: do a RUNNING request */
+static bool req_run(req_t* req)
+{
+	char path[LV_HOLO_IO_PATH_MAX * 2];
+	const char* src = req->path;
+	if (src[0] != '\0' && src[1] == ':') src += 2;	/* drive letter */
+	snprintf(path, sizeof(path), "%s%s", file_root, src);
+
+	file_t f;
+	if (!file_open(&f, path, req->op)) return false;
+
+	bool ok = true;
+	if (req->op == LV_HOLO_IO_READ || req->op == LV_HOLO_IO_STAT)
+	{
+		req->size = file_size(&f);
+	}
+	if (req->op == LV_HOLO_IO_READ)
+	{
+		uint32_t left = req->pos < req->size ? req->size - req->pos : 0;
+		uint32_t len = req->len ? LV_MATH_MIN(req->len, left) : left;
+		if (req->buf == NULL)
+		{
+			req->buf = malloc(LV_MATH_MAX(len, 1));
+			req->own_buf = req->buf != NULL;
+		}
+		ok = req->buf && file_seek(&f, req->pos);
+		req->len = ok ? file_read(&f, req->buf, len) : 0;
+		ok = ok && req->len == len;
+	}
+	else if (req->op != LV_HOLO_IO_STAT)
+	{
+		uint32_t len = req->len;
+		req->len = file_write(&f, req->buf, len);
+		ok = req->len == len;
+	}
+	file_close(&f);
+	return ok;
+}
+
+static void worker_loop(void)
+{
+	for (;;)
+	{
+		/* The oldest request of the highest priority first */
+		req_t* next = NULL;
+		uint32_t i;
+		for (i = 0; i < LV_HOLO_IO_REQ_MAX; i++)
+		{
+			req_t* req = &reqs[i];
+			if (__atomic_load_n(&req->state, __ATOMIC_ACQUIRE) != REQ_QUEUED) continue;
+			if (next == NULL || req->prio > next->prio ||
+				(req->prio == next->prio && (int32_t)(req->seq - next->seq) < 0))
+			{
+				next = req;
+			}
+		}
+
+		if (next == NULL)
+		{
+			/* Announce the sleep first, then check again so a wake up can't be missed */
+			__atomic_store_n(&worker_sleeping, 1, __ATOMIC_SEQ_CST);
+			for (i = 0; i < LV_HOLO_IO_REQ_MAX; i++)
+			{
+				if (__atomic_load_n(&reqs[i].state, __ATOMIC_SEQ_CST) == REQ_QUEUED) break;
+			}
+			if (i == LV_HOLO_IO_REQ_MAX) worker_sleep();
+			__atomic_store_n(&worker_sleeping, 0, __ATOMIC_SEQ_CST);
+			continue;
+		}
+
+		__atomic_store_n(&next->state, REQ_RUNNING, __ATOMIC_RELAXED);
+		uint32_t start = time_us();
+		next->ok = req_run(next);
+		__atomic_fetch_add(&stat_busy_us, time_us() - start, __ATOMIC_RELAXED);
+		__atomic_store_n(&next->state, REQ_DONE, __ATOMIC_RELEASE);
+	}
+}
+
+#if defined(ESP_PLATFORM)
+static uint32_t time_us(void)
+{
+	return (uint32_t)esp_timer_get_time();
+}
+
+static bool file_open(file_t* f, const char* path, lv_holo_io_op_t op)
+{
+	BYTE mode = FA_READ;
+	if (op == LV_HOLO_IO_WRITE) mode = FA_WRITE | FA_CREATE_ALWAYS;
+	else if (op == LV_HOLO_IO_APPEND) mode = FA_WRITE | FA_OPEN_APPEND;
+	return f_open(f, path, mode) == FR_OK;
+}
+
+static uint32_t file_size(file_t* f)
+{
+	return f_size(f);
+}
+
+static bool file_seek(file_t* f, uint32_t pos)
+{
+	return f_lseek(f, pos) == FR_OK;
+}
+
+static uint32_t file_read(file_t* f, void* buf, uint32_t len)
+{
+	UINT br;
+	if (f_read(f, buf, len, &br) != FR_OK) return 0;
+	return br;
+}
+
+static uint32_t file_write(file_t* f, const void* buf, uint32_t len)
+{
+	UINT bw;
+	if (f_write(f, buf, len, &bw) != FR_OK) return 0;
+	return bw;
+}
+
+static void file_close(file_t* f)
+{
+	f_close(f);
+}
+
+static void worker_task_cb(void* param)
+{
+	worker_loop();
+}
+
+static void worker_start(void)
+{
+	xTaskCreatePinnedToCore(worker_task_cb, "holo_io", 4096, NULL,
+		LV_HOLO_IO_PRIO, &worker_task, LV_HOLO_IO_CORE);
+}
+
+static void worker_sleep(void)
+{
+	ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void worker_wake(void)
+{
+	if (__atomic_load_n(&worker_sleeping, __ATOMIC_SEQ_CST)) xTaskNotifyGive(worker_task);
+}
+#else
+static uint32_t time_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static bool file_open(file_t* f, const char* path, lv_holo_io_op_t op)
+{
+	const char* mode = "rb";
+	if (op == LV_HOLO_IO_WRITE) mode = "wb";
+	else if (op == LV_HOLO_IO_APPEND) mode = "ab";
+	*f = fopen(path, mode);
+	return *f != NULL;
+}
+
+static uint32_t file_size(file_t* f)
+{
+	long pos = ftell(*f);
+	fseek(*f, 0, SEEK_END);
+	long size = ftell(*f);
+	fseek(*f, pos, SEEK_SET);
+	return size;
+}
+
+static bool file_seek(file_t* f, uint32_t pos)
+{
+	return fseek(*f, pos, SEEK_SET) == 0;
+}
+
+static uint32_t file_read(file_t* f, void* buf, uint32_t len)
+{
+	return fread(buf, 1, len, *f);
+}
+
+static uint32_t file_write(file_t* f, const void* buf, uint32_t len)
+{
+	return fwrite(buf, 1, len, *f);
+}
+
+static void file_close(file_t* f)
+{
+	fclose(*f);
+}
+
+static void* worker_thread_cb(void* param)
+{
+	worker_loop();
+	return NULL;
+}
+
+static void worker_start(void)
+{
+	pthread_create(&worker_thread, NULL, worker_thread_cb, NULL);
+}
+
+static void worker_sleep(void)
+{
+	pthread_mutex_lock(&worker_mutex);
+	while (!worker_woken) pthread_cond_wait(&worker_cond, &worker_mutex);
+	worker_woken = false;
+	pthread_mutex_unlock(&worker_mutex);
+}
+
+static void worker_wake(void)
+{
+	pthread_mutex_lock(&worker_mutex);
+	worker_woken = true;
+	pthread_cond_signal(&worker_cond);
+	pthread_mutex_unlock(&worker_mutex);
+}
+#endif
@@ -0,0 +1,997 @@
+/**
+ * @file lv_holo_jpeg.c
+ * Baseline JPEG image decoder (see lv_holo_jpeg.h)
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_jpeg.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PATH_MAX_LEN    64
+#define COMP_MAX        3
+#define SCALE_MAX       3		/* 1/8 */
+#define SIZE_MAX_PX     2047	/* 11 bits in lv_img_header_t */
+
+/* Fixed point IDCT, the "islow" method of the IJG's libjpeg */
+#define CONST_BITS      13
+#define PASS1_BITS      2
+#define FIX_0_298631336 2446
+#define FIX_0_390180644 3196
+#define FIX_0_541196100 4433
+#define FIX_0_765366865 6270
+#define FIX_0_899976223 7373
+#define FIX_1_175875602 9633
+#define FIX_1_501321110 12299
+#define FIX_1_847759065 15137
+#define FIX_1_961570560 16069
+#define FIX_2_053119869 16819
+#define FIX_2_562915447 20995
+#define FIX_3_072711026 25172
+#define DESCALE(x, n)   (((x) + (1 << ((n) - 1))) >> (n))
+
+/* YCbCr -> RGB in 16 bit fixed point */
+#define CR_R            91881
+#define CB_G            22554
+#define CR_G            46802
+#define CB_B            116130
+
+#define MARKER_EOI      0xD9
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct
+{
+	lv_fs_file_t file;
+	uint8_t buf[LV_HOLO_JPEG_READ_BUF];
+	uint32_t len;
+	uint32_t pos;
+} jpeg_in_t;
+
+typedef struct
+{
+	uint8_t look_len[256];		/* codes of max. 8 bits by their first 8 bits, 0: longer code */
+	uint8_t look_val[256];
+	int32_t maxcode[17];		/* largest code of each length, -1: none */
+	int32_t valoff[17];			/* `val` index of a code minus the code */
+	uint8_t val[256];
+} huff_t;
+
+typedef struct
+{
+	uint8_t id;
+	uint8_t h;					/* sampling factors */
+	uint8_t v;
+	uint8_t tq;					/* tables */
+	uint8_t td;
+	uint8_t ta;
+	uint8_t scale;				/* of the blocks, 0..3: 1/1 .. 1/8 */
+	uint8_t hs;					/* upsampling to the MCU's pixels, 0: none, 1: x2 */
+	uint8_t vs;
+	int32_t pred;				/* DC of the previous block */
+} comp_t;
+
+typedef struct
+{
+	uint16_t w;
+	uint16_t h;
+	uint8_t comp_cnt;
+	uint8_t hmax;
+	uint8_t vmax;
+	comp_t comp[COMP_MAX];
+} frame_t;
+
+typedef struct
+{
+	jpeg_in_t in;
+	frame_t frame;
+	huff_t dc[2];
+	huff_t ac[2];
+	uint16_t qt[4][64];			/* in zigzag order like in the file */
+	uint16_t restart_interval;	/* MCUs, 0: no restart markers */
+	uint16_t restarts_left;
+	uint32_t data_pos;			/* of the entropy coded data in the file */
+	uint32_t bits;				/* read ahead bits from the MSB */
+	int32_t bit_cnt;
+	int32_t pad_cnt;			/* zero bits after a marker at the end of `bits`, not from the file */
+	uint8_t marker;				/* reached in the entropy coded data, 0: none */
+	uint8_t scale;				/* 0..3: 1/1 .. 1/8 */
+	uint8_t strip_h;			/* lines of an MCU row */
+	uint16_t mcu_cnt_x;
+	uint16_t row;				/* next MCU row to decode */
+	int32_t strip_row;			/* MCU row in `strip`, -1: none */
+	lv_coord_t out_w;
+	int32_t coef[64];
+	uint8_t plane[COMP_MAX][256];	/* samples of the current MCU, 16x16 at most */
+	lv_color_t* strip;			/* `out_w` x `strip_h` pixels */
+} jpeg_dec_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+static bool src_check(const void* src);
+static int32_t scale_pick(const frame_t* frame);
+static uint32_t strip_size(const frame_t* frame, uint8_t scale);
+static lv_coord_t scaled(uint16_t size, uint8_t scale);
+
+static int32_t in_refill(jpeg_in_t* in);
+static bool markers_parse(jpeg_in_t* in, frame_t* frame, jpeg_dec_t* dec);
+static bool sof_parse(jpeg_in_t* in, frame_t* frame, int32_t len);
+static bool dht_parse(jpeg_in_t* in, jpeg_dec_t* dec, int32_t len);
+static bool dqt_parse(jpeg_in_t* in, jpeg_dec_t* dec, int32_t len);
+static bool sos_parse(jpeg_in_t* in, jpeg_dec_t* dec, int32_t len);
+static bool huff_build(huff_t* t, const uint8_t* counts);
+
+static bool decode_rewind(jpeg_dec_t* dec);
+static bool row_decode(jpeg_dec_t* dec, bool put);
+static void comps_setup(jpeg_dec_t* dec);
+static bool restart(jpeg_dec_t* dec);
+static uint32_t block_decode(jpeg_dec_t* dec, comp_t* comp, bool coef);
+static void idct(const int32_t* in, uint8_t* out, uint32_t stride);
+static void block_put(const uint8_t* px, uint8_t* out, uint32_t stride, uint8_t scale);
+static void mcu_put(jpeg_dec_t* dec, uint32_t mcu_x);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_coord_t fit_w = LV_HOR_RES_MAX;
+static lv_coord_t fit_h = LV_VER_RES_MAX;
+
+/* Index of the coefficients in the 8x8 block by their order in the file */
+static const uint8_t zigzag[64] =
+{
+	0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_holo_jpeg_decoder_init(void)
+{
+	lv_img_decoder_t* decoder = lv_img_decoder_create();
+	lv_img_decoder_set_info_cb(decoder, decoder_info);
+	lv_img_decoder_set_open_cb(decoder, decoder_open);
+	lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+	lv_img_decoder_set_close_cb(decoder, decoder_close);
+}
+
+void lv_holo_jpeg_set_fit(lv_coord_t w, lv_coord_t h)
+{
+	fit_w = w;
+	fit_h = h;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+	if (!src_check(src)) return LV_RES_INV;
+
+	/* Only the markers up to the frame header are read */
+	jpeg_in_t in;
+	frame_t frame;
+	if (lv_fs_open(&in.file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+	in.len = 0;
+	in.pos = 0;
+	bool ok = markers_parse(&in, &frame, NULL);
+	lv_fs_close(&in.file);
+
+	int32_t scale = ok ? scale_pick(&frame) : -1;
+	if (scale < 0) return LV_RES_INV;
+
+	header->always_zero = 0;
+	header->cf = LV_IMG_CF_TRUE_COLOR;
+	header->w = scaled(frame.w, scale);
+	header->h = scaled(frame.h, scale);
+	return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	if (!src_check(dsc->src)) return LV_RES_INV;
+
+	jpeg_dec_t* dec = malloc(sizeof(jpeg_dec_t));
+	if (dec == NULL) return LV_RES_INV;
+
+	if (lv_fs_open(&dec->in.file, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK)
+	{
+		free(dec);
+		return LV_RES_INV;
+	}
+	dec->in.len = 0;
+	dec->in.pos = 0;
+	dec->restart_interval = 0;
+	memset(dec->dc, 0, sizeof(dec->dc));
+	memset(dec->ac, 0, sizeof(dec->ac));
+	memset(dec->qt, 0, sizeof(dec->qt));
+
+	int32_t scale = -1;
+	if (markers_parse(&dec->in, &dec->frame, dec)) scale = scale_pick(&dec->frame);
+	dec->strip = scale >= 0 ? malloc(strip_size(&dec->frame, scale)) : NULL;
+	if (dec->strip == NULL)
+	{
+		lv_fs_close(&dec->in.file);
+		free(dec);
+		return LV_RES_INV;
+	}
+
+	dec->scale = scale;
+	dec->strip_h = (dec->frame.vmax * 8) >> scale;
+	dec->mcu_cnt_x = (dec->frame.w + dec->frame.hmax * 8 - 1) / (dec->frame.hmax * 8);
+	dec->out_w = scaled(dec->frame.w, scale);
+	comps_setup(dec);
+	decode_rewind(dec);
+
+	dsc->header.always_zero = 0;
+	dsc->header.cf = LV_IMG_CF_TRUE_COLOR;
+	dsc->header.w = dec->out_w;
+	dsc->header.h = scaled(dec->frame.h, scale);
+	dsc->img_data = NULL;	/* read line by line */
+	dsc->user_data = dec;
+	dsc->mem_size = sizeof(jpeg_dec_t) + strip_size(&dec->frame, scale) + dec->in.file.drv->file_size +
+		dec->in.file.drv->file_extra_size;
+	return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf)
+{
+	jpeg_dec_t* dec = dsc->user_data;
+	uint32_t row = y / dec->strip_h;
+
+	if ((int32_t)row != dec->strip_row)
+	{
+		/* Going back restarts from the top, the rows before the line are only entropy decoded */
+		if (row < dec->row && !decode_rewind(dec)) return LV_RES_INV;
+		while (dec->row < row)
+		{
+			if (!row_decode(dec, false)) return LV_RES_INV;
+		}
+		if (!row_decode(dec, true)) return LV_RES_INV;
+		dec->strip_row = row;
+	}
+
+	memcpy(buf, &dec->strip[(y - row * dec->strip_h) * dec->out_w + x], len * sizeof(lv_color_t));
+	return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	jpeg_dec_t* dec = dsc->user_data;
+	if (dec == NULL) return;
+
+	lv_fs_close(&dec->in.file);
+	free(dec->strip);
+	free(dec);
+	dsc->user_data = NULL;
+}
+
+/* "S:/a/photo.jpg" or .jpeg, in any case */
+static bool src_check(const void* src)
+{
+	if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return false;
+	if (strlen(src) >= PATH_MAX_LEN) return false;
+
+	const char* ext = lv_fs_get_ext(src);
+	char lower[5];
+	uint32_t i;
+	for (i = 0; i < sizeof(lower) - 1 && ext[i]; i++)
+	{
+		lower[i] = (ext[i] >= 'A' && ext[i] <= 'Z') ? ext[i] - 'A' + 'a' : ext[i];
+	}
+	if (ext[i]) return false;
+	lower[i] = '\0';
+	return strcmp(lower, "jpg") == 0 || strcmp(lower, "jpeg") == 0;
+}
+
+/* The smallest scale down (0..3: 1/1 .. 1/8) that fits into the fit size and the heap */
+static int32_t scale_pick(const frame_t* frame)
+{
+	uint8_t scale;
+	for (scale = 0; scale <= SCALE_MAX; scale++)
+	{
+		lv_coord_t w = scaled(frame->w, scale);
+		lv_coord_t h = scaled(frame->h, scale);
+		if (w > SIZE_MAX_PX || h > SIZE_MAX_PX) continue;
+		if (sizeof(jpeg_dec_t) + strip_size(frame, scale) > LV_HOLO_JPEG_HEAP_MAX) continue;
+		if (scale < SCALE_MAX && ((fit_w && w > fit_w) || (fit_h && h > fit_h))) continue;
+		return scale;
+	}
+
+	LV_LOG_WARN("lv_holo_jpeg: the image is too large");
+	return -1;
+}
+
+static uint32_t strip_size(const frame_t* frame, uint8_t scale)
+{
+	return scaled(frame->w, scale) * ((frame->vmax * 8) >> scale) * sizeof(lv_color_t);
+}
+
+static lv_coord_t scaled(uint16_t size, uint8_t scale)
+{
+	return (size + (1 << scale) - 1) >> scale;
+}
+
+/*-----------------------------------
+ * Markers
+ *----------------------------------*/
+
+static inline int32_t in_byte(jpeg_in_t* in)
+{
+	if (in->pos < in->len) return in->buf[in->pos++];
+	return in_refill(in);
+}
+
+/* The next byte from the file, -1 at its end */
+static int32_t in_refill(jpeg_in_t* in)
+{
+	if (lv_fs_read(&in->file, in->buf, sizeof(in->buf), &in->len) != LV_FS_RES_OK) in->len = 0;
+	in->pos = 0;
+	if (in->len == 0) return -1;
+	return in->buf[in->pos++];
+}
+
+static int32_t in_u16(jpeg_in_t* in)
+{
+	int32_t hi = in_byte(in);
+	int32_t lo = in_byte(in);
+	if (hi < 0 || lo < 0) return -1;
+	return (hi << 8) | lo;
+}
+
+static bool in_skip(jpeg_in_t* in, int32_t len)
+{
+	while (len-- > 0)
+	{
+		if (in_byte(in) < 0) return false;
+	}
+	return true;
+}
+
+/* Read the markers up to the frame header (`dec` is NULL) or up to the entropy coded data */
+static bool markers_parse(jpeg_in_t* in, frame_t* frame, jpeg_dec_t* dec)
+{
+	if (in_byte(in) != 0xFF || in_byte(in) != 0xD8) return false;
+	frame->comp_cnt = 0;
+
+	while (1)
+	{
+		int32_t m = in_byte(in);
+		if (m != 0xFF) return false;
+		while (m == 0xFF) m = in_byte(in);
+
+		int32_t len = in_u16(in);
+		if (m < 0 || m == MARKER_EOI || len < 2) return false;
+		len -= 2;
+
+		if (m == 0xC0 || m == 0xC1)
+		{
+			if (!sof_parse(in, frame, len)) return false;
+			if (dec == NULL) return true;
+		}
+		else if (m >= 0xC2 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC)
+		{
+			LV_LOG_WARN("lv_holo_jpeg: only baseline JPEG files are supported");
+			return false;
+		}
+		else if (dec && m == 0xC4)
+		{
+			if (!dht_parse(in, dec, len)) return false;
+		}
+		else if (dec && m == 0xDB)
+		{
+			if (!dqt_parse(in, dec, len)) return false;
+		}
+		else if (dec && m == 0xDD)
+		{
+			if (len != 2) return false;
+			dec->restart_interval = in_u16(in);
+		}
+		else if (m == 0xDA)
+		{
+			return dec && frame->comp_cnt && sos_parse(in, dec, len);
+		}
+		else if (!in_skip(in, len))
+		{
+			return false;
+		}
+	}
+}
+
+static bool sof_parse(jpeg_in_t* in, frame_t* frame, int32_t len)
+{
+	int32_t precision = in_byte(in);
+	int32_t h = in_u16(in);
+	int32_t w = in_u16(in);
+	int32_t n = in_byte(in);
+	if (precision != 8 || w <= 0 || h <= 0 || (n != 1 && n != COMP_MAX) || len != 6 + 3 * n) return false;
+
+	frame->w = w;
+	frame->h = h;
+	frame->comp_cnt = n;
+	frame->hmax = 1;
+	frame->vmax = 1;
+	int32_t i;
+	for (i = 0; i < n; i++)
+	{
+		comp_t* comp = &frame->comp[i];
+		comp->id = in_byte(in);
+		int32_t hv = in_byte(in);
+		int32_t tq = in_byte(in);
+		if (tq < 0 || tq > 3) return false;
+		comp->h = n == 1 ? 1 : hv >> 4;		/* a single component is not interleaved, its MCU is 1 block */
+		comp->v = n == 1 ? 1 : hv & 0xF;
+		comp->tq = tq;
+		if (comp->h < 1 || comp->h > 2 || comp->v < 1 || comp->v > 2) return false;
+		frame->hmax = LV_MATH_MAX(frame->hmax, comp->h);
+		frame->vmax = LV_MATH_MAX(frame->vmax, comp->v);
+	}
+	return true;
+}
+
+static bool dht_parse(jpeg_in_t* in, jpeg_dec_t* dec, int32_t len)
+{
+	while (len > 0)
+	{
+		int32_t tc_th = in_byte(in);
+		uint8_t counts[16];
+		int32_t total = 0;
+		int32_t i;
+		for (i = 0; i < 16; i++)
+		{
+			int32_t c = in_byte(in);
+			if (c < 0) return false;
+			counts[i] = c;
+			total += c;
+		}
+		if (tc_th < 0 || (tc_th & 0xEE) || total > 256 || len < 17 + total) return false;
+
+		huff_t* t = (tc_th >> 4) ? &dec->ac[tc_th & 1] : &dec->dc[tc_th & 1];
+		for (i = 0; i < total; i++)
+		{
+			int32_t v = in_byte(in);
+			if (v < 0) return false;
+			t->val[i] = v;
+		}
+		if (!huff_build(t, counts)) return false;
+		len -= 17 + total;
+	}
+	return len == 0;
+}
+
+static bool dqt_parse(jpeg_in_t* in, jpeg_dec_t* dec, int32_t len)
+{
+	while (len > 0)
+	{
+		int32_t pq_tq = in_byte(in);
+		if (pq_tq < 0 || (pq_tq & 0xF) > 3 || (pq_tq >> 4) > 1) return false;
+
+		bool wide = pq_tq >> 4;
+		uint16_t* qt = dec->qt[pq_tq & 0xF];
+		int32_t k;
+		for (k = 0; k < 64; k++)
+		{
+			int32_t q = wide ? in_u16(in) : in_byte(in);
+			if (q < 0) return false;
+			qt[k] = q;
+		}
+		len -= 1 + (wide ? 128 : 64);
+	}
+	return len == 0;
+}
+
+static bool sos_parse(jpeg_in_t* in, jpeg_dec_t* dec, int32_t len)
+{
+	frame_t* frame = &dec->frame;
+	int32_t n = in_byte(in);
+	if (n != frame->comp_cnt || len != 4 + 2 * n)
+	{
+		LV_LOG_WARN("lv_holo_jpeg: only interleaved scans are supported");
+		return false;
+	}
+
+	int32_t i;
+	for (i = 0; i < n; i++)
+	{
+		int32_t id = in_byte(in);
+		int32_t t = in_byte(in);
+		int32_t c;
+		for (c = 0; c < n && frame->comp[c].id != id; c++);
+		if (c == n || t < 0 || (t & 0xEE)) return false;
+		frame->comp[c].td = t >> 4;
+		frame->comp[c].ta = t & 0xF;
+	}
+	if (!in_skip(in, 3)) return false;	/* spectral selection and approximation, fixed in baseline */
+
+	uint32_t pos;
+	if (lv_fs_tell(&in->file, &pos) != LV_FS_RES_OK) return false;
+	dec->data_pos = pos - (in->len - in->pos);
+	return true;
+}
+
+/* Canonical Huffman codes from the number of codes of each length, `t->val` is already set */
+static bool huff_build(huff_t* t, const uint8_t* counts)
+{
+	int32_t code = 0;
+	int32_t k = 0;
+	int32_t len;
+	memset(t->look_len, 0, sizeof(t->look_len));
+
+	for (len = 1; len <= 16; len++)
+	{
+		int32_t n = counts[len - 1];
+		t->valoff[len] = k - code;
+		t->maxcode[len] = n ? code + n - 1 : -1;
+		if (code + n > (1 << len)) return false;
+
+		for (; n > 0; n--, code++, k++)
+		{
+			if (len > 8) continue;
+			int32_t first = code << (8 - len);
+			int32_t j;
+			for (j = 0; j < (1 << (8 - len)); j++)
+			{
+				t->look_len[first + j] = len;
+				t->look_val[first + j] = t->val[k];
+			}
+		}
+		code <<= 1;
+	}
+	return true;
+}
+
+/*-----------------------------------
+ * Entropy coded data
+ *----------------------------------*/
+
+static inline uint8_t clamp_u8(int32_t v)
+{
+	return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+static bool decode_rewind(jpeg_dec_t* dec)
+{
+	if (lv_fs_seek(&dec->in.file, dec->data_pos) != LV_FS_RES_OK) return false;
+	dec->in.len = 0;
+	dec->in.pos = 0;
+	dec->bits = 0;
+	dec->bit_cnt = 0;
+	dec->pad_cnt = 0;
+	dec->marker = 0;
+	dec->restarts_left = dec->restart_interval;
+	dec->row = 0;
+	dec->strip_row = -1;
+
+	uint32_t c;
+	for (c = 0; c < dec->frame.comp_cnt; c++) dec->frame.comp[c].pred = 0;
+	return true;
+}
+
+/* At least 25 bits in `bits`, zeros after a marker or the end of the file */
+static inline void bits_fill(jpeg_dec_t* dec)
+{
+	while (dec->bit_cnt <= 24)
+	{
+		int32_t c = 0;
+		if (dec->marker == 0)
+		{
+			c = in_byte(&dec->in);
+			if (c == 0xFF)
+			{
+				do c = in_byte(&dec->in); while (c == 0xFF);
+				if (c == 0) c = 0xFF;	/* stuffed byte */
+				else
+				{
+					dec->marker = c < 0 ? MARKER_EOI : c;
+					c = 0;
+				}
+			}
+			else if (c < 0)
+			{
+				dec->marker = MARKER_EOI;
+				c = 0;
+			}
+		}
+		if (dec->marker) dec->pad_cnt += 8;
+		dec->bits |= (uint32_t)c << (24 - dec->bit_cnt);
+		dec->bit_cnt += 8;
+	}
+}
+
+static inline void bits_skip(jpeg_dec_t* dec, int32_t n)
+{
+	dec->bits <<= n;
+	dec->bit_cnt -= n;
+}
+
+/* A symbol, 0 for codes not in the table */
+static inline int32_t huff_decode(jpeg_dec_t* dec, const huff_t* t)
+{
+	bits_fill(dec);
+	uint32_t look = dec->bits >> 24;
+	int32_t len = t->look_len[look];
+	if (len)
+	{
+		bits_skip(dec, len);
+		return t->look_val[look];
+	}
+
+	for (len = 9; len <= 16; len++)
+	{
+		int32_t code = dec->bits >> (32 - len);
+		if (code <= t->maxcode[len])
+		{
+			bits_skip(dec, len);
+			return t->val[code + t->valoff[len]];
+		}
+	}
+	return 0;
+}
+
+/* A coefficient of `s` bits */
+static inline int32_t bits_extend(jpeg_dec_t* dec, int32_t s)
+{
+	bits_fill(dec);
+	int32_t v = dec->bits >> (32 - s);
+	bits_skip(dec, s);
+	return v < (1 << (s - 1)) ? v - (1 << s) + 1 : v;
+}
+
+/* Returns false if the data ends before the row (a truncated or damaged file) */
+static bool row_decode(jpeg_dec_t* dec, bool put)
+{
+	frame_t* frame = &dec->frame;
+	uint32_t mcu_x;
+	for (mcu_x = 0; mcu_x < dec->mcu_cnt_x; mcu_x++)
+	{
+		if (dec->restart_interval)
+		{
+			if (dec->restarts_left == 0 && !restart(dec)) return false;
+			dec->restarts_left--;
+		}
+
+		uint32_t c;
+		for (c = 0; c < frame->comp_cnt; c++)
+		{
+			comp_t* comp = &frame->comp[c];
+			uint8_t scale = comp->scale;
+			uint32_t bs = 8 >> scale;	/* block size in the plane */
+			uint32_t pw = comp->h * bs;
+			uint32_t bx, by;
+			for (by = 0; by < comp->v; by++)
+			{
+				for (bx = 0; bx < comp->h; bx++)
+				{
+					/* 1/8 needs only the DC, the other coefficients are decoded and dropped */
+					if (!put || scale == SCALE_MAX)
+					{
+						block_decode(dec, comp, false);
+						if (put) dec->plane[c][by * pw + bx] = clamp_u8(
+							DESCALE(comp->pred * dec->qt[comp->tq][0], 3) + 128);
+						continue;
+					}
+
+					uint8_t* out = &dec->plane[c][by * bs * pw + bx * bs];
+					memset(dec->coef, 0, sizeof(dec->coef));
+					if (block_decode(dec, comp, true) == 0)
+					{
+						uint8_t v = clamp_u8(DESCALE(dec->coef[0], 3) + 128);
+						uint32_t y;
+						for (y = 0; y < bs; y++) memset(&out[y * pw], v, bs);
+					}
+					else if (scale == 0)
+					{
+						idct(dec->coef, out, pw);
+					}
+					else
+					{
+						uint8_t px[64];
+						idct(dec->coef, px, 8);
+						block_put(px, out, pw, scale);
+					}
+				}
+			}
+		}
+
+		if (put) mcu_put(dec, mcu_x);
+	}
+	dec->row++;
+
+	/* Padding taken as data: the bits of the row weren't all in the file */
+	return dec->bit_cnt >= dec->pad_cnt;
+}
+
+/* Subsampled chroma (4:2:0) is scaled down less than the luma if possible, instead of upsampling it */
+static void comps_setup(jpeg_dec_t* dec)
+{
+	frame_t* frame = &dec->frame;
+	uint32_t c;
+	for (c = 0; c < frame->comp_cnt; c++)
+	{
+		comp_t* comp = &frame->comp[c];
+		comp->hs = frame->hmax / comp->h - 1;
+		comp->vs = frame->vmax / comp->v - 1;
+		comp->scale = dec->scale;
+		if (comp->hs && comp->vs && dec->scale > 0)
+		{
+			comp->scale--;
+			comp->hs = 0;
+			comp->vs = 0;
+		}
+	}
+}
+
+static bool restart(jpeg_dec_t* dec)
+{
+	/* The bits up to the marker are padding */
+	if (dec->bit_cnt < dec->pad_cnt) return false;
+	dec->bits = 0;
+	dec->bit_cnt = 0;
+	dec->pad_cnt = 0;
+	while (dec->marker == 0)
+	{
+		int32_t c = in_byte(&dec->in);
+		if (c < 0)
+		{
+			dec->marker = MARKER_EOI;
+			break;
+		}
+		if (c != 0xFF) continue;
+		do c = in_byte(&dec->in); while (c == 0xFF);
+		if (c != 0) dec->marker = c < 0 ? MARKER_EOI : c;
+	}
+
+	/* Anything else than RSTn: the file ends or the data is damaged */
+	if (dec->marker < 0xD0 || dec->marker > 0xD7) return false;
+	dec->marker = 0;
+
+	uint32_t c;
+	for (c = 0; c < dec->frame.comp_cnt; c++) dec->frame.comp[c].pred = 0;
+	dec->restarts_left = dec->restart_interval;
+	return true;
+}
+
+/* Decode the next block of `comp`, dequantized to `dec->coef` if `coef` is set.
+ * Returns the zigzag index of the last non-zero coefficient (0: only the DC) */
+static uint32_t block_decode(jpeg_dec_t* dec, comp_t* comp, bool coef)
+{
+	const uint16_t* qt = dec->qt[comp->tq];
+	const huff_t* ac = &dec->ac[comp->ta];
+
+	int32_t s = huff_decode(dec, &dec->dc[comp->td]) & 0xF;
+	if (s) comp->pred += bits_extend(dec, s);
+	if (coef) dec->coef[0] = comp->pred * qt[0];
+
+	uint32_t last = 0;
+	uint32_t k;
+	for (k = 1; k < 64; k++)
+	{
+		int32_t rs = huff_decode(dec, ac);
+		s = rs & 0xF;
+		if (s == 0)
+		{
+			if (rs != 0xF0) break;	/* end of block */
+			k += 15;				/* 16 zeros */
+			continue;
+		}
+
+		k += rs >> 4;
+		if (k > 63) break;
+		int32_t v = bits_extend(dec, s);
+		if (coef)
+		{
+			dec->coef[zigzag[k]] = v * qt[k];
+			last = k;
+		}
+	}
+	return last;
+}
+
+/* 8x8 inverse DCT of dequantized coefficients to samples */
+static void idct(const int32_t* in, uint8_t* out, uint32_t stride)
+{
+	int32_t ws[64];
+	int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13, z1, z2, z3, z4, z5;
+	uint32_t i;
+
+	/* Columns */
+	for (i = 0; i < 8; i++)
+	{
+		const int32_t* col = &in[i];
+		int32_t* wc = &ws[i];
+		if ((col[8] | col[16] | col[24] | col[32] | col[40] | col[48] | col[56]) == 0)
+		{
+			int32_t dc = col[0] << PASS1_BITS;
+			wc[0] = wc[8] = wc[16] = wc[24] = wc[32] = wc[40] = wc[48] = wc[56] = dc;
+			continue;
+		}
+
+		z2 = col[16];
+		z3 = col[48];
+		z1 = (z2 + z3) * FIX_0_541196100;
+		tmp2 = z1 - z3 * FIX_1_847759065;
+		tmp3 = z1 + z2 * FIX_0_765366865;
+		tmp0 = (col[0] + col[32]) << CONST_BITS;
+		tmp1 = (col[0] - col[32]) << CONST_BITS;
+		tmp10 = tmp0 + tmp3;
+		tmp13 = tmp0 - tmp3;
+		tmp11 = tmp1 + tmp2;
+		tmp12 = tmp1 - tmp2;
+
+		tmp0 = col[56];
+		tmp1 = col[40];
+		tmp2 = col[24];
+		tmp3 = col[8];
+		z1 = tmp0 + tmp3;
+		z2 = tmp1 + tmp2;
+		z3 = tmp0 + tmp2;
+		z4 = tmp1 + tmp3;
+		z5 = (z3 + z4) * FIX_1_175875602;
+		tmp0 *= FIX_0_298631336;
+		tmp1 *= FIX_2_053119869;
+		tmp2 *= FIX_3_072711026;
+		tmp3 *= FIX_1_501321110;
+		z1 *= -FIX_0_899976223;
+		z2 *= -FIX_2_562915447;
+		z3 = z3 * -FIX_1_961570560 + z5;
+		z4 = z4 * -FIX_0_390180644 + z5;
+		tmp0 += z1 + z3;
+		tmp1 += z2 + z4;
+		tmp2 += z2 + z3;
+		tmp3 += z1 + z4;
+
+		wc[0] = DESCALE(tmp10 + tmp3, CONST_BITS - PASS1_BITS);
+		wc[56] = DESCALE(tmp10 - tmp3, CONST_BITS - PASS1_BITS);
+		wc[8] = DESCALE(tmp11 + tmp2, CONST_BITS - PASS1_BITS);
+		wc[48] = DESCALE(tmp11 - tmp2, CONST_BITS - PASS1_BITS);
+		wc[16] = DESCALE(tmp12 + tmp1, CONST_BITS - PASS1_BITS);
+		wc[40] = DESCALE(tmp12 - tmp1, CONST_BITS - PASS1_BITS);
+		wc[24] = DESCALE(tmp13 + tmp0, CONST_BITS - PASS1_BITS);
+		wc[32] = DESCALE(tmp13 - tmp0, CONST_BITS - PASS1_BITS);
+	}
+
+	/* Rows, +128 and clamp */
+	for (i = 0; i < 8; i++)
+	{
+		const int32_t* row = &ws[i * 8];
+		uint8_t* o = &out[i * stride];
+		if ((row[1] | row[2] | row[3] | row[4] | row[5] | row[6] | row[7]) == 0)
+		{
+			memset(o, clamp_u8(DESCALE(row[0], PASS1_BITS + 3) + 128), 8);
+			continue;
+		}
+
+		z2 = row[2];
+		z3 = row[6];
+		z1 = (z2 + z3) * FIX_0_541196100;
+		tmp2 = z1 - z3 * FIX_1_847759065;
+		tmp3 = z1 + z2 * FIX_0_765366865;
+		tmp0 = (row[0] + row[4]) << CONST_BITS;
+		tmp1 = (row[0] - row[4]) << CONST_BITS;
+		tmp10 = tmp0 + tmp3;
+		tmp13 = tmp0 - tmp3;
+		tmp11 = tmp1 + tmp2;
+		tmp12 = tmp1 - tmp2;
+
+		tmp0 = row[7];
+		tmp1 = row[5];
+		tmp2 = row[3];
+		tmp3 = row[1];
+		z1 = tmp0 + tmp3;
+		z2 = tmp1 + tmp2;
+		z3 = tmp0 + tmp2;
+		z4 = tmp1 + tmp3;
+		z5 = (z3 + z4) * FIX_1_175875602;
+		tmp0 *= FIX_0_298631336;
+		tmp1 *= FIX_2_053119869;
+		tmp2 *= FIX_3_072711026;
+		tmp3 *= FIX_1_501321110;
+		z1 *= -FIX_0_899976223;
+		z2 *= -FIX_2_562915447;
+		z3 = z3 * -FIX_1_961570560 + z5;
+		z4 = z4 * -FIX_0_390180644 + z5;
+		tmp0 += z1 + z3;
+		tmp1 += z2 + z4;
+		tmp2 += z2 + z3;
+		tmp3 += z1 + z4;
+
+#define ROW_OUT(v) clamp_u8(DESCALE(v, CONST_BITS + PASS1_BITS + 3) + 128)
+		o[0] = ROW_OUT(tmp10 + tmp3);
+		o[7] = ROW_OUT(tmp10 - tmp3);
+		o[1] = ROW_OUT(tmp11 + tmp2);
+		o[6] = ROW_OUT(tmp11 - tmp2);
+		o[2] = ROW_OUT(tmp12 + tmp1);
+		o[5] = ROW_OUT(tmp12 - tmp1);
+		o[3] = ROW_OUT(tmp13 + tmp0);
+		o[4] = ROW_OUT(tmp13 - tmp0);
+#undef ROW_OUT
+	}
+}
+
+/* 1/2 and 1/4: average the samples of an 8x8 block */
+static void block_put(const uint8_t* px, uint8_t* out, uint32_t stride, uint8_t scale)
+{
+	uint32_t n = 1 << scale;
+	uint32_t bs = 8 >> scale;
+	uint32_t shift = scale * 2;
+	uint32_t x, y, i, j;
+	for (y = 0; y < bs; y++)
+	{
+		for (x = 0; x < bs; x++)
+		{
+			const uint8_t* p = &px[(y * 8 + x) * n];
+			uint32_t sum = 0;
+			for (j = 0; j < n; j++)
+			{
+				for (i = 0; i < n; i++) sum += p[j * 8 + i];
+			}
+			out[y * stride + x] = (sum + (1 << (shift - 1))) >> shift;
+		}
+	}
+}
+
+/* Convert the samples of an MCU to pixels in the strip */
+static void mcu_put(jpeg_dec_t* dec, uint32_t mcu_x)
+{
+	frame_t* frame = &dec->frame;
+	uint32_t bs = 8 >> dec->scale;
+	lv_coord_t mw = frame->hmax * bs;
+	lv_coord_t x0 = mcu_x * mw;
+	lv_coord_t w = LV_MATH_MIN(mw, dec->out_w - x0);
+	lv_color_t* dst = &dec->strip[x0];
+	lv_coord_t x, y;
+
+	if (frame->comp_cnt == 1)
+	{
+		for (y = 0; y < dec->strip_h; y++, dst += dec->out_w)
+		{
+			const uint8_t* p = &dec->plane[0][y * mw];
+			for (x = 0; x < w; x++) dst[x] = lv_color_make(p[x], p[x], p[x]);
+		}
+		return;
+	}
+
+	const comp_t* comp = frame->comp;
+	uint32_t pw[COMP_MAX], hs[COMP_MAX], vs[COMP_MAX];
+	uint32_t c;
+	for (c = 0; c < COMP_MAX; c++)
+	{
+		pw[c] = comp[c].h * (8 >> comp[c].scale);
+		hs[c] = comp[c].hs;
+		vs[c] = comp[c].vs;
+	}
+
+	for (y = 0; y < dec->strip_h; y++, dst += dec->out_w)
+	{
+		const uint8_t* py = &dec->plane[0][(y >> vs[0]) * pw[0]];
+		const uint8_t* pb = &dec->plane[1][(y >> vs[1]) * pw[1]];
+		const uint8_t* pr = &dec->plane[2][(y >> vs[2]) * pw[2]];
+		for (x = 0; x < w; x++)
+		{
+			int32_t l = py[x >> hs[0]];
+			int32_t cb = pb[x >> hs[1]] - 128;
+			int32_t cr = pr[x >> hs[2]] - 128;
+			dst[x] = lv_color_make(clamp_u8(l + ((CR_R * cr + 32768) >> 16)),
+				clamp_u8(l + ((-CB_G * cb - CR_G * cr + 32768) >> 16)),
+				clamp_u8(l + ((CB_B * cb + 32768) >> 16)));
+		}
+	}
+}
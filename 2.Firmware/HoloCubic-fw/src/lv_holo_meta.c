@@ -0,0 +1,331 @@
+/**
+ * @file lv_holo_meta.c
+ * Index of the image files' headers (see lv_holo_meta.h).
+ * The entries are in an open addressing hash table: a path can be in the `LV_HOLO_META_PROBE` slots
+ * from the slot of its hash. Only two hashes of the path are stored, not the path.
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_meta.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PATH_MAX_LEN    64
+#define SLOT_MASK       (LV_HOLO_META_ENTRY_MAX - 1)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+
+static const char* path_key(const char* path);
+static uint32_t path_hash(const char* key);
+static uint32_t path_check(const char* key);
+static lv_holo_meta_entry_t* entry_find(uint32_t hash, uint32_t check);
+static void entry_add(uint32_t hash, uint32_t check, const lv_holo_meta_t* meta);
+static void entry_remove(lv_holo_meta_entry_t* entry);
+static bool meta_read(const char* src, lv_holo_meta_t* meta);
+static void index_load(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_holo_meta_entry_t entries[LV_HOLO_META_ENTRY_MAX];
+static uint32_t entry_cnt;
+static uint32_t replace_next;			/* the probed slot replaced next */
+static bool index_dirty;
+static char index_src[PATH_MAX_LEN];
+static lv_holo_meta_stat_cb_t stat_file;
+static bool reading;					/* `meta_read` asks the other decoders */
+static const char* reading_key;			/* of the file `meta_read` asks for */
+static uint32_t read_size;				/* from the decoders' opens of `reading_key` */
+static uint32_t read_cluster;
+
+static uint32_t stat_hits;
+static uint32_t stat_misses;
+static uint32_t stat_replaced;
+static uint32_t stat_changed;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_holo_meta_init(const char* index_path, lv_holo_meta_stat_cb_t stat_cb)
+{
+	stat_file = stat_cb;
+	index_src[0] = '\0';
+	if (index_path && strlen(index_path) < PATH_MAX_LEN)
+	{
+		strcpy(index_src, index_path);
+		index_load();
+	}
+
+	lv_img_decoder_t* decoder = lv_img_decoder_create();
+	lv_img_decoder_set_info_cb(decoder, decoder_info);
+}
+
+bool lv_holo_meta_get(const char* src, lv_holo_meta_t* meta)
+{
+	if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return false;
+
+	const char* key = path_key(src);
+	uint32_t hash = path_hash(key);
+	uint32_t check = path_check(key);
+	lv_holo_meta_entry_t* entry = entry_find(hash, check);
+
+	/* Not a file (any more), let the decoders answer */
+	uint32_t size = 0;
+	uint32_t stamp = 0;
+	if (stat_file && !stat_file(src, &size, &stamp))
+	{
+		if (entry) entry_remove(entry);
+		return false;
+	}
+
+	if (entry && stat_file && (entry->meta.size != size || entry->meta.stamp != stamp))
+	{
+		stat_changed++;
+		entry_remove(entry);
+		entry = NULL;
+	}
+	if (entry)
+	{
+		stat_hits++;
+		*meta = entry->meta;
+		return true;
+	}
+
+	stat_misses++;
+	if (!meta_read(src, meta)) return false;
+
+	if (stat_file)
+	{
+		meta->size = size;
+		meta->stamp = stamp;
+	}
+	entry_add(hash, check, meta);
+	return true;
+}
+
+void lv_holo_meta_invalidate(const char* src)
+{
+	if (src == NULL)
+	{
+		if (entry_cnt) index_dirty = true;
+		memset(entries, 0, sizeof(entries));
+		entry_cnt = 0;
+		return;
+	}
+
+	const char* key = path_key(src);
+	lv_holo_meta_entry_t* entry = entry_find(path_hash(key), path_check(key));
+	if (entry) entry_remove(entry);
+}
+
+void lv_holo_meta_file_opened(const char* path, bool write, uint32_t size, uint32_t cluster)
+{
+	if (write)
+	{
+		lv_holo_meta_invalidate(path);
+	}
+	else if (reading && strcmp(path_key(path), reading_key) == 0)
+	{
+		read_size = size;
+		read_cluster = cluster;
+	}
+}
+
+bool lv_holo_meta_save(void)
+{
+	if (!index_dirty || index_src[0] == '\0') return true;
+
+	lv_fs_file_t file;
+	if (lv_fs_open(&file, index_src, LV_FS_MODE_WR) != LV_FS_RES_OK) return false;
+
+	lv_holo_meta_file_t head;
+	memcpy(head.magic, LV_HOLO_META_MAGIC, 4);
+	head.version = LV_HOLO_META_VERSION;
+	head.entry_size = sizeof(lv_holo_meta_entry_t);
+	head.entry_cnt = entry_cnt;
+
+	uint32_t bw = 0;
+	bool ok = lv_fs_write(&file, &head, sizeof(head), &bw) == LV_FS_RES_OK && bw == sizeof(head);
+
+	uint32_t i;
+	for (i = 0; i < LV_HOLO_META_ENTRY_MAX && ok; i++)
+	{
+		if (entries[i].hash == 0) continue;
+		ok = lv_fs_write(&file, &entries[i], sizeof(lv_holo_meta_entry_t), &bw) == LV_FS_RES_OK &&
+			bw == sizeof(lv_holo_meta_entry_t);
+	}
+
+	/* The FATFS port opens for writing without truncating, cut a longer old index */
+	if (ok) lv_fs_trunc(&file);
+	lv_fs_close(&file);
+
+	if (ok) index_dirty = false;
+	else LV_LOG_WARN("lv_holo_meta_save: can't write the index");
+	return ok;
+}
+
+void lv_holo_meta_get_stats(lv_holo_meta_stats_t* stats)
+{
+	stats->hits = stat_hits;
+	stats->misses = stat_misses;
+	stats->replaced = stat_replaced;
+	stats->changed = stat_changed;
+	stats->entry_cnt = entry_cnt;
+
+	stat_hits = 0;
+	stat_misses = 0;
+	stat_replaced = 0;
+	stat_changed = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+	/* Let the other decoders answer while the header of a new file is read */
+	if (reading) return LV_RES_INV;
+
+	lv_holo_meta_t meta;
+	if (!lv_holo_meta_get(src, &meta)) return LV_RES_INV;
+
+	*header = meta.header;
+	return LV_RES_OK;
+}
+
+/* The path without the drive letter and the leading '/', like lv_fs gives it to the drivers */
+static const char* path_key(const char* path)
+{
+	if (path[0] != '\0' && path[1] == ':') path += 2;
+	while (*path == '/' || *path == '\\') path++;
+	return path;
+}
+
+/* FNV-1a, 0 is kept for the unused slots */
+static uint32_t path_hash(const char* key)
+{
+	uint32_t hash = 2166136261U;
+	while (*key)
+	{
+		hash ^= (uint8_t)*key++;
+		hash *= 16777619U;
+	}
+	return hash ? hash : 1;
+}
+
+/* djb2 with the length, unrelated to `path_hash` */
+static uint32_t path_check(const char* key)
+{
+	uint32_t hash = 5381;
+	uint32_t len = 0;
+	while (*key)
+	{
+		hash = hash * 33 ^ (uint8_t)*key++;
+		len++;
+	}
+	return hash ^ (len << 24);
+}
+
+static lv_holo_meta_entry_t* entry_find(uint32_t hash, uint32_t check)
+{
+	/* Freed slots don't end the probing, all of them are checked */
+	uint32_t i;
+	for (i = 0; i < LV_HOLO_META_PROBE; i++)
+	{
+		lv_holo_meta_entry_t* entry = &entries[(hash + i) & SLOT_MASK];
+		if (entry->hash == hash && entry->check == check) return entry;
+	}
+	return NULL;
+}
+
+static void entry_add(uint32_t hash, uint32_t check, const lv_holo_meta_t* meta)
+{
+	lv_holo_meta_entry_t* entry = NULL;
+	uint32_t i;
+	for (i = 0; i < LV_HOLO_META_PROBE; i++)
+	{
+		entry = &entries[(hash + i) & SLOT_MASK];
+		if (entry->hash == 0 || (entry->hash == hash && entry->check == check)) break;
+	}
+
+	if (i == LV_HOLO_META_PROBE)
+	{
+		/* Every slot is used, take them in turn */
+		entry = &entries[(hash + replace_next) & SLOT_MASK];
+		replace_next = (replace_next + 1) % LV_HOLO_META_PROBE;
+		stat_replaced++;
+	}
+	else if (entry->hash == 0)
+	{
+		entry_cnt++;
+	}
+
+	entry->hash = hash;
+	entry->check = check;
+	entry->meta = *meta;
+	index_dirty = true;
+}
+
+static void entry_remove(lv_holo_meta_entry_t* entry)
+{
+	entry->hash = 0;
+	entry_cnt--;
+	index_dirty = true;
+}
+
+/* The decoders open the file to read the header, the size and the first cluster come from their opens */
+static bool meta_read(const char* src, lv_holo_meta_t* meta)
+{
+	read_size = 0;
+	read_cluster = 0;
+	reading_key = path_key(src);
+	reading = true;
+	lv_res_t res = lv_img_decoder_get_info(src, &meta->header);
+	reading = false;
+	if (res != LV_RES_OK) return false;
+
+	meta->size = read_size;
+	meta->cluster = read_cluster;
+	meta->stamp = 0;
+	return true;
+}
+
+static void index_load(void)
+{
+	lv_fs_file_t file;
+	if (lv_fs_open(&file, index_src, LV_FS_MODE_RD) != LV_FS_RES_OK) return;
+
+	lv_holo_meta_file_t head;
+	uint32_t br = 0;
+	lv_fs_read(&file, &head, sizeof(head), &br);
+	if (br != sizeof(head) || memcmp(head.magic, LV_HOLO_META_MAGIC, 4) != 0 ||
+		head.version != LV_HOLO_META_VERSION || head.entry_size != sizeof(lv_holo_meta_entry_t))
+	{
+		LV_LOG_WARN("lv_holo_meta_init: the index is not valid, it is written again");
+		lv_fs_close(&file);
+		index_dirty = true;
+		return;
+	}
+
+	uint32_t i;
+	for (i = 0; i < head.entry_cnt; i++)
+	{
+		lv_holo_meta_entry_t entry;
+		if (lv_fs_read(&file, &entry, sizeof(entry), &br) != LV_FS_RES_OK || br != sizeof(entry)) break;
+		if (entry.hash) entry_add(entry.hash, entry.check, &entry.meta);
+	}
+	lv_fs_close(&file);
+
+	/* Same as on the card unless entries were replaced or the file was cut */
+	index_dirty = stat_replaced != 0 || i != head.entry_cnt;
+	stat_replaced = 0;
+}
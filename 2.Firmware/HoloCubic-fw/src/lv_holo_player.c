@@ -0,0 +1,709 @@
+/**
+ * @file lv_holo_player.c
+ * Frame sequence player. A reader on the other core streams the frames from the SD card
+ * (one file per frame or an animation container) into a ring of frame buffers,
+ * an lv_task shows them with a fixed frame rate.
+ * Containers with delta frames are read as they are stored, the lv_task applies them
+ * to one retained frame and redraws only the changed tiles.
+ * The files are read with FATFS directly (LVGL's lv_fs and lv_mem are not thread safe),
+ * on a PC build with stdio in a pthread. Files stored in consecutive sectors are read by
+ * sector address (sd_raw.h), whole frames with one multi-block read.
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_player.h"
+#include "lv_holo_anim.h"
+#include "sd_raw.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "ff.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if defined(ESP_PLATFORM)
+typedef FIL file_t;
+#else
+typedef FILE* file_t;
+#endif
+
+typedef struct
+{
+	sd_raw_file_t file;
+	bool checked;				/* sd_raw_open() was tried */
+	bool ok;					/* contiguous, read by sector address */
+} raw_file_t;
+
+/*********************
+ *      DEFINES
+ *********************/
+/* A frame read by sectors starts anywhere in the first one and ends anywhere in the last one */
+#if LV_HOLO_PLAYER_RAW
+#define SLOT_SLACK      (2 * SD_RAW_SECTOR)
+#else
+#define SLOT_SLACK      0
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void play_task_cb(lv_task_t* task);
+static bool frame_read(uint32_t id, uint8_t* buf, uint32_t size, lv_img_header_t* header);
+static uint8_t* frame_load(uint32_t id, uint8_t* slot);
+static bool frame_exists(uint32_t id);
+static void frame_path(uint32_t id, char* path);
+static bool anim_open(const char* path);
+static uint8_t* anim_frame_read(uint32_t id, uint8_t* slot);
+static uint8_t* anim_entry_read(uint32_t id, uint8_t* slot);
+static void anim_close(void);
+static uint8_t* raw_read(const sd_raw_file_t* file, uint32_t pos, uint32_t len, uint8_t* slot);
+static void raw_close(raw_file_t* raw);
+static uint32_t time_us(void);
+
+static bool file_open(file_t* f, const char* path);
+static uint32_t file_size(file_t* f);
+static bool file_seek(file_t* f, uint32_t pos);
+static uint32_t file_read(file_t* f, void* buf, uint32_t len);
+static void file_close(file_t* f);
+
+static void reader_loop(void);
+static void reader_start(void);
+static void reader_join(void);
+static void reader_sleep(void);
+static void reader_wake(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_obj_t* player_img;
+static lv_task_t* play_task;
+static char player_path_fmt[LV_HOLO_PLAYER_PATH_MAX];
+static uint32_t player_frame_cnt;
+static uint32_t frame_size;
+static uint32_t slot_size;		/* of the ring buffers, without SLOT_SLACK */
+
+/* Frame sequence mode: the files read by sector address, checked on their first read */
+static raw_file_t* frame_raws;
+
+/* Animation container mode: the file stays open for the reader */
+static bool anim_mode;
+static file_t anim_file;
+static raw_file_t anim_raw;
+static lv_holo_anim_header_t anim_header;
+static lv_holo_anim_entry_t* anim_entries;
+static uint8_t anim_in_buf[LV_HOLO_ANIM_READ_BUF];
+
+/* Delta mode: the ring holds the frames as stored, they are applied to `anim_frame` */
+static bool delta_mode;
+static uint8_t* anim_frame;
+static lv_img_dsc_t anim_dsc;
+
+/* Frame `i` goes to `ring[i % ring_len]`, the reader sets where in the buffer its data is.
+ * Single producer (reader), single consumer (play_task) */
+static uint8_t* ring[LV_HOLO_PLAYER_RING_LEN];
+static lv_img_dsc_t ring_dscs[LV_HOLO_PLAYER_RING_LEN];
+static uint32_t ring_len;
+static uint32_t frame_head;		/* frames read */
+static uint32_t frame_tail;		/* frames taken to show, `frame_tail - 1` is on the screen */
+static uint32_t reader_sleeping;
+static uint32_t reader_stop;
+static uint32_t reader_error;
+static uint32_t reader_done;
+
+static uint32_t stat_shown;
+static uint32_t stat_dropped;
+static uint32_t stat_bytes;
+static uint32_t stat_read_us;
+static uint32_t stat_raw;
+static uint32_t stat_last_ms;
+
+#if defined(ESP_PLATFORM)
+static TaskHandle_t reader_task;
+#else
+static pthread_t reader_thread;
+static pthread_mutex_t reader_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t reader_cond = PTHREAD_COND_INITIALIZER;
+static bool reader_woken;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_holo_player_open(lv_obj_t* img, const char* path_fmt, uint32_t frame_cnt, uint32_t fps)
+{
+	lv_holo_player_close();
+
+	strncpy(player_path_fmt, path_fmt, LV_HOLO_PLAYER_PATH_MAX - 1);
+	player_path_fmt[LV_HOLO_PLAYER_PATH_MAX - 1] = '\0';
+
+	lv_img_header_t header;
+	uint32_t path_len = strlen(player_path_fmt);
+	uint32_t ext_len = strlen(LV_HOLO_ANIM_EXT);
+	anim_mode = path_len > ext_len && strcmp(&player_path_fmt[path_len - ext_len], LV_HOLO_ANIM_EXT) == 0;
+	if (anim_mode)
+	{
+		if (!anim_open(player_path_fmt))
+		{
+			LV_LOG_WARN("lv_holo_player_open: can't read the animation file");
+			return false;
+		}
+		header = anim_header.header;
+		if (frame_cnt == 0 || frame_cnt > anim_header.frame_cnt) frame_cnt = anim_header.frame_cnt;
+		if (fps == 0) fps = anim_header.fps;
+	}
+	else
+	{
+		/* The header and size of the first frame are used for all of them */
+		frame_size = 0;
+		delta_mode = false;
+		if (!frame_read(0, NULL, 0, &header))
+		{
+			LV_LOG_WARN("lv_holo_player_open: can't read the first frame");
+			return false;
+		}
+
+		if (frame_cnt == 0)
+		{
+			frame_cnt = 1;
+			while (frame_exists(frame_cnt)) frame_cnt++;
+		}
+		slot_size = frame_size;
+#if LV_HOLO_PLAYER_RAW
+		/* No table: every frame is read with FATFS */
+		frame_raws = calloc(frame_cnt, sizeof(raw_file_t));
+#endif
+	}
+	player_frame_cnt = frame_cnt;
+	if (fps == 0) fps = LV_HOLO_PLAYER_DEF_FPS;
+
+	for (ring_len = LV_HOLO_PLAYER_RING_LEN; ring_len >= 2; ring_len--)
+	{
+		uint32_t i;
+		for (i = 0; i < ring_len; i++)
+		{
+			ring[i] = malloc(slot_size + SLOT_SLACK);
+			if (ring[i] == NULL) break;
+
+			ring_dscs[i].header = header;
+			ring_dscs[i].data_size = frame_size;
+			ring_dscs[i].data = ring[i];
+		}
+		if (i == ring_len) break;
+
+		while (i > 0) free(ring[--i]);
+	}
+	if (ring_len < 2)
+	{
+		LV_LOG_WARN("lv_holo_player_open: not enough memory for 2 frame buffers");
+		ring_len = 0;
+		free(frame_raws);
+		frame_raws = NULL;
+		anim_close();
+		return false;
+	}
+
+	player_img = img;
+	frame_head = 0;
+	frame_tail = 0;
+	reader_stop = 0;
+	reader_error = 0;
+	reader_done = 0;
+	stat_shown = 0;
+	stat_dropped = 0;
+	stat_bytes = 0;
+	stat_read_us = 0;
+	stat_raw = 0;
+	stat_last_ms = lv_tick_get();
+
+	reader_start();
+	play_task = lv_task_create(play_task_cb, 1000 / fps, LV_TASK_PRIO_MID, NULL);
+
+	return true;
+}
+
+void lv_holo_player_close(void)
+{
+	if (play_task == NULL) return;
+
+	lv_task_del(play_task);
+	play_task = NULL;
+
+	__atomic_store_n(&reader_stop, 1, __ATOMIC_SEQ_CST);
+	reader_wake();
+	reader_join();
+
+	lv_img_set_src(player_img, NULL);
+	lv_obj_invalidate(player_img);
+
+	uint32_t i;
+	for (i = 0; i < ring_len; i++)
+	{
+		lv_img_cache_invalidate_src(&ring_dscs[i]);
+		free(ring[i]);
+		ring[i] = NULL;
+	}
+	ring_len = 0;
+
+	if (frame_raws)
+	{
+		for (i = 0; i < player_frame_cnt; i++) raw_close(&frame_raws[i]);
+		free(frame_raws);
+		frame_raws = NULL;
+	}
+	anim_close();
+}
+
+bool lv_holo_player_is_open(void)
+{
+	return play_task != NULL;
+}
+
+void lv_holo_player_get_stats(lv_holo_player_stats_t* stats)
+{
+	memset(stats, 0, sizeof(lv_holo_player_stats_t));
+
+	uint32_t now = lv_tick_get();
+	stats->frames_shown = stat_shown;
+	stats->frames_dropped = stat_dropped;
+	stats->bytes_read = __atomic_exchange_n(&stat_bytes, 0, __ATOMIC_RELAXED);
+	stats->read_us = __atomic_exchange_n(&stat_read_us, 0, __ATOMIC_RELAXED);
+	stats->frames_raw = __atomic_exchange_n(&stat_raw, 0, __ATOMIC_RELAXED);
+	stats->period_ms = now - stat_last_ms;
+	if (stats->period_ms) stats->fps = stats->frames_shown * 1000.0f / stats->period_ms;
+	if (stats->read_us) stats->read_kb_per_sec = stats->bytes_read * 1000.0f / 1024 / stats->read_us * 1000;
+
+	stat_shown = 0;
+	stat_dropped = 0;
+	stat_last_ms = now;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+ /* Show the next frame if the reader has it */
+static void play_task_cb(lv_task_t* task)
+{
+	uint32_t tail = frame_tail;
+	if (tail == __atomic_load_n(&frame_head, __ATOMIC_ACQUIRE))
+	{
+		if (__atomic_load_n(&reader_error, __ATOMIC_RELAXED))
+		{
+			LV_LOG_WARN("lv_holo_player: can't read the frames, stopped");
+			lv_holo_player_close();
+			return;
+		}
+
+		/* Still waiting for the first frame is not a drop */
+		if (tail > 0) stat_dropped++;
+		return;
+	}
+
+	if (delta_mode)
+	{
+		/* The image decoder uses `anim_frame` directly, the source doesn't change */
+		if (!lv_holo_anim_frame_apply(&anim_header, anim_entries[tail % player_frame_cnt].size,
+			ring_dscs[tail % ring_len].data, anim_frame, player_img))
+		{
+			LV_LOG_WARN("lv_holo_player: damaged frame, stopped");
+			lv_holo_player_close();
+			return;
+		}
+		if (tail == 0) lv_img_set_src(player_img, &anim_dsc);
+	}
+	else
+	{
+		/* The same descriptor is reused for another frame */
+		lv_img_dsc_t* dsc = &ring_dscs[tail % ring_len];
+		lv_img_cache_invalidate_src(dsc);
+		lv_img_set_src(player_img, dsc);
+	}
+	stat_shown++;
+
+	/* The previous frame's buffer is free now */
+	__atomic_store_n(&frame_tail, tail + 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&reader_sleeping, __ATOMIC_SEQ_CST)) reader_wake();
+}
+
+static bool frame_exists(uint32_t id)
+{
+	char path[LV_HOLO_PLAYER_PATH_MAX];
+	frame_path(id, path);
+
+	file_t f;
+	if (!file_open(&f, path)) return false;
+	file_close(&f);
+	return true;
+}
+
+static void frame_path(uint32_t id, char* path)
+{
+	snprintf(path, LV_HOLO_PLAYER_PATH_MAX, player_path_fmt, (int)id);
+}
+
+/* Read the image data of frame `id` into `buf`, or only its header and size if `buf` is NULL */
+static bool frame_read(uint32_t id, uint8_t* buf, uint32_t size, lv_img_header_t* header)
+{
+	char path[LV_HOLO_PLAYER_PATH_MAX];
+	frame_path(id, path);
+
+	file_t f;
+	if (!file_open(&f, path)) return false;
+
+	bool ok;
+	uint32_t size_in_file = file_size(&f);
+	if (buf) ok = file_seek(&f, sizeof(lv_img_header_t)) && file_read(&f, buf, size) == size;
+	else ok = file_read(&f, header, sizeof(lv_img_header_t)) == sizeof(lv_img_header_t);
+	file_close(&f);
+
+	if (buf == NULL && ok)
+	{
+		if (size_in_file <= sizeof(lv_img_header_t)) return false;
+		frame_size = size_in_file - sizeof(lv_img_header_t);
+	}
+	return ok;
+}
+
+/* Read the image data of frame `id` into the ring buffer `slot`, returns where it is in `slot` */
+static uint8_t* frame_load(uint32_t id, uint8_t* slot)
+{
+	raw_file_t* raw = frame_raws ? &frame_raws[id] : NULL;
+	if (raw && !raw->checked)
+	{
+		char path[LV_HOLO_PLAYER_PATH_MAX];
+		frame_path(id, path);
+		raw->ok = sd_raw_open(path, &raw->file);
+		raw->checked = true;
+		if (raw->ok && raw->file.size != sizeof(lv_img_header_t) + frame_size)
+		{
+			sd_raw_close(&raw->file);
+			raw->ok = false;
+		}
+	}
+
+	if (raw && raw->ok) return raw_read(&raw->file, sizeof(lv_img_header_t), frame_size, slot);
+	return frame_read(id, slot, frame_size, NULL) ? slot : NULL;
+}
+
+/* Read the header and the offset table, the file is kept open until anim_close() */
+static bool anim_open(const char* path)
+{
+	if (!file_open(&anim_file, path)) return false;
+
+	uint32_t table_size;
+	if (file_read(&anim_file, &anim_header, sizeof(anim_header)) != sizeof(anim_header) ||
+		!lv_holo_anim_header_check(&anim_header) || anim_header.frame_cnt == 0)
+	{
+		file_close(&anim_file);
+		return false;
+	}
+
+	table_size = anim_header.frame_cnt * sizeof(lv_holo_anim_entry_t);
+	anim_entries = malloc(table_size);
+	if (anim_entries == NULL || file_read(&anim_file, anim_entries, table_size) != table_size)
+	{
+		anim_close();
+		return false;
+	}
+
+	frame_size = lv_holo_anim_frame_size(&anim_header);
+	slot_size = frame_size;
+#if LV_HOLO_PLAYER_RAW
+	anim_raw.ok = sd_raw_open(path, &anim_raw.file);
+	anim_raw.checked = true;
+#endif
+	delta_mode = anim_header.tile_size != 0;
+	if (delta_mode)
+	{
+		/* The largest stored frame, usually a key frame */
+		uint32_t i;
+		slot_size = 0;
+		for (i = 0; i < anim_header.frame_cnt; i++)
+		{
+			slot_size = LV_MATH_MAX(slot_size, anim_entries[i].size & LV_HOLO_ANIM_SIZE_MASK);
+		}
+
+		anim_frame = malloc(frame_size);
+		if (anim_frame == NULL)
+		{
+			anim_close();
+			return false;
+		}
+		anim_dsc.header = anim_header.header;
+		anim_dsc.data_size = frame_size;
+		anim_dsc.data = anim_frame;
+	}
+	return true;
+}
+
+/* Read or decompress frame `id` into `slot`, returns where it is in `slot` */
+static uint8_t* anim_frame_read(uint32_t id, uint8_t* slot)
+{
+	const lv_holo_anim_entry_t* entry = &anim_entries[id];
+	if ((entry->size & LV_HOLO_ANIM_RLE) == 0)
+	{
+		if (entry->size != frame_size) return NULL;
+		if (anim_raw.ok) return raw_read(&anim_raw.file, entry->offset, frame_size, slot);
+		return file_seek(&anim_file, entry->offset) && file_read(&anim_file, slot, frame_size) == frame_size ?
+			slot : NULL;
+	}
+
+	/* Decompressed while reading, with FATFS */
+	if (!file_seek(&anim_file, entry->offset)) return NULL;
+
+	lv_holo_anim_rle_t rle;
+	lv_holo_anim_rle_init(&rle, anim_header.rle_unit);
+	uint32_t in_left = entry->size & LV_HOLO_ANIM_SIZE_MASK;
+	uint32_t out = 0;
+	while (out < frame_size && in_left > 0)
+	{
+		uint32_t in_len = file_read(&anim_file, anim_in_buf, LV_MATH_MIN(in_left, sizeof(anim_in_buf)));
+		if (in_len == 0) return NULL;
+		in_left -= in_len;
+
+		uint32_t used;
+		out += lv_holo_anim_rle_decode(&rle, anim_in_buf, in_len, &used, &slot[out], frame_size - out);
+	}
+	return out == frame_size ? slot : NULL;
+}
+
+/* Read frame `id` as it is stored into `slot` for lv_holo_anim_frame_apply(), returns where it is in `slot` */
+static uint8_t* anim_entry_read(uint32_t id, uint8_t* slot)
+{
+	uint32_t offset = anim_entries[id].offset;
+	uint32_t size = anim_entries[id].size & LV_HOLO_ANIM_SIZE_MASK;
+	if (anim_raw.ok) return raw_read(&anim_raw.file, offset, size, slot);
+	return file_seek(&anim_file, offset) && file_read(&anim_file, slot, size) == size ? slot : NULL;
+}
+
+static void anim_close(void)
+{
+	if (!anim_mode) return;
+
+	if (anim_frame)
+	{
+		lv_img_cache_invalidate_src(&anim_dsc);
+		free(anim_frame);
+		anim_frame = NULL;
+	}
+	delta_mode = false;
+
+	file_close(&anim_file);
+	raw_close(&anim_raw);
+	free(anim_entries);
+	anim_entries = NULL;
+	anim_mode = false;
+}
+
+/* Read `len` bytes from `pos` of a contiguous file into `slot` with one multi-block read,
+ * returns where they are in `slot` */
+static uint8_t* raw_read(const sd_raw_file_t* file, uint32_t pos, uint32_t len, uint8_t* slot)
+{
+	if (!sd_raw_read(file, pos / SD_RAW_SECTOR, slot, sd_raw_sector_cnt(pos, len))) return NULL;
+	__atomic_fetch_add(&stat_raw, 1, __ATOMIC_RELAXED);
+
+	/* The pixels are read as 16 and 32 bit words */
+	uint8_t* data = slot + pos % SD_RAW_SECTOR;
+	if ((uintptr_t)data & 3)
+	{
+		memmove(slot, data, len);
+		data = slot;
+	}
+	return data;
+}
+
+static void raw_close(raw_file_t* raw)
+{
+	if (raw->ok) sd_raw_close(&raw->file);
+	raw->ok = false;
+	raw->checked = false;
+}
+
+static void reader_loop(void)
+{
+	while (!__atomic_load_n(&reader_stop, __ATOMIC_SEQ_CST))
+	{
+		/* Keep the slot of the frame on the screen */
+		uint32_t head = frame_head;
+		if (head - __atomic_load_n(&frame_tail, __ATOMIC_ACQUIRE) >= ring_len - 1)
+		{
+			/* Announce the sleep first, then check again so a wake up can't be missed */
+			__atomic_store_n(&reader_sleeping, 1, __ATOMIC_SEQ_CST);
+			if (head - __atomic_load_n(&frame_tail, __ATOMIC_SEQ_CST) >= ring_len - 1 &&
+				!__atomic_load_n(&reader_stop, __ATOMIC_SEQ_CST))
+			{
+				reader_sleep();
+			}
+			__atomic_store_n(&reader_sleeping, 0, __ATOMIC_SEQ_CST);
+			continue;
+		}
+
+		uint32_t id = head % player_frame_cnt;
+		uint32_t start = time_us();
+		uint8_t* slot = ring[head % ring_len];
+		uint8_t* data;
+		if (delta_mode) data = anim_entry_read(id, slot);
+		else if (anim_mode) data = anim_frame_read(id, slot);
+		else data = frame_load(id, slot);
+		if (data == NULL)
+		{
+			__atomic_store_n(&reader_error, 1, __ATOMIC_SEQ_CST);
+			break;
+		}
+		ring_dscs[head % ring_len].data = data;
+		__atomic_fetch_add(&stat_read_us, time_us() - start, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&stat_bytes, anim_mode ? anim_entries[id].size & LV_HOLO_ANIM_SIZE_MASK : frame_size,
+			__ATOMIC_RELAXED);
+
+		__atomic_store_n(&frame_head, head + 1, __ATOMIC_RELEASE);
+	}
+}
+
+#if defined(ESP_PLATFORM)
+static uint32_t time_us(void)
+{
+	return (uint32_t)esp_timer_get_time();
+}
+
+static bool file_open(file_t* f, const char* path)
+{
+	return f_open(f, path, FA_READ) == FR_OK;
+}
+
+static uint32_t file_size(file_t* f)
+{
+	return f_size(f);
+}
+
+static bool file_seek(file_t* f, uint32_t pos)
+{
+	return f_lseek(f, pos) == FR_OK;
+}
+
+static uint32_t file_read(file_t* f, void* buf, uint32_t len)
+{
+	UINT br;
+	if (f_read(f, buf, len, &br) != FR_OK) return 0;
+	return br;
+}
+
+static void file_close(file_t* f)
+{
+	f_close(f);
+}
+
+static void reader_task_cb(void* param)
+{
+	reader_loop();
+
+	/* Deleted by reader_join(), so reader_wake() never notifies a deleted task */
+	__atomic_store_n(&reader_done, 1, __ATOMIC_SEQ_CST);
+	for (;;) vTaskDelay(portMAX_DELAY);
+}
+
+static void reader_start(void)
+{
+	xTaskCreatePinnedToCore(reader_task_cb, "holo_player", 4096, NULL,
+		LV_HOLO_PLAYER_PRIO, &reader_task, LV_HOLO_PLAYER_CORE);
+}
+
+static void reader_join(void)
+{
+	/* At most one frame is being read */
+	while (!__atomic_load_n(&reader_done, __ATOMIC_SEQ_CST)) vTaskDelay(1);
+	vTaskDelete(reader_task);
+}
+
+static void reader_sleep(void)
+{
+	ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void reader_wake(void)
+{
+	xTaskNotifyGive(reader_task);
+}
+#else
+static uint32_t time_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static bool file_open(file_t* f, const char* path)
+{
+	*f = fopen(path, "rb");
+	return *f != NULL;
+}
+
+static uint32_t file_size(file_t* f)
+{
+	long pos = ftell(*f);
+	fseek(*f, 0, SEEK_END);
+	long size = ftell(*f);
+	fseek(*f, pos, SEEK_SET);
+	return size;
+}
+
+static bool file_seek(file_t* f, uint32_t pos)
+{
+	return fseek(*f, pos, SEEK_SET) == 0;
+}
+
+static uint32_t file_read(file_t* f, void* buf, uint32_t len)
+{
+	return fread(buf, 1, len, *f);
+}
+
+static void file_close(file_t* f)
+{
+	fclose(*f);
+}
+
+static void* reader_thread_cb(void* param)
+{
+	reader_loop();
+	return NULL;
+}
+
+static void reader_start(void)
+{
+	reader_woken = false;
+	pthread_create(&reader_thread, NULL, reader_thread_cb, NULL);
+}
+
+static void reader_join(void)
+{
+	pthread_join(reader_thread, NULL);
+}
+
+static void reader_sleep(void)
+{
+	pthread_mutex_lock(&reader_mutex);
+	while (!reader_woken) pthread_cond_wait(&reader_cond, &reader_mutex);
+	reader_woken = false;
+	pthread_mutex_unlock(&reader_mutex);
+}
+
+static void reader_wake(void)
+{
+	pthread_mutex_lock(&reader_mutex);
+	reader_woken = true;
+	pthread_cond_signal(&reader_cond);
+	pthread_mutex_unlock(&reader_mutex);
+}
+#endif
@@ -0,0 +1,477 @@
+/**
+ * @file lv_holo_prefetch.c
+ * Read-ahead of SD card images. The LVGL core queues the images into slots, the worker
+ * on the other core loads them. Slot states are handed over with atomics:
+ * FREE/READY/FAILED -> QUEUED by the LVGL core, QUEUED -> LOADING -> READY/FAILED by the worker,
+ * QUEUED -> FREE when the LVGL core takes a queued slot back.
+ * The worker reads with FATFS directly (LVGL's lv_fs is not thread safe), on a PC build with stdio.
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_holo_prefetch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "ff.h"
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum
+{
+	SLOT_FREE,
+	SLOT_QUEUED,
+	SLOT_LOADING,
+	SLOT_READY,
+	SLOT_FAILED,
+} slot_state_t;
+
+typedef struct
+{
+	uint32_t state;				/* slot_state_t */
+	uint32_t seq;				/* order of the requests, the worker takes the oldest */
+	uint32_t size;				/* of the loaded file */
+	uint32_t refs;				/* decoder sessions using `data`, LVGL core only */
+	char src[LV_HOLO_PREFETCH_PATH_MAX];
+	uint8_t* data;				/* the whole .bin file */
+} slot_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+static slot_t* slot_find(const char* src);
+static slot_t* slot_ready(const char* src);
+static bool slot_queue(const char* src, uint32_t keep_seq);
+static void request_next(const char* src);
+static bool slot_load(slot_t* slot);
+static uint32_t time_us(void);
+
+static void worker_loop(void);
+static void worker_start(void);
+static void worker_sleep(void);
+static void worker_wake(void);
+static void worker_yield(void);
+static void* dma_malloc(uint32_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static slot_t slots[LV_HOLO_PREFETCH_SLOT_MAX];
+static uint32_t slot_cnt;
+static uint32_t slot_size;
+static uint32_t seq_next;
+static char file_root[LV_HOLO_PREFETCH_PATH_MAX];
+static uint32_t worker_sleeping;
+
+static uint32_t stat_hits;
+static uint32_t stat_misses;
+static uint32_t stat_stalls;
+static uint32_t stat_stall_us;
+static uint32_t stat_loads;
+static uint32_t stat_bytes;
+static uint32_t stat_read_us;
+
+#if defined(ESP_PLATFORM)
+static TaskHandle_t worker_task;
+#else
+static pthread_t worker_thread;
+static pthread_mutex_t worker_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t worker_cond = PTHREAD_COND_INITIALIZER;
+static bool worker_woken;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_holo_prefetch_init(const char* root, uint32_t cnt, uint32_t size)
+{
+	if (slot_cnt) return true;
+
+	strncpy(file_root, root, LV_HOLO_PREFETCH_PATH_MAX - 1);
+	file_root[LV_HOLO_PREFETCH_PATH_MAX - 1] = '\0';
+
+	/* DMA capable so the SD driver can read into the buffers without bouncing */
+	cnt = LV_MATH_MIN(cnt, LV_HOLO_PREFETCH_SLOT_MAX);
+	uint32_t i;
+	for (i = 0; i < cnt; i++)
+	{
+		slots[i].data = dma_malloc(size);
+		if (slots[i].data == NULL) break;
+		slots[i].state = SLOT_FREE;
+	}
+	if (i == 0)
+	{
+		LV_LOG_WARN("lv_holo_prefetch_init: not enough memory");
+		return false;
+	}
+	slot_cnt = i;
+	slot_size = size;
+
+	worker_start();
+
+	lv_img_decoder_t* decoder = lv_img_decoder_create();
+	lv_img_decoder_set_info_cb(decoder, decoder_info);
+	lv_img_decoder_set_open_cb(decoder, decoder_open);
+	lv_img_decoder_set_read_line_cb(decoder, lv_img_decoder_built_in_read_line);
+	lv_img_decoder_set_close_cb(decoder, decoder_close);
+	return true;
+}
+
+void lv_holo_prefetch_request(const char* src)
+{
+	if (slot_cnt == 0 || strlen(src) >= LV_HOLO_PREFETCH_PATH_MAX) return;
+
+	if (slot_queue(src, seq_next)) worker_wake();
+}
+
+void lv_holo_prefetch_get_stats(lv_holo_prefetch_stats_t* stats)
+{
+	stats->hits = stat_hits;
+	stats->misses = stat_misses;
+	stats->stalls = stat_stalls;
+	stats->stall_us = stat_stall_us;
+	stats->loads = __atomic_exchange_n(&stat_loads, 0, __ATOMIC_RELAXED);
+	stats->bytes_read = __atomic_exchange_n(&stat_bytes, 0, __ATOMIC_RELAXED);
+	stats->read_us = __atomic_exchange_n(&stat_read_us, 0, __ATOMIC_RELAXED);
+
+	stat_hits = 0;
+	stat_misses = 0;
+	stat_stalls = 0;
+	stat_stall_us = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+	if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return LV_RES_INV;
+
+	slot_t* slot = slot_ready(src);
+	if (slot)
+	{
+		memcpy(header, slot->data, sizeof(lv_img_header_t));
+		/* Refused like by LVGL's decoder, that logs why */
+		if (lv_img_header_byte_order_ok(header)) return LV_RES_OK;
+	}
+	return lv_img_decoder_built_in_info(decoder, src, header);
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	slot_t* slot = slot_find(dsc->src);
+	uint32_t state = slot ? __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) : SLOT_FREE;
+	if (state == SLOT_QUEUED)
+	{
+		/* Not started yet, LVGL reads it now */
+		__atomic_compare_exchange_n(&slot->state, &state, SLOT_FREE, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	}
+	if (slot && __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) == SLOT_LOADING)
+	{
+		/* Finishing the read is faster than starting it again */
+		uint32_t start = time_us();
+		while (__atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) == SLOT_LOADING) worker_yield();
+		stat_stalls++;
+		stat_stall_us += time_us() - start;
+	}
+
+	/* LVGL draws the true color formats directly from the buffer */
+	lv_img_cf_t cf = dsc->header.cf;
+	bool direct = cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
+		cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+	slot = direct ? slot_ready(dsc->src) : NULL;
+	if (slot) slot->refs++;
+
+	request_next(dsc->src);
+
+	if (slot == NULL)
+	{
+		stat_misses++;
+		return lv_img_decoder_built_in_open(decoder, dsc);
+	}
+
+	stat_hits++;
+	memcpy(&dsc->header, slot->data, sizeof(lv_img_header_t));
+	dsc->img_data = slot->data + sizeof(lv_img_header_t);
+	dsc->user_data = NULL;
+	return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	uint32_t i;
+	for (i = 0; i < slot_cnt; i++)
+	{
+		if (dsc->img_data == slots[i].data + sizeof(lv_img_header_t))
+		{
+			slots[i].refs--;
+			return;
+		}
+	}
+	lv_img_decoder_built_in_close(decoder, dsc);
+}
+
+/* The slot of `src` if it is queued, being loaded or loaded */
+static slot_t* slot_find(const char* src)
+{
+	uint32_t i;
+	for (i = 0; i < slot_cnt; i++)
+	{
+		uint32_t state = __atomic_load_n(&slots[i].state, __ATOMIC_ACQUIRE);
+		if (state != SLOT_FREE && state != SLOT_FAILED && strcmp(slots[i].src, src) == 0) return &slots[i];
+	}
+	return NULL;
+}
+
+static slot_t* slot_ready(const char* src)
+{
+	slot_t* slot = slot_find(src);
+	if (slot && __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) == SLOT_READY) return slot;
+	return NULL;
+}
+
+/* Queue `src` into a slot not used by the decoder, the oldest one first.
+ * Slots requested since `keep_seq` are kept. Returns true if the worker has new work */
+static bool slot_queue(const char* src, uint32_t keep_seq)
+{
+	slot_t* slot = slot_find(src);
+	if (slot)
+	{
+		slot->seq = seq_next++;
+		return false;
+	}
+
+	slot_t* victim = NULL;
+	uint32_t i;
+	for (i = 0; i < slot_cnt; i++)
+	{
+		uint32_t state = __atomic_load_n(&slots[i].state, __ATOMIC_ACQUIRE);
+		if (state == SLOT_LOADING || slots[i].refs) continue;
+		if (state != SLOT_FREE && state != SLOT_FAILED && (int32_t)(slots[i].seq - keep_seq) >= 0) continue;
+
+		if (state == SLOT_FREE || state == SLOT_FAILED)
+		{
+			victim = &slots[i];
+			break;
+		}
+		if (victim == NULL || (int32_t)(slots[i].seq - victim->seq) < 0) victim = &slots[i];
+	}
+	if (victim == NULL) return false;
+
+	/* The worker may have just started loading it */
+	uint32_t state = __atomic_load_n(&victim->state, __ATOMIC_ACQUIRE);
+	if (state == SLOT_QUEUED &&
+		!__atomic_compare_exchange_n(&victim->state, &state, SLOT_FREE, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+	{
+		return false;
+	}
+
+	strcpy(victim->src, src);
+	victim->seq = seq_next++;
+	__atomic_store_n(&victim->state, SLOT_QUEUED, __ATOMIC_RELEASE);
+	return true;
+}
+
+/* "S:/a/frame012.bin" -> "S:/a/frame013.bin", "S:/a/frame014.bin"... into all slots but the one shown */
+static void request_next(const char* src)
+{
+	const char* ext = strrchr(src, '.');
+	if (ext == NULL || strcmp(ext, ".bin") != 0) return;
+
+	const char* num = ext;
+	while (num > (const char*)src && num[-1] >= '0' && num[-1] <= '9') num--;
+	int width = ext - num;
+	if (width == 0 || width > 9) return;
+
+	char next[LV_HOLO_PREFETCH_PATH_MAX];
+	uint32_t n = strtoul(num, NULL, 10);
+	uint32_t ahead = slot_cnt > 1 ? slot_cnt - 1 : 1;
+	uint32_t keep_seq = seq_next;
+	bool queued = false;
+	uint32_t i;
+	for (i = 1; i <= ahead; i++)
+	{
+		int len = snprintf(next, sizeof(next), "%.*s%0*u%s", (int)(num - (const char*)src), (const char*)src,
+			width, n + i, ext);
+		if (len >= (int)sizeof(next)) return;
+		queued |= slot_queue(next, keep_seq);
+	}
+	if (queued) worker_wake();
+}
+
+/* Worker: read the file of a LOADING slot */
+static bool slot_load(slot_t* slot)
+{
+	char path[LV_HOLO_PREFETCH_PATH_MAX * 2];
+	const char* src = slot->src;
+	if (src[0] != '\0' && src[1] == ':') src += 2;	/* drive letter */
+	snprintf(path, sizeof(path), "%s%s", file_root, src);
+
+	uint32_t start = time_us();
+	uint32_t size = 0;
+	bool ok = false;
+#if defined(ESP_PLATFORM)
+	FIL fil;
+	UINT br;
+	if (f_open(&fil, path, FA_READ) != FR_OK) return false;
+	size = f_size(&fil);
+	ok = size > sizeof(lv_img_header_t) && size <= slot_size &&
+		f_read(&fil, slot->data, size, &br) == FR_OK && br == size;
+	f_close(&fil);
+#else
+	FILE* fp = fopen(path, "rb");
+	if (fp == NULL) return false;
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	ok = size > sizeof(lv_img_header_t) && size <= slot_size && fread(slot->data, 1, size, fp) == size;
+	fclose(fp);
+#endif
+	if (!ok) return false;
+
+	slot->size = size;
+	__atomic_fetch_add(&stat_read_us, time_us() - start, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&stat_bytes, size, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&stat_loads, 1, __ATOMIC_RELAXED);
+	return true;
+}
+
+static void worker_loop(void)
+{
+	for (;;)
+	{
+		/* The oldest request first */
+		slot_t* next = NULL;
+		uint32_t i;
+		for (i = 0; i < slot_cnt; i++)
+		{
+			if (__atomic_load_n(&slots[i].state, __ATOMIC_ACQUIRE) != SLOT_QUEUED) continue;
+			if (next == NULL || (int32_t)(slots[i].seq - next->seq) < 0) next = &slots[i];
+		}
+
+		if (next == NULL)
+		{
+			/* Announce the sleep first, then check again so a wake up can't be missed */
+			__atomic_store_n(&worker_sleeping, 1, __ATOMIC_SEQ_CST);
+			for (i = 0; i < slot_cnt; i++)
+			{
+				if (__atomic_load_n(&slots[i].state, __ATOMIC_SEQ_CST) == SLOT_QUEUED) break;
+			}
+			if (i == slot_cnt) worker_sleep();
+			__atomic_store_n(&worker_sleeping, 0, __ATOMIC_SEQ_CST);
+			continue;
+		}
+
+		/* The LVGL core can take a queued slot back until here */
+		uint32_t state = SLOT_QUEUED;
+		if (!__atomic_compare_exchange_n(&next->state, &state, SLOT_LOADING, false,
+			__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+		{
+			continue;
+		}
+
+		bool ok = slot_load(next);
+		__atomic_store_n(&next->state, ok ? SLOT_READY : SLOT_FAILED, __ATOMIC_RELEASE);
+	}
+}
+
+#if defined(ESP_PLATFORM)
+static uint32_t time_us(void)
+{
+	return (uint32_t)esp_timer_get_time();
+}
+
+static void* dma_malloc(uint32_t size)
+{
+	return heap_caps_malloc(size, MALLOC_CAP_DMA);
+}
+
+static void worker_task_cb(void* param)
+{
+	worker_loop();
+}
+
+static void worker_start(void)
+{
+	xTaskCreatePinnedToCore(worker_task_cb, "holo_prefetch", 4096, NULL,
+		LV_HOLO_PREFETCH_PRIO, &worker_task, LV_HOLO_PREFETCH_CORE);
+}
+
+static void worker_sleep(void)
+{
+	ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void worker_wake(void)
+{
+	if (__atomic_load_n(&worker_sleeping, __ATOMIC_SEQ_CST)) xTaskNotifyGive(worker_task);
+}
+
+static void worker_yield(void)
+{
+	vTaskDelay(1);
+}
+#else
+static uint32_t time_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void* dma_malloc(uint32_t size)
+{
+	return malloc(size);
+}
+
+static void* worker_thread_cb(void* param)
+{
+	worker_loop();
+	return NULL;
+}
+
+static void worker_start(void)
+{
+	pthread_create(&worker_thread, NULL, worker_thread_cb, NULL);
+}
+
+static void worker_sleep(void)
+{
+	pthread_mutex_lock(&worker_mutex);
+	while (!worker_woken) pthread_cond_wait(&worker_cond, &worker_mutex);
+	worker_woken = false;
+	pthread_mutex_unlock(&worker_mutex);
+}
+
+static void worker_wake(void)
+{
+	pthread_mutex_lock(&worker_mutex);
+	worker_woken = true;
+	pthread_cond_signal(&worker_cond);
+	pthread_mutex_unlock(&worker_mutex);
+}
+
+static void worker_yield(void)
+{
+	sched_yield();
+}
+#endif
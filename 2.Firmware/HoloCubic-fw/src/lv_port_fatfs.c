@@ -18,7 +18,11 @@
 	**********************/
 
 	/* Create a type to store the required data about your file.*/
-typedef  FIL file_t;
+typedef struct
+{
+	FIL fil;
+	lv_port_fs_cache_t cache;	/* its `pos` is the read/write pointer, FATFS is moved to it when needed */
+} file_t;
 
 /*Similarly to `file_t` create a type for directory reading too */
 typedef  FF_DIR dir_t;
@@ -42,10 +46,14 @@ static lv_fs_res_t fs_free(lv_fs_drv_t* drv, uint32_t* total_p, uint32_t* free_p
 static lv_fs_res_t fs_dir_open(lv_fs_drv_t* drv, void* dir_p, const char* path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t* drv, void* dir_p, char* fn);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t* drv, void* dir_p);
+static lv_fs_res_t fs_read_at(void* file_p, uint32_t pos, void* buf, uint32_t btr, uint32_t* br);
+static bool fs_lseek(file_t* file, uint32_t pos);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t cache_sectors = LV_PORT_FS_CACHE_SECTORS;
+static lv_fs_if_open_cb_t open_cb;
 
  /**********************
   *      MACROS
@@ -72,6 +80,7 @@ void lv_fs_if_init(void)
 
 	/*Set up fields...*/
 	fs_drv.file_size = sizeof(file_t);
+	fs_drv.file_extra_size = cache_sectors * LV_PORT_FS_CACHE_SECTOR;	/* the cache's buffer */
 	fs_drv.letter = DRIVE_LETTER;
 	fs_drv.open_cb = fs_open;
 	fs_drv.close_cb = fs_close;
@@ -93,6 +102,33 @@ void lv_fs_if_init(void)
 	lv_fs_drv_register(&fs_drv);
 }
 
+void lv_fs_if_set_open_cb(lv_fs_if_open_cb_t cb)
+{
+	open_cb = cb;
+}
+
+bool lv_fs_if_stat(const char* path, uint32_t* size, uint32_t* stamp)
+{
+	/* Like lv_fs gives the path to the driver */
+	if (path[0] != '\0' && path[1] == ':') path += 2;
+	while (*path == '/' || *path == '\\') path++;
+
+	FILINFO info;
+	if (f_stat(path, &info) != FR_OK || (info.fattrib & AM_DIR)) return false;
+
+	*size = info.fsize;
+	*stamp = (uint32_t)info.fdate << 16 | info.ftime;
+	return true;
+}
+
+void lv_fs_if_set_cache(uint32_t sectors)
+{
+	cache_sectors = sectors;
+
+	lv_fs_drv_t* drv = lv_fs_get_drv(DRIVE_LETTER);
+	if (drv) drv->file_extra_size = sectors * LV_PORT_FS_CACHE_SECTOR;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -127,11 +163,13 @@ static lv_fs_res_t fs_open(lv_fs_drv_t* drv, void* file_p, const char* path, lv_
 	else if (mode == LV_FS_MODE_RD) flags = FA_READ;
 	else if (mode == (LV_FS_MODE_WR | LV_FS_MODE_RD)) flags = FA_READ | FA_WRITE | FA_OPEN_ALWAYS;
 
-	FRESULT res = f_open((file_t*)file_p, path, flags);
+	file_t* file = file_p;
+	FRESULT res = f_open(&file->fil, path, flags);
 
 	if (res == FR_OK)
 	{
-		f_lseek((file_t*)file_p, 0);
+		lv_port_fs_cache_init(&file->cache, file, fs_read_at, cache_sectors);
+		if (open_cb) open_cb(path, (flags & FA_WRITE) != 0, f_size(&file->fil), file->fil.obj.sclust);
 		return LV_FS_RES_OK;
 	}
 	else
@@ -150,7 +188,9 @@ static lv_fs_res_t fs_open(lv_fs_drv_t* drv, void* file_p, const char* path, lv_
  */
 static lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p)
 {
-	f_close((file_t*)file_p);
+	file_t* file = file_p;
+	f_close(&file->fil);
+	lv_port_fs_cache_free(&file->cache);
 	return LV_FS_RES_OK;
 }
 
@@ -166,9 +206,7 @@ static lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p)
  */
 static lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br)
 {
-	FRESULT res = f_read((file_t*)file_p, buf, btr, (UINT*)br);
-	if (res == FR_OK) return LV_FS_RES_OK;
-	else return LV_FS_RES_UNKNOWN;
+	return lv_port_fs_cache_read(&((file_t*)file_p)->cache, buf, btr, br);
 }
 
 /**
@@ -182,7 +220,14 @@ static lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t b
  */
 static lv_fs_res_t fs_write(lv_fs_drv_t* drv, void* file_p, const void* buf, uint32_t btw, uint32_t* bw)
 {
-	FRESULT res = f_write((file_t*)file_p, buf, btw, (UINT*)bw);
+	file_t* file = file_p;
+	if (!fs_lseek(file, file->cache.pos)) return LV_FS_RES_UNKNOWN;
+
+	UINT n = 0;
+	FRESULT res = f_write(&file->fil, buf, btw, &n);
+	if (bw) *bw = n;
+	file->cache.pos += n;
+	lv_port_fs_cache_invalidate(&file->cache);
 	if (res == FR_OK) return LV_FS_RES_OK;
 	else return LV_FS_RES_UNKNOWN;
 }
@@ -197,7 +242,8 @@ static lv_fs_res_t fs_write(lv_fs_drv_t* drv, void* file_p, const void* buf, uin
  */
 static lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos)
 {
-	f_lseek((file_t*)file_p, pos);
+	/* Only remembered, the next read may be served from the cache */
+	((file_t*)file_p)->cache.pos = pos;
 	return LV_FS_RES_OK;
 }
 
@@ -210,7 +256,7 @@ static lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos)
  */
 static lv_fs_res_t fs_size(lv_fs_drv_t* drv, void* file_p, uint32_t* size_p)
 {
-	(*size_p) = f_size(((file_t*)file_p));
+	(*size_p) = f_size(&((file_t*)file_p)->fil);
 	return LV_FS_RES_OK;
 }
 
@@ -224,7 +270,7 @@ static lv_fs_res_t fs_size(lv_fs_drv_t* drv, void* file_p, uint32_t* size_p)
  */
 static lv_fs_res_t fs_tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p)
 {
-	*pos_p = f_tell(((file_t*)file_p));
+	*pos_p = ((file_t*)file_p)->cache.pos;
 	return LV_FS_RES_OK;
 }
 
@@ -252,8 +298,12 @@ static lv_fs_res_t fs_remove(lv_fs_drv_t* drv, const char* path)
  */
 static lv_fs_res_t fs_trunc(lv_fs_drv_t* drv, void* file_p)
 {
-	f_sync((file_t*)file_p);           /*If not syncronized fclose can write the truncated part*/
-	f_truncate((file_t*)file_p);
+	file_t* file = file_p;
+	if (!fs_lseek(file, file->cache.pos)) return LV_FS_RES_UNKNOWN;
+
+	f_sync(&file->fil);           /*If not syncronized fclose can write the truncated part*/
+	f_truncate(&file->fil);
+	lv_port_fs_cache_invalidate(&file->cache);
 	return LV_FS_RES_OK;
 }
 
@@ -266,6 +316,11 @@ static lv_fs_res_t fs_trunc(lv_fs_drv_t* drv, void* file_p)
  */
 static lv_fs_res_t fs_rename(lv_fs_drv_t* drv, const char* oldname, const char* newname)
 {
+	if (open_cb)
+	{
+		open_cb(oldname, true, 0, 0);
+		open_cb(newname, true, 0, 0);
+	}
 
 	FRESULT res = f_rename(oldname, newname);
 
@@ -345,4 +400,22 @@ static lv_fs_res_t fs_dir_close(lv_fs_drv_t* drv, void* dir_p)
 {
 	f_closedir((dir_t*)dir_p);
 	return LV_FS_RES_OK;
-}
\ No newline at end of file
+}
+
+/* Read callback of the cache, always from the start of a sector */
+static lv_fs_res_t fs_read_at(void* file_p, uint32_t pos, void* buf, uint32_t btr, uint32_t* br)
+{
+	file_t* file = file_p;
+	if (!fs_lseek(file, pos)) return LV_FS_RES_UNKNOWN;
+
+	FRESULT res = f_read(&file->fil, buf, btr, (UINT*)br);
+	if (res == FR_OK) return LV_FS_RES_OK;
+	else return LV_FS_RES_UNKNOWN;
+}
+
+/* Move the file pointer of FATFS if it's somewhere else (seeking back follows the cluster chain again) */
+static bool fs_lseek(file_t* file, uint32_t pos)
+{
+	if (f_tell(&file->fil) == pos) return true;
+	return f_lseek(&file->fil, pos) == FR_OK;
+}
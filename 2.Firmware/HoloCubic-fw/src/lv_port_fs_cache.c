@@ -0,0 +1,178 @@
+/**
+ * @file lv_port_fs_cache.c
+ * Read cache of an opened file (see lv_port_fs_cache.h)
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_port_fs_cache.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "esp_heap_caps.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SECTOR_MASK     (LV_PORT_FS_CACHE_SECTOR - 1)
+/* The files are read by the LVGL core and by the I/O workers at the same time */
+#define STAT_ADD(stat, n)   __atomic_fetch_add(&(stat), (n), __ATOMIC_RELAXED)
+#define STAT_TAKE(stat)     __atomic_exchange_n(&(stat), 0, __ATOMIC_RELAXED)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_fs_res_t cache_fill(lv_port_fs_cache_t* cache, uint32_t end, bool ahead);
+static void* dma_malloc(uint32_t size);
+static void dma_free(void* p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t stat_hits;
+static uint32_t stat_misses;
+static uint32_t stat_bytes_read;
+static uint32_t stat_bytes_file;
+static uint32_t stat_bytes_direct;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_fs_cache_init(lv_port_fs_cache_t* cache, void* file, lv_port_fs_cache_read_cb_t read_cb,
+	uint32_t sectors)
+{
+	cache->file = file;
+	cache->read_cb = read_cb;
+	cache->buf = NULL;
+	cache->buf_size = sectors * LV_PORT_FS_CACHE_SECTOR;
+	cache->buf_pos = 0;
+	cache->buf_len = 0;
+	cache->pos = 0;
+	cache->prev_end = UINT32_MAX;	/* no read-ahead for the first read, it's often only a header */
+}
+
+void lv_port_fs_cache_free(lv_port_fs_cache_t* cache)
+{
+	if (cache->buf) dma_free(cache->buf);
+	cache->buf = NULL;
+	cache->buf_len = 0;
+}
+
+lv_fs_res_t lv_port_fs_cache_read(lv_port_fs_cache_t* cache, void* buf, uint32_t btr, uint32_t* br)
+{
+	uint8_t* out = buf;
+	uint32_t left = btr;
+	bool ahead = cache->pos == cache->prev_end;
+	bool missed = false;
+	lv_fs_res_t res = LV_FS_RES_OK;
+
+	if (cache->buf_size && cache->buf == NULL)
+	{
+		cache->buf = dma_malloc(cache->buf_size);
+		if (cache->buf == NULL) cache->buf_size = 0;
+	}
+
+	while (left > 0)
+	{
+		/* Cached part */
+		if (cache->pos >= cache->buf_pos && cache->pos < cache->buf_pos + cache->buf_len)
+		{
+			uint32_t n = LV_MATH_MIN(left, cache->buf_pos + cache->buf_len - cache->pos);
+			memcpy(out, &cache->buf[cache->pos - cache->buf_pos], n);
+			out += n;
+			left -= n;
+			cache->pos += n;
+			continue;
+		}
+
+		missed = true;
+
+		/* Whole sectors (or everything without a cache) straight into the reader's buffer */
+		uint32_t direct = cache->buf_size ? left & ~SECTOR_MASK : left;
+		if (direct > 0 && (cache->buf_size == 0 || (cache->pos & SECTOR_MASK) == 0))
+		{
+			uint32_t rn = 0;
+			res = cache->read_cb(cache->file, cache->pos, out, direct, &rn);
+			STAT_ADD(stat_bytes_file, rn);
+			STAT_ADD(stat_bytes_direct, rn);
+			out += rn;
+			left -= rn;
+			cache->pos += rn;
+			if (res != LV_FS_RES_OK || rn < direct) break;
+			continue;
+		}
+
+		/* The sectors of the rest, or the whole cache if reading goes on */
+		res = cache_fill(cache, cache->pos + left, ahead);
+		if (res != LV_FS_RES_OK || cache->pos >= cache->buf_pos + cache->buf_len) break;	/* end of the file */
+	}
+
+	if (missed) STAT_ADD(stat_misses, 1);
+	else STAT_ADD(stat_hits, 1);
+	STAT_ADD(stat_bytes_read, btr - left);
+
+	cache->prev_end = cache->pos;
+	*br = btr - left;
+	return res;
+}
+
+void lv_port_fs_cache_invalidate(lv_port_fs_cache_t* cache)
+{
+	cache->buf_len = 0;
+	cache->prev_end = UINT32_MAX;
+}
+
+void lv_port_fs_cache_get_stats(lv_port_fs_cache_stats_t* stats)
+{
+	stats->hits = STAT_TAKE(stat_hits);
+	stats->misses = STAT_TAKE(stat_misses);
+	stats->bytes_read = STAT_TAKE(stat_bytes_read);
+	stats->bytes_file = STAT_TAKE(stat_bytes_file);
+	stats->bytes_direct = STAT_TAKE(stat_bytes_direct);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Read the sectors from `cache->pos` to `end` into the cache, or as many as fit if `ahead` */
+static lv_fs_res_t cache_fill(lv_port_fs_cache_t* cache, uint32_t end, bool ahead)
+{
+	uint32_t start = cache->pos & ~SECTOR_MASK;
+	uint32_t len = cache->buf_size;
+	if (!ahead) len = LV_MATH_MIN(len, ((end - start) + SECTOR_MASK) & ~SECTOR_MASK);
+
+	uint32_t rn = 0;
+	lv_fs_res_t res = cache->read_cb(cache->file, start, cache->buf, len, &rn);
+	STAT_ADD(stat_bytes_file, rn);
+	cache->buf_pos = start;
+	cache->buf_len = res == LV_FS_RES_OK ? rn : 0;
+	return res;
+}
+
+#if defined(ESP_PLATFORM)
+/* The SD driver reads into DMA capable buffers without bouncing */
+static void* dma_malloc(uint32_t size)
+{
+	return heap_caps_malloc(size, MALLOC_CAP_DMA);
+}
+
+static void dma_free(void* p)
+{
+	heap_caps_free(p);
+}
+#else
+static void* dma_malloc(uint32_t size)
+{
+	return malloc(size);
+}
+
+static void dma_free(void* p)
+{
+	free(p);
+}
+#endif
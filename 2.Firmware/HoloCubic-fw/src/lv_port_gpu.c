@@ -0,0 +1,367 @@
+/**
+ * @file lv_port_gpu.c
+ * Share LVGL's large fills and blends between the two cores.
+ * The LVGL core keeps one half of the rows, a worker on the other core does the rest.
+ * LVGL blends line by line, the lines of an area are collected into one band first,
+ * so an area costs one job and one wake up of the worker.
+ * On a PC build a pthread stands in for the second core.
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "lv_port_gpu.h"
+
+#if LV_USE_GPU
+
+#if defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#else
+#include <pthread.h>
+#endif
+
+  /**********************
+   *      TYPEDEFS
+   **********************/
+typedef enum
+{
+	GPU_JOB_FILL,
+	GPU_JOB_BLEND,
+} gpu_job_type_t;
+
+typedef struct
+{
+	gpu_job_type_t type;
+	lv_color_t* dest;
+	const lv_color_t* src;
+	lv_color_t color;
+	int32_t dest_w;     /* stride of `dest` in pixels */
+	int32_t src_w;      /* stride of `src` in pixels, 0: the same line for every row */
+	int32_t w;
+	int32_t h;
+	lv_opa_t opa;
+} gpu_job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void gpu_fill(lv_disp_drv_t* disp_drv, lv_color_t* dest_buf, lv_coord_t dest_width,
+	const lv_area_t* fill_area, lv_color_t color);
+static void gpu_blend(lv_disp_drv_t* disp_drv, lv_color_t* dest, const lv_color_t* src, uint32_t length,
+	lv_opa_t opa);
+static void gpu_wait(lv_disp_drv_t* disp_drv);
+
+static bool band_add(lv_color_t* dest, const lv_color_t* src, uint32_t length, lv_opa_t opa);
+static void band_run(void);
+static void job_split(gpu_job_t* job);
+static void job_run(const gpu_job_t* job);
+static bool job_post(const gpu_job_t* job);
+static void worker_start(void);
+static void worker_sleep(void);
+static void worker_wake(void);
+static void lvgl_sleep(void);
+static void lvgl_wake(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* Single producer (LVGL core), single consumer (worker) */
+static gpu_job_t jobs[LV_PORT_GPU_QUEUE_LEN];
+static uint32_t job_head;
+static uint32_t job_tail;
+static uint32_t worker_sleeping;
+static uint32_t lvgl_waiting;
+
+/* Blended lines of the current area, not started yet (`h` 0: none) */
+static gpu_job_t band;
+
+#if defined(ESP_PLATFORM)
+static TaskHandle_t worker_task;
+static TaskHandle_t lvgl_task;
+#else
+static pthread_t worker_thread;
+static pthread_mutex_t worker_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t worker_cond = PTHREAD_COND_INITIALIZER;
+static bool worker_woken;
+static pthread_mutex_t lvgl_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t lvgl_cond = PTHREAD_COND_INITIALIZER;
+static bool lvgl_woken;
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_gpu_init(lv_disp_drv_t* disp_drv)
+{
+#if defined(ESP_PLATFORM)
+	/* gpu_wait() sleeps in the task that renders */
+	lvgl_task = xTaskGetCurrentTaskHandle();
+#endif
+	worker_start();
+
+	disp_drv->gpu_fill_cb = gpu_fill;
+	disp_drv->gpu_blend_cb = gpu_blend;
+	disp_drv->gpu_wait_cb = gpu_wait;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+ /* Called for opaque fills bigger than LVGL's GPU_SIZE_LIMIT */
+static void gpu_fill(lv_disp_drv_t* disp_drv, lv_color_t* dest_buf, lv_coord_t dest_width,
+	const lv_area_t* fill_area, lv_color_t color)
+{
+	gpu_job_t job;
+	job.type = GPU_JOB_FILL;
+	job.dest = dest_buf + dest_width * fill_area->y1 + fill_area->x1;
+	job.src = NULL;
+	job.color = color;
+	job.dest_w = dest_width;
+	job.w = lv_area_get_width(fill_area);
+	job.h = lv_area_get_height(fill_area);
+	job.src_w = 0;
+	job.opa = LV_OPA_COVER;
+
+	if (job.w * job.h < LV_PORT_GPU_FILL_MIN_PX || job.h < 2)
+	{
+		job_run(&job);
+		return;
+	}
+
+	/* Joined in gpu_wait() */
+	job_split(&job);
+}
+
+/* Called line by line, the lines are done in gpu_wait() that LVGL calls after the last one */
+static void gpu_blend(lv_disp_drv_t* disp_drv, lv_color_t* dest, const lv_color_t* src, uint32_t length,
+	lv_opa_t opa)
+{
+	if (band_add(dest, src, length, opa)) return;
+
+	/* Not the next line of the band, e.g. an other area without gpu_wait() in between */
+	band_run();
+	band.type = GPU_JOB_BLEND;
+	band.dest = dest;
+	band.src = src;
+	band.dest_w = length;
+	band.src_w = 0;
+	band.w = length;
+	band.h = 1;
+	band.opa = opa;
+}
+
+/* Join point: LVGL calls it before drawing, before reusing a blend source and before flushing */
+static void gpu_wait(lv_disp_drv_t* disp_drv)
+{
+	band_run();
+	if (__atomic_load_n(&job_tail, __ATOMIC_ACQUIRE) == job_head) return;
+
+	/* Announce the wait first, then check again so the worker's wake up can't be missed */
+	__atomic_store_n(&lvgl_waiting, 1, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(&job_tail, __ATOMIC_SEQ_CST) != job_head) lvgl_sleep();
+	__atomic_store_n(&lvgl_waiting, 0, __ATOMIC_SEQ_CST);
+}
+
+/* Append a line to the band if it's the next row of it. The second line sets the strides */
+static bool band_add(lv_color_t* dest, const lv_color_t* src, uint32_t length, lv_opa_t opa)
+{
+	if (band.h == 0 || (int32_t)length != band.w || opa != band.opa) return false;
+
+	if (band.h == 1)
+	{
+		if (dest < band.dest + band.w || src < band.src) return false;
+		band.dest_w = dest - band.dest;
+		band.src_w = src - band.src;
+	}
+	else if (dest != band.dest + band.dest_w * band.h || src != band.src + band.src_w * band.h)
+	{
+		return false;
+	}
+
+	band.h++;
+	return true;
+}
+
+static void band_run(void)
+{
+	if (band.h == 0) return;
+
+	gpu_job_t job = band;
+	band.h = 0;
+	if (job.w * job.h < LV_PORT_GPU_BLEND_MIN_PX || job.h < 2) job_run(&job);
+	else job_split(&job);
+}
+
+/* Upper half of the rows to the worker, lower half here */
+static void job_split(gpu_job_t* job)
+{
+	int32_t h_half = job->h / 2;
+	gpu_job_t bottom = *job;
+	bottom.dest += job->dest_w * h_half;
+	if (bottom.src) bottom.src += job->src_w * h_half;
+	bottom.h -= h_half;
+	job->h = h_half;
+
+	if (!job_post(job)) job_run(job);
+	job_run(&bottom);
+}
+
+static void job_run(const gpu_job_t* job)
+{
+	lv_color_t* dest = job->dest;
+	const lv_color_t* src = job->src;
+	int32_t y;
+	int32_t x;
+
+	if (job->type == GPU_JOB_FILL)
+	{
+		for (y = 0; y < job->h; y++)
+		{
+			lv_color_fill(dest, job->color, job->w);
+			dest += job->dest_w;
+		}
+	}
+	else if (job->opa > LV_OPA_MAX)
+	{
+		for (y = 0; y < job->h; y++)
+		{
+			_lv_memcpy(dest, src, job->w * sizeof(lv_color_t));
+			dest += job->dest_w;
+			src += job->src_w;
+		}
+	}
+	else
+	{
+		/* Like LVGL's software blend */
+		for (y = 0; y < job->h; y++)
+		{
+			for (x = 0; x < job->w; x++)
+			{
+				dest[x] = lv_color_mix(src[x], dest[x], job->opa);
+			}
+			dest += job->dest_w;
+			src += job->src_w;
+		}
+	}
+}
+
+/* Queue a job for the worker. Returns false if the queue is full */
+static bool job_post(const gpu_job_t* job)
+{
+	uint32_t head = job_head;
+	if (head - __atomic_load_n(&job_tail, __ATOMIC_ACQUIRE) >= LV_PORT_GPU_QUEUE_LEN) return false;
+
+	jobs[head % LV_PORT_GPU_QUEUE_LEN] = *job;
+	__atomic_store_n(&job_head, head + 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(&worker_sleeping, __ATOMIC_SEQ_CST)) worker_wake();
+	return true;
+}
+
+static void worker_loop(void)
+{
+	for (;;)
+	{
+		uint32_t tail = job_tail;
+		if (tail == __atomic_load_n(&job_head, __ATOMIC_ACQUIRE))
+		{
+			/* Announce the sleep first, then check again so a wake up can't be missed */
+			__atomic_store_n(&worker_sleeping, 1, __ATOMIC_SEQ_CST);
+			if (tail == __atomic_load_n(&job_head, __ATOMIC_SEQ_CST)) worker_sleep();
+			__atomic_store_n(&worker_sleeping, 0, __ATOMIC_SEQ_CST);
+			continue;
+		}
+
+		job_run(&jobs[tail % LV_PORT_GPU_QUEUE_LEN]);
+		__atomic_store_n(&job_tail, tail + 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&lvgl_waiting, __ATOMIC_SEQ_CST)) lvgl_wake();
+	}
+}
+
+#if defined(ESP_PLATFORM)
+static void worker_task_cb(void* param)
+{
+	worker_loop();
+}
+
+static void worker_start(void)
+{
+	xTaskCreatePinnedToCore(worker_task_cb, "lv_gpu", 2048, NULL,
+		LV_PORT_GPU_PRIO, &worker_task, LV_PORT_GPU_CORE);
+}
+
+static void worker_sleep(void)
+{
+	ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void worker_wake(void)
+{
+	xTaskNotifyGive(worker_task);
+}
+
+static void lvgl_sleep(void)
+{
+	ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void lvgl_wake(void)
+{
+	xTaskNotifyGive(lvgl_task);
+}
+#else
+static void* worker_thread_cb(void* param)
+{
+	worker_loop();
+	return NULL;
+}
+
+static void worker_start(void)
+{
+	pthread_create(&worker_thread, NULL, worker_thread_cb, NULL);
+}
+
+static void worker_sleep(void)
+{
+	pthread_mutex_lock(&worker_mutex);
+	while (!worker_woken) pthread_cond_wait(&worker_cond, &worker_mutex);
+	worker_woken = false;
+	pthread_mutex_unlock(&worker_mutex);
+}
+
+static void worker_wake(void)
+{
+	pthread_mutex_lock(&worker_mutex);
+	worker_woken = true;
+	pthread_cond_signal(&worker_cond);
+	pthread_mutex_unlock(&worker_mutex);
+}
+
+static void lvgl_sleep(void)
+{
+	pthread_mutex_lock(&lvgl_mutex);
+	while (!lvgl_woken) pthread_cond_wait(&lvgl_cond, &lvgl_mutex);
+	lvgl_woken = false;
+	pthread_mutex_unlock(&lvgl_mutex);
+}
+
+static void lvgl_wake(void)
+{
+	pthread_mutex_lock(&lvgl_mutex);
+	lvgl_woken = true;
+	pthread_cond_signal(&lvgl_cond);
+	pthread_mutex_unlock(&lvgl_mutex);
+}
+#endif
+
+#else /* LV_USE_GPU */
+
+void lv_port_gpu_init(lv_disp_drv_t* disp_drv)
+{
+	/* Nothing to do without `gpu_fill_cb` / `gpu_blend_cb` */
+}
+
+#endif /* LV_USE_GPU */
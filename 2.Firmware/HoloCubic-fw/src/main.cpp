@@ -4,17 +4,27 @@
 #include "ambient.h"
 #include "network.h"
 #include "sd_card.h"
+#include "sd_bench.h"
+#include "sd_config.h"
 #include "rgb_led.h"
 #include "lv_port_indev.h"
 #include "lv_port_fatfs.h"
 #include "lv_cubic_gui.h"
 #include "gui_guider.h"
+#include "lv_holo_player.h"
+#include "lv_holo_anim.h"
+#include "lv_holo_img.h"
+#include "lv_holo_jpeg.h"
+#include "lv_holo_prefetch.h"
+#include "lv_holo_meta.h"
+#include "lv_holo_io.h"
 
 /*** Component objects ***/
 Display screen;
 IMU mpu;
 Pixel rgb;
 SdCard tf;
+Config config;
 Network wifi;
 
 lv_ui guider_ui;
@@ -38,14 +48,44 @@ void setup()
     /*** Init micro SD-Card ***/
     tf.init();
     lv_fs_if_init();
+    lv_holo_io_init("");             // tf.*Async(), lv_holo_io_*(): SD card requests done on core 0
+    lv_holo_anim_decoder_init();
+    lv_holo_img_decoder_init();
+    lv_holo_jpeg_decoder_init();     // "S:/.../photo.jpg", scaled down to the screen
 
-    String ssid = tf.readFileLine("/wifi.txt", 1);        // line-1 for WiFi ssid
-    String password = tf.readFileLine("/wifi.txt", 2);    // line-2 for WiFi password
+    /*** Read ahead of "S:/.../frameNNN.bin" images shown with lv_img_set_src (2 frames of 200x200) ***/
+#if 0
+    lv_holo_prefetch_init("", 2, 4 + 200 * 200 * 2);
+#endif
+
+    /*** Headers of the image files seen before, after the other image decoders ***/
+    lv_holo_meta_init("S:/.holo_meta.idx", lv_fs_if_stat);
+    lv_fs_if_set_open_cb(lv_holo_meta_file_opened);  // sizes of the files read, the files written are forgotten
+
+    /*** Measure the SD card through Arduino's SD, FATFS, lv_fs and by sector address (a few minutes), results in /bench.csv ***/
+#if 0
+    SdBench bench;
+    bench.run("/bench.bin", "/bench.csv", "default");
+#endif
+
+    /*** Settings: /config.txt ("wifi.ssid = ..." lines), or the old /wifi.txt with the ssid in line 1, the password in line 2 ***/
+    static const char* const wifi_keys[] = { "wifi.ssid", "wifi.password" };
+    if (!config.load("/config.txt")) config.loadLines("/wifi.txt", wifi_keys, 2);
+    String ssid = config.getString("wifi.ssid");
+    String password = config.getString("wifi.password");
 
     /*** Inflate GUI objects ***/
     lv_holo_cubic_gui();
 //    setup_ui(&guider_ui);
 
+    /*** Play the holographic scene from the SD-Card ***/
+#if 0
+    setup_scr_scenes(&guider_ui);
+    lv_scr_load(guider_ui.scenes);
+    // Holo3D.hanim from get_holo_anim.py, or the old "/Scenes/Holo3D/frame%03d.bin" files with 138 frames at 25 FPS
+    lv_holo_player_open(guider_ui.scenes_canvas, "/Scenes/Holo3D.hanim", 0, 0);
+#endif
+
     /*** Read WiFi info from SD-Card, then scan & connect WiFi ***/
 #if 0
     wifi.init(ssid, password);
@@ -55,24 +95,140 @@ void setup()
 #endif
 }
 
-int frame_id = 0;
-char buf[100];
+#define IDLE_DELAY_MAX 20  // [ms] longest sleep in loop()
+#define STATS_REPORT 0     // 1: print the counters of the flush, refresh, player, read-ahead, io and caches once a second
+#define CONFIG_CHECK_PERIOD 30000  // [ms] how often the config file is checked for changes, 'r' on Serial: at once
+#define META_SAVE_PERIOD 60000     // [ms] how often the image header index is written if files were added
+
+unsigned long last_report_time = 0;
+unsigned long last_config_time = 0;
+unsigned long last_meta_time = 0;
+
+// read the config file again if it changed, a check stats the file on the SD card
+static void config_check()
+{
+    if (config.reload()) Serial.printf("config: %u keys reloaded\n", config.count());
+    last_config_time = millis();
+}
+
+#if LV_USE_REFR_PROF
+static void print_prof_line(const char* line)
+{
+    Serial.println(line);
+}
+#endif
+
+#if STATS_REPORT
+// how the LVGL core and the flush core overlap, and what the SD card readers and caches did
+static void print_stats()
+{
+    FlushStats stats;
+    screen.getFlushStats(&stats);
+    Serial.printf("flush: %.1f stripes/s, queue %u (max %u), stall %u us, busy %u us / %u ms, stack %u bytes free\n",
+                  stats.stripes_per_sec, stats.queue_depth, stats.queue_depth_max,
+                  stats.stall_us, stats.busy_us, stats.period_ms, stats.stack_free);
+#if LV_USE_REFR_GOV
+    lv_refr_gov_stats_t gov;
+    lv_refr_gov_get_stats(lv_disp_get_default(), &gov);
+    Serial.printf("refr: %u fps (target %u), %u missed, frame %u ms (max %u), period %u ms\n",
+                  gov.fps, gov.fps_target, gov.missed, gov.cost_avg, gov.cost_max, gov.period);
+#endif
+    if (lv_holo_player_is_open())
+    {
+        lv_holo_player_stats_t player;
+        lv_holo_player_get_stats(&player);
+        Serial.printf("player: %.1f fps, %u dropped, SD %.0f kB/s (%u us for %u bytes, %u frames by sectors)\n",
+                      player.fps, player.frames_dropped, player.read_kb_per_sec,
+                      player.read_us, player.bytes_read, player.frames_raw);
+    }
+    lv_holo_prefetch_stats_t prefetch;
+    lv_holo_prefetch_get_stats(&prefetch);
+    if (prefetch.hits + prefetch.misses)
+    {
+        Serial.printf("prefetch: %u hits, %u misses, %u stalls (%u us), SD %u bytes in %u us\n",
+                      prefetch.hits, prefetch.misses, prefetch.stalls, prefetch.stall_us,
+                      prefetch.bytes_read, prefetch.read_us);
+    }
+    lv_holo_meta_stats_t meta;
+    lv_holo_meta_get_stats(&meta);
+    if (meta.hits + meta.misses)
+    {
+        Serial.printf("img meta: %u hits, %u misses, %u changed, %u replaced, %u files\n",
+                      meta.hits, meta.misses, meta.changed, meta.replaced, meta.entry_cnt);
+    }
+    lv_holo_io_stats_t io;
+    lv_holo_io_get_stats(&io);
+    if (io.done + io.full)
+    {
+        Serial.printf("io: %u requests (%u failed, %u refused), %u bytes read, %u written, busy %u us, "
+                      "wait max %u/%u/%u us (low/mid/high)\n",
+                      io.done, io.failed, io.full, io.bytes_read, io.bytes_written, io.busy_us,
+                      io.wait_us_max[LV_HOLO_IO_PRIO_LOW], io.wait_us_max[LV_HOLO_IO_PRIO_MID],
+                      io.wait_us_max[LV_HOLO_IO_PRIO_HIGH]);
+    }
+    lv_img_cache_stats_t cache;
+    lv_img_cache_get_stats(&cache);
+    Serial.printf("img cache: %u hits, %u misses (%u ms to open), %u evicted, %u images in %u bytes\n",
+                  cache.hits, cache.misses, cache.open_time, cache.evictions, cache.entry_cnt, cache.size);
+    lv_port_fs_cache_stats_t fs_cache;
+    lv_port_fs_cache_get_stats(&fs_cache);
+    if (fs_cache.hits + fs_cache.misses)
+    {
+        Serial.printf("fs cache: %u hits, %u misses, %u bytes read, %u from the card (%u direct)\n",
+                      fs_cache.hits, fs_cache.misses, fs_cache.bytes_read, fs_cache.bytes_file,
+                      fs_cache.bytes_direct);
+    }
+}
+#endif
 
 void loop()
 {
-    // run this as often as possible
-    screen.routine();
+    // run this as often as LVGL needs it, idle screens are refreshed less often
+    uint32_t lvgl_idle_ms = screen.routine();
 
     // 200 means update IMU data every 200ms
     mpu.update(200);
 
-    Serial.println("hello");
-//    int len = sprintf(buf, "S:/Scenes/Holo3D/frame%03d.bin", frame_id++);
-//    buf[len] = 0;
-//    lv_img_set_src(guider_ui.scenes_canvas, buf);
-//    Serial.println(buf);
-//
-//    if (frame_id == 138) frame_id = 0;
+#if STATS_REPORT
+    if (millis() - last_report_time > 1000)
+    {
+        print_stats();
+        last_report_time = millis();
+    }
+#endif
 
+    if (millis() - last_meta_time > META_SAVE_PERIOD)
+    {
+        lv_holo_meta_save();  // only if files were added
+        last_meta_time = millis();
+    }
+
+    if (millis() - last_config_time > CONFIG_CHECK_PERIOD) config_check();
+
+    // send 'r' to check the config file now
+    // and with the render profiler 'p' to dump the profile as CSV, 'j' as JSON, 'c' to clear it
+    if (Serial.available())
+    {
+        switch (Serial.read())
+        {
+        case 'r':
+            config_check();
+            break;
+#if LV_USE_REFR_PROF
+        case 'p':
+            lv_refr_prof_dump(print_prof_line, LV_REFR_PROF_FMT_CSV);
+            break;
+        case 'j':
+            lv_refr_prof_dump(print_prof_line, LV_REFR_PROF_FMT_JSON);
+            break;
+        case 'c':
+            lv_refr_prof_clear();
+            break;
+#endif
+        }
+    }
     //delay(10);
+
+    // give the CPU away until the next LVGL task, but keep polling the IMU
+    if (lvgl_idle_ms > 0) delay(min(lvgl_idle_ms, (uint32_t)IDLE_DELAY_MAX));
 }
\ No newline at end of file
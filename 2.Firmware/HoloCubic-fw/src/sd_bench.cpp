@@ -0,0 +1,257 @@
+#include "sd_bench.h"
+#include "sd_card.h"
+#include "sd_raw.h"
+#include "lvgl.h"
+#include "ff.h"
+#include "esp_heap_caps.h"
+
+enum BenchMode
+{
+	BENCH_READ,    // existing file, read only
+	BENCH_CREATE,  // new empty file
+	BENCH_UPDATE,  // existing file, read and write
+};
+
+// The same calls on the file APIs
+class BenchFile
+{
+public:
+	virtual ~BenchFile() {}
+	virtual const char* name() = 0;
+	virtual bool open(const char* path, BenchMode mode) = 0;
+	virtual bool read(uint8_t* buf, uint32_t len) = 0;
+	virtual bool write(const uint8_t* buf, uint32_t len) = 0;
+	virtual bool seek(uint32_t pos) = 0;
+	virtual void close() = 0;
+	// Only reads whole sectors, the test file is written by the other APIs
+	virtual bool sectorsOnly() { return false; }
+};
+
+class ArduinoBenchFile : public BenchFile
+{
+private:
+	File file;
+
+public:
+	const char* name() { return "arduino"; }
+
+	bool open(const char* path, BenchMode mode)
+	{
+		const char* modes[] = { FILE_READ, FILE_WRITE, "r+" };
+		file = SD.open(path, modes[mode]);
+		return file;
+	}
+
+	bool read(uint8_t* buf, uint32_t len) { return file.read(buf, len) == len; }
+	bool write(const uint8_t* buf, uint32_t len) { return file.write(buf, len) == len; }
+	bool seek(uint32_t pos) { return file.seek(pos); }
+	void close() { file.close(); }
+};
+
+class FatfsBenchFile : public BenchFile
+{
+private:
+	FIL fil;
+
+public:
+	const char* name() { return "fatfs"; }
+
+	bool open(const char* path, BenchMode mode)
+	{
+		const BYTE flags[] = { FA_READ, FA_WRITE | FA_CREATE_ALWAYS, FA_READ | FA_WRITE | FA_OPEN_EXISTING };
+		return f_open(&fil, path, flags[mode]) == FR_OK;
+	}
+
+	bool read(uint8_t* buf, uint32_t len)
+	{
+		UINT br = 0;
+		return f_read(&fil, buf, len, &br) == FR_OK && br == len;
+	}
+
+	bool write(const uint8_t* buf, uint32_t len)
+	{
+		UINT bw = 0;
+		return f_write(&fil, buf, len, &bw) == FR_OK && bw == len;
+	}
+
+	bool seek(uint32_t pos) { return f_lseek(&fil, pos) == FR_OK; }
+	void close() { f_close(&fil); }
+};
+
+class LvFsBenchFile : public BenchFile
+{
+private:
+	lv_fs_file_t file;
+
+public:
+	const char* name() { return "lv_fs"; }
+
+	bool open(const char* path, BenchMode mode)
+	{
+		// LV_FS_MODE_WR doesn't truncate, the sequential write test overwrites the whole file
+		const lv_fs_mode_t modes[] = { LV_FS_MODE_RD, LV_FS_MODE_WR, LV_FS_MODE_RD | LV_FS_MODE_WR };
+		char src[LV_FS_MAX_PATH_LENGTH];
+		snprintf(src, sizeof(src), "S:%s", path);
+		return lv_fs_open(&file, src, modes[mode]) == LV_FS_RES_OK;
+	}
+
+	bool read(uint8_t* buf, uint32_t len)
+	{
+		uint32_t br = 0;
+		return lv_fs_read(&file, buf, len, &br) == LV_FS_RES_OK && br == len;
+	}
+
+	bool write(const uint8_t* buf, uint32_t len)
+	{
+		uint32_t bw = 0;
+		return lv_fs_write(&file, buf, len, &bw) == LV_FS_RES_OK && bw == len;
+	}
+
+	bool seek(uint32_t pos) { return lv_fs_seek(&file, pos) == LV_FS_RES_OK; }
+	void close() { lv_fs_close(&file); }
+};
+
+class RawBenchFile : public BenchFile
+{
+private:
+	sd_raw_file_t file;
+	uint32_t pos;
+
+public:
+	const char* name() { return "raw"; }
+	bool sectorsOnly() { return true; }
+
+	bool open(const char* path, BenchMode mode)
+	{
+		pos = 0;
+		return mode == BENCH_READ && sd_raw_open(path, &file);
+	}
+
+	bool read(uint8_t* buf, uint32_t len)
+	{
+		if (pos % SD_RAW_SECTOR || len % SD_RAW_SECTOR) return false;
+		if (!sd_raw_read(&file, pos / SD_RAW_SECTOR, buf, len / SD_RAW_SECTOR)) return false;
+		pos += len;
+		return true;
+	}
+
+	bool write(const uint8_t* buf, uint32_t len) { return false; }
+
+	bool seek(uint32_t pos)
+	{
+		this->pos = pos;
+		return true;
+	}
+
+	void close() { sd_raw_close(&file); }
+};
+
+// The random positions are the same in every run
+static uint32_t bench_rand(uint32_t* state)
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+// Move `chunk` bytes `cnt` times, sequentially from `align` or at random chunk positions + `align`.
+// Writes are timed with closing the file (flushing the data), reads without it. Returns the time in us, 0 on error
+static uint32_t bench_test(BenchFile* file, const char* path, bool write, bool random,
+	uint32_t align, uint32_t chunk, uint32_t cnt, uint8_t* buf)
+{
+	BenchMode mode = write ? (random ? BENCH_UPDATE : BENCH_CREATE) : BENCH_READ;
+	if (!file->open(path, mode)) return 0;
+
+	// The first byte of an unaligned sequential write isn't timed
+	bool ok = true;
+	if (write && !random && align) ok = file->write(buf, align);
+	if (!write && !random) ok = file->seek(align);
+
+	uint32_t seed = 0x12345678 + chunk;
+	uint32_t slots = SD_BENCH_FILE_SIZE / chunk - 1;
+	uint32_t start = micros();
+	uint32_t i;
+	for (i = 0; i < cnt && ok; i++)
+	{
+		if (random) ok = file->seek((bench_rand(&seed) % slots) * chunk + align);
+		if (ok) ok = write ? file->write(buf, chunk) : file->read(buf, chunk);
+	}
+	uint32_t us = micros() - start;
+	file->close();
+	if (write) us = micros() - start;
+
+	return ok ? LV_MATH_MAX(us, 1) : 0;
+}
+
+bool SdBench::run(const char* path, const char* csv_path, const char* label, uint8_t apis)
+{
+	ArduinoBenchFile arduino_file;
+	FatfsBenchFile fatfs_file;
+	LvFsBenchFile lv_fs_file;
+	RawBenchFile raw_file;
+	BenchFile* files[] = { &arduino_file, &fatfs_file, &lv_fs_file, &raw_file };
+	const uint8_t file_apis[] = { SD_BENCH_API_ARDUINO, SD_BENCH_API_FATFS, SD_BENCH_API_LV_FS, SD_BENCH_API_RAW };
+
+	// DMA capable like the buffers of the image decoders, one more byte for the unaligned tests
+	uint8_t* buf = (uint8_t*)heap_caps_malloc(SD_BENCH_CHUNK_MAX + 4, MALLOC_CAP_DMA);
+	if (buf == NULL)
+	{
+		Serial.println("SdBench: not enough memory");
+		return false;
+	}
+	for (uint32_t i = 0; i < SD_BENCH_CHUNK_MAX + 4; i++) buf[i] = i;
+
+	File csv = SD.open(csv_path, FILE_APPEND);
+	const char* header = "label,spi_hz,api,op,access,align,chunk,bytes,us,kb_per_s\n";
+	Serial.print(header);
+	if (csv && csv.size() == 0) csv.print(header);
+
+	bool ok = true;
+	for (uint32_t f = 0; f < sizeof(files) / sizeof(files[0]) && ok; f++)
+	{
+		if ((apis & file_apis[f]) == 0) continue;
+
+		uint32_t align_max = files[f]->sectorsOnly() ? 0 : 1;
+		for (uint32_t align = 0; align <= align_max && ok; align++)
+		{
+			for (uint32_t chunk = SD_BENCH_CHUNK_MIN; chunk <= SD_BENCH_CHUNK_MAX; chunk *= 2)
+			{
+				// Sequential write first, it makes the test file for the others
+				for (uint32_t test = files[f]->sectorsOnly() ? 2 : 0; test < 4; test++)
+				{
+					bool write = test < 2;
+					bool random = test & 1;
+					uint32_t cnt = random ? SD_BENCH_RANDOM_BYTES / chunk : SD_BENCH_FILE_SIZE / chunk - align;
+					uint32_t us = bench_test(files[f], path, write, random, align, chunk, cnt, buf + align);
+					if (us == 0)
+					{
+						Serial.printf("SdBench: %s can't %s %s\n", files[f]->name(), write ? "write" : "read", path);
+						if (write && !random) ok = false;  // nothing to read
+						continue;
+					}
+
+					char line[160];
+					uint32_t bytes = cnt * chunk;
+					snprintf(line, sizeof(line), "%s,%u,%s,%s,%s,%s,%u,%u,%u,%.1f\n",
+						label, (uint32_t)SD_SPI_FREQ, files[f]->name(), write ? "write" : "read",
+						random ? "random" : "seq", align ? "unaligned" : "aligned",
+						chunk, bytes, us, bytes * 1000000.0f / us / 1024);
+					Serial.print(line);
+					if (csv)
+					{
+						csv.print(line);
+						csv.flush();
+					}
+				}
+				if (!ok) break;
+			}
+		}
+	}
+
+	if (csv) csv.close();
+	heap_caps_free(buf);
+	return ok;
+}
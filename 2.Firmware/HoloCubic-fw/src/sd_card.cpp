@@ -1,11 +1,12 @@
 #include "sd_card.h"
+#include "lv_holo_meta.h"
 
 
 void SdCard::init()
 {
 
 	SPIClass* sd_spi = new SPIClass(HSPI); // another SPI
-	if (!SD.begin(15, *sd_spi)) // SD-Card SS pin is 15
+	if (!SD.begin(15, *sd_spi, SD_SPI_FREQ)) // SD-Card SS pin is 15
 	{
 		Serial.println("Card Mount Failed");
 		return;
@@ -151,7 +152,7 @@ String SdCard::readFileLine(const char* path, int num = 1)
 				return s;
 			}
 		}
-		else if (num == 1)
+		else if (num == 1 && p < buf + sizeof(buf) - 1)
 		{
 			*(p++) = c;
 		}
@@ -180,6 +181,7 @@ void SdCard::writeFile(const char* path, const char* message)
 		Serial.println("Write failed");
 	}
 	file.close();
+	lv_holo_meta_invalidate(path);  // the image header index
 }
 
 void SdCard::appendFile(const char* path, const char* message)
@@ -201,11 +203,14 @@ void SdCard::appendFile(const char* path, const char* message)
 		Serial.println("Append failed");
 	}
 	file.close();
+	lv_holo_meta_invalidate(path);  // the image header index
 }
 
 void SdCard::renameFile(const char* path1, const char* path2)
 {
 	Serial.printf("Renaming file %s to %s\n", path1, path2);
+	lv_holo_meta_invalidate(path1);
+	lv_holo_meta_invalidate(path2);
 	if (SD.rename(path1, path2))
 	{
 		Serial.println("File renamed");
@@ -219,6 +224,7 @@ void SdCard::renameFile(const char* path1, const char* path2)
 void SdCard::deleteFile(const char* path)
 {
 	Serial.printf("Deleting file: %s\n", path);
+	lv_holo_meta_invalidate(path);
 	if (SD.remove(path))
 	{
 		Serial.println("File deleted");
@@ -272,8 +278,49 @@ void SdCard::writeBinToSd(const char* path, uint8_t* buf)
 		file.write(buf, 512);
 	}
 	file.close();
+	lv_holo_meta_invalidate(path);
 }
 
+bool SdCard::openContiguous(const char* path, sd_raw_file_t* file)
+{
+	if (!sd_raw_open(path, file))
+	{
+		Serial.printf("%s is fragmented or missing, read it with SD.open()\n", path);
+		return false;
+	}
+	return true;
+}
+
+bool SdCard::readSectors(const sd_raw_file_t* file, uint32_t first, uint8_t* buf, uint32_t cnt)
+{
+	return sd_raw_read(file, first, buf, cnt);
+}
+
+void SdCard::closeContiguous(sd_raw_file_t* file)
+{
+	sd_raw_close(file);
+}
+
+bool SdCard::readFileAsync(const char* path, lv_holo_io_cb_t cb, void* user_data, lv_holo_io_prio_t prio)
+{
+	return lv_holo_io_read(path, 0, NULL, 0, prio, cb, user_data);
+}
+
+bool SdCard::writeFileAsync(const char* path, const char* message, lv_holo_io_cb_t cb, void* user_data)
+{
+	return lv_holo_io_write(path, LV_HOLO_IO_WRITE, message, strlen(message), LV_HOLO_IO_PRIO_LOW, cb, user_data);
+}
+
+bool SdCard::appendFileAsync(const char* path, const char* message, lv_holo_io_cb_t cb, void* user_data)
+{
+	return lv_holo_io_write(path, LV_HOLO_IO_APPEND, message, strlen(message), LV_HOLO_IO_PRIO_LOW, cb, user_data);
+}
+
+bool SdCard::readBinAsync(const char* path, uint8_t* buf, uint32_t len, lv_holo_io_cb_t cb, void* user_data,
+	lv_holo_io_prio_t prio)
+{
+	return lv_holo_io_read(path, 0, buf, len, prio, cb, user_data);
+}
 
 void SdCard::fileIO(const char* path)
 {
@@ -0,0 +1,229 @@
+#include "sd_config.h"
+#include "ff.h"
+
+#define FLAG_INT   0x01
+#define FLAG_FLOAT 0x02
+#define FLAG_BOOL  0x04
+#define FLAG_TRUE  0x08
+
+// FNV-1a
+static uint32_t key_hash(const char* key)
+{
+	uint32_t hash = 2166136261u;
+	while (*key) hash = (hash ^ (uint8_t)*key++) * 16777619u;
+	return hash;
+}
+
+// Cut the spaces around `s` in place
+static char* trim(char* s)
+{
+	while (isspace((uint8_t)*s)) s++;
+	char* end = s + strlen(s);
+	while (end > s && isspace((uint8_t)end[-1])) end--;
+	*end = '\0';
+	return s;
+}
+
+// The next line of `*p` without its '\n', NULL after the last one
+static char* next_line(char** p, char* end)
+{
+	if (*p >= end) return NULL;
+	char* line = *p;
+	char* nl = (char*)memchr(line, '\n', end - line);
+	if (nl == NULL) nl = end;
+	*nl = '\0';
+	*p = nl + 1;
+	return line;
+}
+
+Config::Config() : data(NULL), size(0), stamp(0), entry_cnt(0), line_keys(NULL), line_key_cnt(0)
+{
+	path[0] = '\0';
+	memset(table, 0, sizeof(table));
+}
+
+Config::~Config()
+{
+	free(data);
+}
+
+bool Config::load(const char* path)
+{
+	if (!read(path, 0)) return false;
+	line_keys = NULL;
+
+	char* p = data;
+	char* line;
+	while ((line = next_line(&p, data + size)) != NULL)
+	{
+		line = trim(line);
+		char* eq = strchr(line, '=');
+		if (line[0] == '#' || eq == NULL || eq == line) continue;
+
+		*eq = '\0';
+		add(trim(line), trim(eq + 1));
+	}
+	return true;
+}
+
+bool Config::loadLines(const char* path, const char* const* keys, uint32_t key_cnt)
+{
+	// The keys are copied after the text, all strings are in `data`
+	uint32_t extra = 0;
+	for (uint32_t i = 0; i < key_cnt; i++) extra += strlen(keys[i]) + 1;
+	if (!read(path, extra)) return false;
+	line_keys = keys;
+	line_key_cnt = key_cnt;
+
+	char* key = data + size + 1;
+	char* p = data;
+	char* line;
+	for (uint32_t i = 0; i < key_cnt && (line = next_line(&p, data + size)) != NULL; i++)
+	{
+		strcpy(key, keys[i]);
+		add(key, trim(line));
+		key += strlen(key) + 1;
+	}
+	return true;
+}
+
+bool Config::reload()
+{
+	if (path[0] == '\0') return false;
+
+	FILINFO info;
+	if (f_stat(path, &info) != FR_OK) return false;
+	if (info.fsize == size && ((uint32_t)info.fdate << 16 | info.ftime) == stamp) return false;
+
+	char p[sizeof(path)];
+	strcpy(p, path);
+	return line_keys ? loadLines(p, line_keys, line_key_cnt) : load(p);
+}
+
+const char* Config::getString(const char* key, const char* def) const
+{
+	const Entry* e = find(key);
+	return e ? data + e->value : def;
+}
+
+int32_t Config::getInt(const char* key, int32_t def) const
+{
+	const Entry* e = find(key);
+	if (e && (e->flags & FLAG_INT)) return e->i;
+	if (e && (e->flags & FLAG_FLOAT)) return (int32_t)e->f;
+	return def;
+}
+
+float Config::getFloat(const char* key, float def) const
+{
+	const Entry* e = find(key);
+	return e && (e->flags & FLAG_FLOAT) ? e->f : def;
+}
+
+bool Config::getBool(const char* key, bool def) const
+{
+	const Entry* e = find(key);
+	return e && (e->flags & FLAG_BOOL) ? (e->flags & FLAG_TRUE) != 0 : def;
+}
+
+bool Config::has(const char* key) const
+{
+	return find(key) != NULL;
+}
+
+// Read the whole file into a new buffer with `extra` bytes after it, forget the previous entries
+bool Config::read(const char* path, uint32_t extra)
+{
+	FILINFO info;
+	if (strlen(path) >= sizeof(this->path) || f_stat(path, &info) != FR_OK) return false;
+	if (info.fsize > CONFIG_FILE_MAX)
+	{
+		Serial.printf("Config: %s is longer than %u bytes\n", path, CONFIG_FILE_MAX);
+		return false;
+	}
+
+	FIL fil;
+	if (f_open(&fil, path, FA_READ) != FR_OK) return false;
+	uint32_t len = f_size(&fil);
+	char* buf = (char*)malloc(len + 1 + extra);
+	UINT br = 0;
+	bool ok = buf && len <= CONFIG_FILE_MAX && f_read(&fil, buf, len, &br) == FR_OK && br == len;
+	f_close(&fil);
+	if (!ok)
+	{
+		free(buf);
+		return false;
+	}
+	buf[len] = '\0';
+
+	free(data);
+	data = buf;
+	size = len;
+	stamp = (uint32_t)info.fdate << 16 | info.ftime;
+	strcpy(this->path, path);
+	entry_cnt = 0;
+	memset(table, 0, sizeof(table));
+	return true;
+}
+
+// `key` and `value` are in `data`. A key given again replaces the value
+void Config::add(const char* key, const char* value)
+{
+	uint32_t hash = key_hash(key);
+	uint32_t slot = hash & (CONFIG_TABLE_SIZE - 1);
+	Entry* e = NULL;
+	while (table[slot])
+	{
+		Entry* t = &entries[table[slot] - 1];
+		if (t->hash == hash && strcmp(data + t->key, key) == 0)
+		{
+			e = t;
+			break;
+		}
+		slot = (slot + 1) & (CONFIG_TABLE_SIZE - 1);
+	}
+	if (e == NULL)
+	{
+		if (entry_cnt == CONFIG_ENTRY_MAX)
+		{
+			Serial.printf("Config: more than %u keys in %s, %s is ignored\n", CONFIG_ENTRY_MAX, path, key);
+			return;
+		}
+		e = &entries[entry_cnt++];
+		table[slot] = entry_cnt;
+	}
+
+	e->hash = hash;
+	e->key = key - data;
+	e->value = value - data;
+	e->flags = 0;
+
+	char* end;
+	e->i = strtol(value, &end, 0);
+	if (value[0] && *end == '\0') e->flags |= FLAG_INT;
+	e->f = strtof(value, &end);
+	if (value[0] && *end == '\0') e->flags |= FLAG_FLOAT;
+
+	static const char* const trues[] = { "true", "yes", "on", "1" };
+	static const char* const falses[] = { "false", "no", "off", "0" };
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		if (strcasecmp(value, trues[i]) == 0) e->flags |= FLAG_BOOL | FLAG_TRUE;
+		if (strcasecmp(value, falses[i]) == 0) e->flags |= FLAG_BOOL;
+	}
+}
+
+const Config::Entry* Config::find(const char* key) const
+{
+	if (entry_cnt == 0) return NULL;
+
+	uint32_t hash = key_hash(key);
+	uint32_t slot = hash & (CONFIG_TABLE_SIZE - 1);
+	while (table[slot])
+	{
+		const Entry* e = &entries[table[slot] - 1];
+		if (e->hash == hash && strcmp(data + e->key, key) == 0) return e;
+		slot = (slot + 1) & (CONFIG_TABLE_SIZE - 1);
+	}
+	return NULL;
+}
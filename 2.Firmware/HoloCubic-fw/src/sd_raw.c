@@ -0,0 +1,121 @@
+/**
+ * @file sd_raw.c
+ * Reading contiguous files by sector address (see sd_raw.h)
+ */
+
+ /*********************
+  *      INCLUDES
+  *********************/
+#include "sd_raw.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "ff.h"
+#include "diskio.h"
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+#if defined(ESP_PLATFORM)
+bool sd_raw_open(const char* path, sd_raw_file_t* file)
+{
+	FIL fil;
+	if (f_open(&fil, path, FA_READ) != FR_OK) return false;
+
+	FATFS* fs = fil.obj.fs;
+	DWORD sclust = fil.obj.sclust;
+	uint32_t size = f_size(&fil);
+#if FF_MAX_SS != FF_MIN_SS
+	bool ok = fs->ssize == SD_RAW_SECTOR;
+#else
+	bool ok = FF_MAX_SS == SD_RAW_SECTOR;
+#endif
+	ok = ok && size > 0 && sclust >= 2;
+
+	/* Follow the cluster chain once, every cluster must come right after the previous one.
+	 * f_lseek() to the first byte of cluster `i` + 1 leaves `fil.clust` on cluster `i` */
+	uint32_t clust_bytes = (uint32_t)fs->csize * SD_RAW_SECTOR;
+	uint32_t clust_cnt = ok ? (size + clust_bytes - 1) / clust_bytes : 0;
+	uint32_t i;
+	for (i = 1; i < clust_cnt && ok; i++)
+	{
+		ok = f_lseek(&fil, i * clust_bytes + 1) == FR_OK && fil.clust == sclust + i;
+	}
+	f_close(&fil);
+	if (!ok) return false;
+
+	file->sector = fs->database + (sclust - 2) * fs->csize;
+	file->sector_cnt = clust_cnt * fs->csize;
+	file->size = size;
+	file->pdrv = fs->pdrv;
+	file->fs = fs;
+	file->fp = NULL;
+	return true;
+}
+
+bool sd_raw_read(const sd_raw_file_t* file, uint32_t first, void* buf, uint32_t cnt)
+{
+	if (first + cnt > file->sector_cnt) return false;
+
+#if FF_FS_REENTRANT
+	FATFS* fs = file->fs;
+	if (!ff_req_grant(fs->sobj)) return false;
+#endif
+
+	/* More than one sector is a multi-block read of the card */
+	bool ok = disk_read(file->pdrv, buf, file->sector + first, cnt) == RES_OK;
+
+#if FF_FS_REENTRANT
+	ff_rel_grant(fs->sobj);
+#endif
+	return ok;
+}
+
+void sd_raw_close(sd_raw_file_t* file)
+{
+	file->sector_cnt = 0;
+}
+#else
+bool sd_raw_open(const char* path, sd_raw_file_t* file)
+{
+	FILE* fp = fopen(path, "rb");
+	if (fp == NULL) return false;
+
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	if (size <= 0)
+	{
+		fclose(fp);
+		return false;
+	}
+
+	file->sector = 0;
+	file->sector_cnt = (size + SD_RAW_SECTOR - 1) / SD_RAW_SECTOR;
+	file->size = size;
+	file->pdrv = 0;
+	file->fs = NULL;
+	file->fp = fp;
+	return true;
+}
+
+bool sd_raw_read(const sd_raw_file_t* file, uint32_t first, void* buf, uint32_t cnt)
+{
+	if (first + cnt > file->sector_cnt) return false;
+	if (fseek(file->fp, first * SD_RAW_SECTOR, SEEK_SET) != 0) return false;
+
+	/* Like the rest of the last cluster on the card */
+	size_t len = fread(buf, 1, cnt * SD_RAW_SECTOR, file->fp);
+	memset((uint8_t*)buf + len, 0, cnt * SD_RAW_SECTOR - len);
+	return true;
+}
+
+void sd_raw_close(sd_raw_file_t* file)
+{
+	if (file->fp) fclose(file->fp);
+	file->fp = NULL;
+	file->sector_cnt = 0;
+}
+#endif
@@ -0,0 +1,143 @@
+import os
+import struct
+import tempfile
+from typing import *
+
+from convertor.core import Convertor, rle_encode
+
+# Layout of the animation container, see lv_holo_anim.h in the firmware
+ANIM_MAGIC = b"HANM"
+ANIM_VERSION = 1
+ANIM_EXT = ".hanim"
+ANIM_RLE = 0x80000000
+ANIM_DELTA = 0x40000000
+ANIM_HEADER_FMT = "<4sHH4sLLHH"
+ANIM_ENTRY_FMT = "<LL"
+# Frames start at multiples of it, the player reads them by sectors into word aligned buffers
+ANIM_ALIGN = 4
+
+IMAGE_EXTS = (".jpg", ".jpeg", ".png", ".bmp")
+VIDEO_EXTS = (".mp4", ".avi", ".mov", ".mkv", ".gif")
+
+
+def changed_tiles(prev: bytes, data: bytes, w, h, unit, tile) -> Tuple[bytes, bytes]:
+    # Bitmap of the tiles that differ from `prev` (LSB first) and their pixels, tile by tile
+    bitmap = bytearray((((w + tile - 1) // tile) * ((h + tile - 1) // tile) + 7) // 8)
+    pixels = bytearray()
+    tile_id = 0
+    for ty in range(0, h, tile):
+        for tx in range(0, w, tile):
+            rows = []
+            for y in range(ty, min(ty + tile, h)):
+                start = (y * w + tx) * unit
+                rows.append((start, start + min(tile, w - tx) * unit))
+            if any(prev[a:b] != data[a:b] for a, b in rows):
+                bitmap[tile_id >> 3] |= 1 << (tile_id & 7)
+                for a, b in rows: pixels += data[a:b]
+            tile_id += 1
+    return bytes(bitmap), bytes(pixels)
+
+
+class AnimWriter(object):
+    def __init__(self, cf=Convertor.FLAG.CF_TRUE_COLOR_565_SWAP, fps=25, rle=True, tile=16, key_interval=50):
+        self.cf = cf
+        self.fps = fps
+        self.rle = rle
+        self.tile = tile  # 0: only key frames
+        self.key_interval = key_interval  # 0: only the first frame is a key frame
+        self.lv_header = None
+        self.unit = None
+        self.w = None
+        self.h = None
+        self.prev = None
+        self.frames = []  # (data, flags)
+
+    def add_image(self, path):
+        c = Convertor(path, self.cf)
+        self.add_frame(bytes(c.d_out), c.get_lv_header(), c.w, c.h, path)
+
+    def add_frame(self, data: bytes, lv_header: bytes, w, h, name=""):
+        if self.lv_header is None:
+            self.lv_header = lv_header
+            self.unit = len(data) // (w * h)
+            self.w, self.h = w, h
+        elif lv_header != self.lv_header:
+            raise ValueError("{}: all frames must have the same size".format(name))
+
+        frame = self._pack(data, 0)
+        index = len(self.frames)
+        is_key = index == 0 or (self.key_interval and index % self.key_interval == 0)
+        if self.tile and not is_key:
+            bitmap, pixels = changed_tiles(self.prev, data, self.w, self.h, self.unit, self.tile)
+            pixels, flags = self._pack(pixels, ANIM_DELTA)
+            # A delta that isn't smaller than the whole frame is stored as a key frame
+            if len(bitmap) + len(pixels) < len(frame[0]):
+                frame = (bitmap + pixels, flags)
+        self.frames.append(frame)
+        self.prev = data
+
+    def _pack(self, data: bytes, flags) -> Tuple[bytes, int]:
+        if self.rle:
+            packed = rle_encode(data, self.unit)
+            # Only worth it when smaller, the player copies uncompressed frames directly
+            if len(packed) < len(data):
+                return packed, flags | ANIM_RLE
+        return data, flags
+
+    def save(self, out_path):
+        header = struct.pack(ANIM_HEADER_FMT, ANIM_MAGIC, ANIM_VERSION, self.unit,
+                             self.lv_header, len(self.frames), self.fps,
+                             self.tile, self.key_interval if self.tile else 0)
+        offset = len(header) + len(self.frames) * struct.calcsize(ANIM_ENTRY_FMT)
+
+        table = bytearray()
+        for data, flags in self.frames:
+            table += struct.pack(ANIM_ENTRY_FMT, offset, len(data) | flags)
+            offset += len(data) + -len(data) % ANIM_ALIGN
+
+        with open(out_path, "wb") as f:
+            f.write(header + table)
+            for data, _ in self.frames:
+                f.write(data + bytes(-len(data) % ANIM_ALIGN))
+        return offset
+
+
+def list_images(folder) -> List[AnyStr]:
+    names = sorted(n for n in os.listdir(folder) if n.lower().endswith(IMAGE_EXTS))
+    return [os.path.join(folder, n) for n in names]
+
+
+def video_frames(path, tmp_dir, size=None) -> Tuple[List[AnyStr], float]:
+    # OpenCV is only needed for videos
+    import cv2
+
+    cap = cv2.VideoCapture(path)
+    fps = cap.get(cv2.CAP_PROP_FPS) or 0
+    paths = []
+    while True:
+        ok, frame = cap.read()
+        if not ok: break
+        if size: frame = cv2.resize(frame, size)
+        p = os.path.join(tmp_dir, "frame{:05d}.png".format(len(paths)))
+        cv2.imwrite(p, frame)
+        paths.append(p)
+    cap.release()
+    return paths, fps
+
+
+def make_anim(src, out_path, fps=0, rle=True, size=None, tile=16, key_interval=50,
+              cf=Convertor.FLAG.CF_TRUE_COLOR_565_SWAP):
+    # `src`: a folder of images (sorted by name) or a video file
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        if os.path.isdir(src):
+            paths = list_images(src)
+        else:
+            paths, video_fps = video_frames(src, tmp_dir, size)
+            if not fps: fps = int(round(video_fps))
+        if not paths:
+            raise ValueError("{}: no frames".format(src))
+
+        writer = AnimWriter(cf, fps, rle, tile, key_interval)
+        for p in paths:
+            writer.add_image(p)
+        return writer.save(out_path), len(paths)
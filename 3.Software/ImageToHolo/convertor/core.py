@@ -27,6 +27,60 @@ def forceUpdate(li: List, index: int, elem: Any):
         li.append(elem)
 
 
+def rle_encode(data: bytes, unit: int) -> bytes:
+    # Control byte c: c & 0x80 -> (c & 0x7F) + 1 repeats of the next unit, else c + 1 literal units
+    px = [bytes(data[i:i + unit]) for i in range(0, len(data), unit)]
+    out = bytearray()
+    lit = []
+
+    def flush_lit():
+        while lit:
+            chunk = lit[:128]
+            del lit[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk: out.extend(p)
+
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < 128 and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            flush_lit()
+            out.append(0x80 | (run - 1))
+            out.extend(px[i])
+        else:
+            lit.append(px[i])
+        i += run
+    flush_lit()
+    return bytes(out)
+
+
+# Layout of the compressed image file, see lv_holo_img.h in the firmware
+HIMG_MAGIC = b"HIMG"
+HIMG_VERSION = 1
+HIMG_EXT = ".himg"
+HIMG_HEADER_FMT = "<4sHH4sHH"
+
+
+def himg_pack(lv_header: bytes, data: bytes, w, h, restart_rows=8) -> bytes:
+    # Every `restart_rows` rows are compressed on their own, a marker gives their offset in the file
+    unit = len(data) // (w * h)
+    row_size = w * unit
+    block_cnt = (h + restart_rows - 1) // restart_rows
+    offset = struct.calcsize(HIMG_HEADER_FMT) + 4 * block_cnt
+    marks = []
+    blocks = []
+    for y in range(0, h, restart_rows):
+        block = rle_encode(data[y * row_size:(y + restart_rows) * row_size], unit)
+        marks.append(offset)
+        blocks.append(block)
+        offset += len(block)
+
+    header = struct.pack(HIMG_HEADER_FMT, HIMG_MAGIC, HIMG_VERSION, unit, lv_header, restart_rows, 0)
+    return header + struct.pack(f"<{block_cnt}L", *marks) + b"".join(blocks)
+
+
 class _const:
     class ConstError(TypeError): pass
 
@@ -299,9 +353,16 @@ const lv_img_dsc_t {self.out_name} = {{
                 self.FLAG.CF_RAW: f"{len(self.d_out)},\n  .header.cf = LV_IMG_CF_RAW,",
                 self.FLAG.CF_RAW_ALPHA: f"{len(self.d_out)},\n  .header.cf = LV_IMG_CF_RAW_ALPHA,",
                 self.FLAG.CF_RAW_CHROMA: f"{len(self.d_out)},\n  .header.cf = LV_IMG_CF_RAW_CHROMA_KEYED,"
-            }.get(cf, "") + f"\n  .data = {self.out_name}_map,\n}}\n"
+            }.get(self._lv_true_color_cf(cf), "") + f"\n  .data = {self.out_name}_map,\n}}\n"
         return c_footer
 
+    def _lv_true_color_cf(self, cf):
+        # The helper formats are stored as LittlevGL's true color (with alpha)
+        if cf in (self.FLAG.CF_TRUE_COLOR_332, self.FLAG.CF_TRUE_COLOR_565,
+                  self.FLAG.CF_TRUE_COLOR_565_SWAP, self.FLAG.CF_TRUE_COLOR_888):
+            return self.FLAG.CF_TRUE_COLOR_ALPHA if self.alpha else self.FLAG.CF_TRUE_COLOR
+        return cf
+
     def get_c_code_file(self, cf=-1, content="") -> AnyStr:
         if len(content) < 1: content = self.format_to_c_array()
         if cf < 0: cf = self.cf
@@ -313,8 +374,8 @@ const lv_img_dsc_t {self.out_name} = {{
 
         return out
 
-    def get_bin_file(self, cf=-1, content=None) -> bytes:
-        if not content: content = self.d_out
+    def get_lv_header(self, cf=-1) -> bytes:
+        # lv_img_header_t of the image, the first 4 bytes of a .bin file
         if cf < 0: cf = self.cf
 
         lv_cf = {  # Color format in LittlevGL
@@ -329,10 +390,21 @@ const lv_img_dsc_t {self.out_name} = {{
             self.FLAG.CF_ALPHA_2_BIT: 12,
             self.FLAG.CF_ALPHA_4_BIT: 13,
             self.FLAG.CF_ALPHA_8_BIT: 14
-        }.get(cf, 4)
+        }.get(self._lv_true_color_cf(cf), 4)
+
+        # Byte order of RGB565 in the reserved bits, the firmware refuses files of the other order
+        order = {
+            self.FLAG.CF_TRUE_COLOR_565: 1,  # LV_IMG_BYTE_ORDER_565
+            self.FLAG.CF_TRUE_COLOR_565_SWAP: 2  # LV_IMG_BYTE_ORDER_565_SWAP
+        }.get(cf, 0)
 
-        header = lv_cf + (self.w << 10) + (self.h << 21)
-        header_bin = struct.pack("<L", header)
+        header = lv_cf + (order << 8) + (self.w << 10) + (self.h << 21)
+        return struct.pack("<L", header)
+
+    def get_bin_file(self, cf=-1, content=None) -> bytes:
+        if not content: content = self.d_out
+
+        header_bin = self.get_lv_header(cf)
         content = struct.pack(f"<{len(content)}B", *content)
 
         with open(self.out_name + ".bin", "wb") as f:
@@ -341,6 +413,18 @@ const lv_img_dsc_t {self.out_name} = {{
 
         return header_bin + content
 
+    def get_himg_file(self, cf=-1, content=None, restart_rows=8) -> bytes:
+        # RLE compressed like get_bin_file(), only for the true color formats
+        if not content: content = self.d_out
+
+        out = himg_pack(self.get_lv_header(cf), bytes(content), self.w, self.h, restart_rows)
+
+        with open(self.out_name + HIMG_EXT, "wb") as f:
+            f.write(out)
+            f.close()
+
+        return out
+
     def _conv_px(self, x, y):
         c = self.img.getpixel((x, y))
 
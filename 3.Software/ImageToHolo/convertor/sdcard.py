@@ -0,0 +1,144 @@
+import os
+import struct
+import sys
+from typing import *
+
+COPY_CHUNK = 1024 * 1024
+# Extents asked from the OS at once, a file with more isn't contiguous anyway
+MAX_EXTENTS = 32
+
+# Linux: FS_IOC_FIEMAP of <linux/fs.h>, struct fiemap and struct fiemap_extent of <linux/fiemap.h>
+FS_IOC_FIEMAP = 0xC020660B
+FIEMAP_FLAG_SYNC = 0x1
+FIEMAP_HEADER = "=QQLLLL"
+FIEMAP_EXTENT_SIZE = 56
+
+# Windows: FSCTL_GET_RETRIEVAL_POINTERS of <winioctl.h>, the extents are in clusters
+FSCTL_GET_RETRIEVAL_POINTERS = 0x00090073
+ERROR_MORE_DATA = 234
+
+
+def list_files(src) -> List[Tuple[AnyStr, AnyStr]]:
+    # (path, path relative to the parent of `src`) of a file or of the files in a folder
+    parent = os.path.dirname(os.path.normpath(src))
+    if os.path.isfile(src):
+        return [(src, os.path.basename(src))]
+    files = []
+    for root, _, names in os.walk(src):
+        for n in sorted(names):
+            path = os.path.join(root, n)
+            files.append((path, os.path.relpath(path, parent)))
+    return files
+
+
+def copy_contiguous(src, dst) -> int:
+    # The whole size is reserved before writing: FAT gives the clusters of one extension
+    # in a row if the free space allows, so the firmware can read the file by sector address
+    # (sd_raw.h) instead of following its cluster chain. Returns the size
+    size = os.path.getsize(src)
+    if os.path.exists(dst):
+        # Its clusters may be anywhere, new ones are taken
+        os.remove(dst)
+    with open(src, "rb") as fi, open(dst, "wb") as fo:
+        if size:
+            fo.truncate(size)
+            fo.seek(0)
+        while True:
+            chunk = fi.read(COPY_CHUNK)
+            if not chunk:
+                break
+            fo.write(chunk)
+        fo.flush()
+        os.fsync(fo.fileno())
+    return size
+
+
+def is_contiguous(path) -> Optional[bool]:
+    # Whether the clusters of a copied file came in a row, like the firmware's sd_raw_open() checks.
+    # None if the OS can't tell (macOS, or a file system without the call)
+    if os.path.getsize(path) == 0:
+        return True
+    try:
+        if sys.platform.startswith("linux"):
+            extents = _extents_linux(path)
+        elif sys.platform == "win32":
+            extents = _extents_windows(path)
+        else:
+            return None
+    except OSError:
+        return None
+    if extents is None:
+        return None
+
+    # (logical, physical, length) in the same unit, every extent must go on where the previous ended
+    for prev, ext in zip(extents, extents[1:]):
+        if ext[0] != prev[0] + prev[2] or ext[1] != prev[1] + prev[2]:
+            return False
+    return True
+
+
+def put_files(srcs, dst_dir) -> Tuple[int, int, List[AnyStr], List[AnyStr]]:
+    # Copy files and folders into `dst_dir`, the largest first so they get the longest free runs.
+    # Returns the number of files, their size, the copies that aren't contiguous and the ones not checked
+    files = [f for src in srcs for f in list_files(src)]
+    files.sort(key=lambda f: os.path.getsize(f[0]), reverse=True)
+
+    total = 0
+    fragmented = []
+    unchecked = []
+    for path, rel in files:
+        dst = os.path.join(dst_dir, rel)
+        os.makedirs(os.path.dirname(dst), exist_ok=True)
+        total += copy_contiguous(path, dst)
+        contiguous = is_contiguous(dst)
+        if contiguous is None:
+            unchecked.append(dst)
+        elif not contiguous:
+            fragmented.append(dst)
+    return len(files), total, fragmented, unchecked
+
+
+def _extents_linux(path) -> List[Tuple[int, int, int]]:
+    import fcntl
+    buf = bytearray(struct.pack(FIEMAP_HEADER, 0, 0xFFFFFFFFFFFFFFFF, FIEMAP_FLAG_SYNC, 0, MAX_EXTENTS, 0))
+    buf += bytes(FIEMAP_EXTENT_SIZE * MAX_EXTENTS)
+    with open(path, "rb") as f:
+        fcntl.ioctl(f.fileno(), FS_IOC_FIEMAP, buf)
+    mapped = struct.unpack_from(FIEMAP_HEADER, buf)[3]
+    header_size = struct.calcsize(FIEMAP_HEADER)
+    return [struct.unpack_from("=QQQ", buf, header_size + FIEMAP_EXTENT_SIZE * i) for i in range(mapped)]
+
+
+def _extents_windows(path) -> Optional[List[Tuple[int, int, int]]]:
+    import ctypes
+    from ctypes import wintypes
+    kernel32 = ctypes.WinDLL("kernel32", use_last_error=True)
+    kernel32.CreateFileW.restype = wintypes.HANDLE
+    generic_read = 0x80000000
+    share_read_write = 0x3
+    open_existing = 3
+    handle = kernel32.CreateFileW(path, generic_read, share_read_write, None, open_existing, 0, None)
+    if handle == wintypes.HANDLE(-1).value:
+        return None
+
+    # RETRIEVAL_POINTERS_BUFFER: ExtentCount, StartingVcn, then (NextVcn, Lcn) per extent
+    start_vcn = ctypes.c_longlong(0)
+    out = ctypes.create_string_buffer(16 + 16 * MAX_EXTENTS)
+    returned = wintypes.DWORD()
+    ok = kernel32.DeviceIoControl(handle, FSCTL_GET_RETRIEVAL_POINTERS, ctypes.byref(start_vcn),
+                                  ctypes.sizeof(start_vcn), out, len(out), ctypes.byref(returned), None)
+    error = ctypes.get_last_error()
+    kernel32.CloseHandle(handle)
+    if not ok and error != ERROR_MORE_DATA:
+        return None
+
+    count, vcn = struct.unpack_from("<L4xq", out.raw)
+    extents = []
+    for i in range(count):
+        next_vcn, lcn = struct.unpack_from("<qq", out.raw, 16 + 16 * i)
+        extents.append((vcn, lcn, next_vcn - vcn))
+        vcn = next_vcn
+    if not ok:
+        # More extents than asked for: not contiguous
+        extents.append((vcn + 1, -1, 0))
+    return extents
@@ -1,5 +1,5 @@
 import os.path, sys, time
-from convertor.core import Convertor
+from convertor.core import Convertor, HIMG_EXT
 
 if __name__ == '__main__':
 
@@ -8,8 +8,19 @@ if __name__ == '__main__':
         time.sleep(3)
         sys.exit(0)
 
-    for i, img_path in enumerate(sys.argv[1:]):
+    # --rle: RLE compressed .himg files (lv_holo_img.h) instead of .bin, for the firmware's .himg decoder
+    rle = "--rle" in sys.argv[1:]
+    img_paths = [p for p in sys.argv[1:] if p != "--rle"]
+
+    for i, img_path in enumerate(img_paths):
         print("正在转换图片{} ...".format(os.path.basename(img_path)))
-        c = Convertor(img_path)
+        # RGB565 in the panel's byte order, the firmware is built with LV_COLOR_16_SWAP 1.
+        # The order is marked in the header, the firmware refuses it after changing LV_COLOR_16_SWAP
+        c = Convertor(img_path, Convertor.FLAG.CF_TRUE_COLOR_565_SWAP)
+        if rle and len(c.get_himg_file()) < 4 + len(c.d_out):
+            continue
+        if rle:
+            # Noisy images (photos, dithering) get bigger, .bin is read faster then
+            os.remove(c.out_name + HIMG_EXT)
         c.get_bin_file()
         # c.get_c_code_file()
@@ -0,0 +1,21 @@
+import argparse, os.path
+from convertor.anim import make_anim, ANIM_EXT
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="把一个图片文件夹或视频打包成一个 .hanim 动画文件 (SD卡 /Scenes/)")
+    parser.add_argument("src", help="图片文件夹 (按文件名排序) 或视频文件")
+    parser.add_argument("-o", "--out", help="输出文件, 默认: <src>" + ANIM_EXT)
+    parser.add_argument("--fps", type=int, default=0, help="帧率, 0: 视频的帧率或播放时指定")
+    parser.add_argument("--size", help="视频帧缩放, 例如 240x240")
+    parser.add_argument("--no-rle", action="store_true", help="不压缩帧")
+    parser.add_argument("--tile", type=int, default=16, help="差分帧的块大小 (像素), 0: 只存完整帧")
+    parser.add_argument("--key", type=int, default=50, help="每隔多少帧存一个完整帧, 0: 只有第一帧")
+    args = parser.parse_args()
+
+    out = args.out or os.path.splitext(os.path.normpath(args.src))[0] + ANIM_EXT
+    size = tuple(int(v) for v in args.size.split("x")) if args.size else None
+
+    print("正在转换 {} ...".format(os.path.basename(os.path.normpath(args.src))))
+    # RGB565 in the panel's byte order, the firmware is built with LV_COLOR_16_SWAP 1
+    file_size, frame_cnt = make_anim(args.src, out, args.fps, not args.no_rle, size, args.tile, args.key)
+    print("{}: {} 帧, {} KB".format(out, frame_cnt, file_size // 1024))
@@ -0,0 +1,20 @@
+import argparse
+from convertor.sdcard import put_files
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description="把文件或文件夹复制到 SD 卡, 每个文件先分配好全部空间, 尽量占用连续的扇区. "
+                    "固件按扇区地址直接读取连续的文件 (播放 .hanim 和 .bin 帧更快), 不连续的文件照常用 FATFS 读取. "
+                    "新格式化 (簇越大越好, 例如 32 KB) 的卡效果最好")
+    parser.add_argument("src", nargs="+", help="文件或文件夹, 例如 Holo3D.hanim 或 Holo3D (帧文件夹)")
+    parser.add_argument("dst", help="SD 卡上的目标文件夹, 例如 E:/Scenes")
+    args = parser.parse_args()
+
+    cnt, size, fragmented, unchecked = put_files(args.src, args.dst)
+    print("{} 个文件, {} KB 已复制到 {}".format(cnt, size // 1024, args.dst))
+    if fragmented:
+        print("{} 个文件不连续, 固件会用 FATFS 读取 (较慢). 可以整理或重新格式化 SD 卡后再复制:".format(len(fragmented)))
+        for path in fragmented:
+            print("  " + path)
+    if unchecked:
+        print("{} 个文件无法检查是否连续 (此系统或文件系统不支持)".format(len(unchecked)))
@@ -0,0 +1,76 @@
+/**
+ * @file Arduino.h
+ * The few Arduino functions the firmware's lv_conf.h refers to, implemented by the headless runner,
+ * and the Arduino-ESP32 and FreeRTOS bits the firmware's display.cpp uses (arduino_stub.cpp).
+ */
+
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+	/* The C library headers the real Arduino.h brings along */
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+	/* Virtual time in ms, advanced by the runner: animations are the same on every run */
+	uint32_t millis(void);
+
+	/* Real time in us, used to measure the rendering (e.g. by the refresh profiler) */
+	uint32_t micros(void);
+
+	/* Code and data placement of the ESP32, nothing on a PC */
+#define IRAM_ATTR
+
+	/* FreeRTOS tasks are pthreads, the core and the priority are ignored */
+#define pdFALSE         0
+#define pdTRUE          1
+#define pdPASS          1
+#define portMAX_DELAY   0xFFFFFFFF
+#define portTICK_PERIOD_MS 1
+
+	typedef int BaseType_t;
+	typedef unsigned int UBaseType_t;
+	typedef uint32_t TickType_t;
+	typedef struct stub_task* TaskHandle_t;
+	typedef void (*TaskFunction_t)(void*);
+
+	BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* param,
+		UBaseType_t prio, TaskHandle_t* handle, BaseType_t core);
+	TaskHandle_t xTaskGetCurrentTaskHandle(void);
+	BaseType_t xTaskNotifyGive(TaskHandle_t task);
+	uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+	/* The stack isn't measured on a PC, returns the size it was created with */
+	UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+	/* The backlight PWM goes nowhere */
+	double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits);
+	void ledcAttachPin(uint8_t pin, uint8_t channel);
+	void ledcWrite(uint8_t channel, uint32_t duty);
+
+#ifdef __cplusplus
+} /* extern "C" */
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+/* Prints to stderr, stdout is the runner's report */
+class HardwareSerial
+{
+public:
+	int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+	void println(const char* line);
+	void flush();
+	int available();
+	int read();
+};
+
+extern HardwareSerial Serial;
+#endif
+
+#endif /*ARDUINO_STUB_H*/
@@ -0,0 +1,207 @@
+/**
+ * @file TFT_eSPI.cpp
+ * Mock SPI panel of the headless runner (see TFT_eSPI.h)
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include "TFT_eSPI.h"
+#include <pthread.h>
+#include <unistd.h>
+#include <atomic>
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void panel_put(int32_t x, int32_t y, int32_t w, uint32_t pos, const uint16_t* data, uint32_t len, bool swap);
+static void wire_wait(uint32_t len);
+static void* dma_thread_cb(void* param);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static uint8_t* panel;
+static uint16_t panel_w;
+static uint16_t panel_h;
+static std::atomic<uint64_t> panel_px(0);
+
+/* One transfer at a time, like the firmware's `queue_size = 1` */
+static pthread_t dma_thread;
+static pthread_mutex_t dma_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dma_cond = PTHREAD_COND_INITIALIZER;
+static bool dma_busy;
+static int32_t dma_x;
+static int32_t dma_y;
+static int32_t dma_w;
+static int32_t dma_h;
+static const uint16_t* dma_data;
+static void (*dma_done_cb)(void);
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void mock_spi_attach(uint8_t* buf, uint16_t w, uint16_t h)
+{
+	panel = buf;
+	panel_w = w;
+	panel_h = h;
+}
+
+uint64_t mock_spi_px(void)
+{
+	return panel_px.load();
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+{
+	width = w;
+	swap_bytes = false;
+	win_x = 0;
+	win_y = 0;
+	win_w = w;
+	win_pos = 0;
+}
+
+void TFT_eSPI::begin()
+{
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+}
+
+void TFT_eSPI::setSwapBytes(bool swap)
+{
+	swap_bytes = swap;
+}
+
+void TFT_eSPI::startWrite()
+{
+}
+
+void TFT_eSPI::endWrite()
+{
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+	win_x = x;
+	win_y = y;
+	win_w = w;
+	win_pos = 0;
+}
+
+void TFT_eSPI::pushColors(uint16_t* data, uint32_t len, bool swap)
+{
+	wire_wait(len);
+	panel_put(win_x, win_y, win_w, win_pos, data, len, swap);
+	win_pos += len;
+}
+
+bool TFT_eSPI::initDMA(bool ctrl_cs)
+{
+	return pthread_create(&dma_thread, NULL, dma_thread_cb, NULL) == 0;
+}
+
+void TFT_eSPI::setDMACallback(void (*cb)(void))
+{
+	dma_done_cb = cb;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer)
+{
+	dmaWait();
+
+	/* Like TFT_eSPI without `buffer`: swapped in place, the caller mustn't touch it until the end */
+	if (swap_bytes)
+	{
+		uint32_t i;
+		for (i = 0; i < (uint32_t)(w * h); i++) data[i] = (data[i] >> 8) | (data[i] << 8);
+	}
+
+	pthread_mutex_lock(&dma_mutex);
+	dma_x = x;
+	dma_y = y;
+	dma_w = w;
+	dma_h = h;
+	dma_data = data;
+	dma_busy = true;
+	pthread_cond_broadcast(&dma_cond);
+	pthread_mutex_unlock(&dma_mutex);
+}
+
+bool TFT_eSPI::dmaBusy()
+{
+	pthread_mutex_lock(&dma_mutex);
+	bool busy = dma_busy;
+	pthread_mutex_unlock(&dma_mutex);
+	return busy;
+}
+
+void TFT_eSPI::dmaWait()
+{
+	pthread_mutex_lock(&dma_mutex);
+	while (dma_busy) pthread_cond_wait(&dma_cond, &dma_mutex);
+	pthread_mutex_unlock(&dma_mutex);
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+/* Store `len` pixels of the `w` wide window at (`x`, `y`) from its pixel `pos` */
+static void panel_put(int32_t x, int32_t y, int32_t w, uint32_t pos, const uint16_t* data, uint32_t len, bool swap)
+{
+	uint32_t i;
+	for (i = 0; i < len; i++, pos++)
+	{
+		int32_t px = x + pos % w;
+		int32_t py = y + pos / w;
+		if (panel == NULL || px >= panel_w || py >= panel_h) continue;
+
+		uint8_t* dest = &panel[(py * panel_w + px) * 2];
+		if (swap)
+		{
+			dest[0] = data[i] >> 8;
+			dest[1] = data[i] & 0xFF;
+		}
+		else
+		{
+			/* As they are in memory */
+			const uint8_t* src = (const uint8_t*)&data[i];
+			dest[0] = src[0];
+			dest[1] = src[1];
+		}
+	}
+	panel_px += len;
+}
+
+/* The time `len` pixels of 16 bit are on the bus */
+static void wire_wait(uint32_t len)
+{
+	usleep((uint64_t)len * 16 * 1000000 / MOCK_SPI_FREQUENCY);
+}
+
+/* The SPI peripheral: reads the buffer at the end of the transfer, then "interrupts" */
+static void* dma_thread_cb(void* param)
+{
+	for (;;)
+	{
+		pthread_mutex_lock(&dma_mutex);
+		while (!dma_busy) pthread_cond_wait(&dma_cond, &dma_mutex);
+		pthread_mutex_unlock(&dma_mutex);
+
+		wire_wait(dma_w * dma_h);
+		panel_put(dma_x, dma_y, dma_w, 0, dma_data, dma_w * dma_h, false);
+
+		pthread_mutex_lock(&dma_mutex);
+		dma_busy = false;
+		pthread_cond_broadcast(&dma_cond);
+		pthread_mutex_unlock(&dma_mutex);
+
+		if (dma_done_cb) dma_done_cb();
+	}
+	return NULL;
+}
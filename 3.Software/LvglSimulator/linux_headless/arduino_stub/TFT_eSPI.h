@@ -0,0 +1,50 @@
+/**
+ * @file TFT_eSPI.h
+ * Mock of the TFT_eSPI calls the firmware's display.cpp makes. The pixels go to a memory panel
+ * (the bytes the ST7789 would receive) instead of SPI, and every transfer takes as long as
+ * it would on the bus at `MOCK_SPI_FREQUENCY`. DMA transfers run on a thread standing in
+ * for the SPI peripheral and read the buffer only at their end, so a buffer LVGL draws into
+ * too early shows up in the snapshots.
+ */
+
+#ifndef TFT_ESPI_STUB_H
+#define TFT_ESPI_STUB_H
+
+#include "Arduino.h"
+#include "mock_spi.h"
+
+/* Like SPI_FREQUENCY in the firmware's lib/TFT_eSPI/User_Setup.h */
+#define MOCK_SPI_FREQUENCY 27000000
+
+class TFT_eSPI
+{
+public:
+	TFT_eSPI(int16_t w = 240, int16_t h = 240);
+
+	void begin();
+	/* The panel buffer stays unmirrored, like the runner's own flush */
+	void setRotation(uint8_t r);
+	void setSwapBytes(bool swap);
+
+	void startWrite();
+	void endWrite();
+	void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+	void pushColors(uint16_t* data, uint32_t len, bool swap = true);
+
+	bool initDMA(bool ctrl_cs = false);
+	void setDMACallback(void (*cb)(void));
+	/* Waits for the previous transfer, then queues this one and returns */
+	void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+	bool dmaBusy();
+	void dmaWait();
+
+private:
+	int16_t width;
+	bool swap_bytes;
+	int32_t win_x;
+	int32_t win_y;
+	int32_t win_w;
+	uint32_t win_pos;
+};
+
+#endif /*TFT_ESPI_STUB_H*/
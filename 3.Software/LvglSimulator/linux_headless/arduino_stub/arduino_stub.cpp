@@ -0,0 +1,163 @@
+/**
+ * @file arduino_stub.cpp
+ * Arduino-ESP32 and FreeRTOS calls of the firmware's display.cpp on a PC (see Arduino.h)
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include "Arduino.h"
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**********************
+*      TYPEDEFS
+**********************/
+struct stub_task
+{
+	pthread_t thread;
+	TaskFunction_t fn;
+	void* param;
+	uint32_t stack_depth;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	uint32_t notified;
+};
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static stub_task* task_new(uint32_t stack_depth);
+static void* task_thread_cb(void* param);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static thread_local stub_task* current_task;
+
+/**********************
+*  GLOBAL VARIABLES
+**********************/
+HardwareSerial Serial;
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* param,
+	UBaseType_t prio, TaskHandle_t* handle, BaseType_t core)
+{
+	stub_task* task = task_new(stack_depth);
+	task->fn = fn;
+	task->param = param;
+	if (handle) *handle = task;
+	return pthread_create(&task->thread, NULL, task_thread_cb, task) == 0 ? pdPASS : pdFALSE;
+}
+
+/* Threads not started by xTaskCreatePinnedToCore() (the runner's main) get a handle too */
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+	if (current_task == NULL) current_task = task_new(0);
+	return current_task;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+	pthread_mutex_lock(&task->mutex);
+	task->notified++;
+	pthread_cond_signal(&task->cond);
+	pthread_mutex_unlock(&task->mutex);
+	return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+	stub_task* task = xTaskGetCurrentTaskHandle();
+
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	uint64_t ns = deadline.tv_nsec + (uint64_t)ticks * portTICK_PERIOD_MS * 1000000;
+	deadline.tv_sec += ns / 1000000000;
+	deadline.tv_nsec = ns % 1000000000;
+
+	pthread_mutex_lock(&task->mutex);
+	while (task->notified == 0)
+	{
+		if (ticks == portMAX_DELAY) pthread_cond_wait(&task->cond, &task->mutex);
+		else if (pthread_cond_timedwait(&task->cond, &task->mutex, &deadline) != 0) break;
+	}
+	uint32_t value = task->notified;
+	if (value) task->notified = clear ? 0 : value - 1;
+	pthread_mutex_unlock(&task->mutex);
+	return value;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+	return task ? task->stack_depth : xTaskGetCurrentTaskHandle()->stack_depth;
+}
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits)
+{
+	return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel)
+{
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty)
+{
+}
+
+int HardwareSerial::printf(const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	int len = vfprintf(stderr, fmt, args);
+	va_end(args);
+	return len;
+}
+
+void HardwareSerial::println(const char* line)
+{
+	fprintf(stderr, "%s\n", line);
+}
+
+void HardwareSerial::flush()
+{
+	fflush(stderr);
+}
+
+int HardwareSerial::available()
+{
+	return 0;
+}
+
+int HardwareSerial::read()
+{
+	return -1;
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+static stub_task* task_new(uint32_t stack_depth)
+{
+	stub_task* task = (stub_task*)calloc(1, sizeof(stub_task));
+	task->stack_depth = stack_depth;
+	pthread_mutex_init(&task->mutex, NULL);
+	pthread_cond_init(&task->cond, NULL);
+	return task;
+}
+
+static void* task_thread_cb(void* param)
+{
+	current_task = (stub_task*)param;
+	current_task->fn(current_task->param);
+	return NULL;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file ff.h
+ * The FATFS calls of the firmware's lv_port_fatfs.c and sd_config.cpp on a host directory
+ * (ff_stub.c), for the unit tests. The names, types and result codes are FATFS's; a file has
+ * no clusters on a PC, `obj.sclust` is always 0.
+ */
+
+#ifndef FF_STUB_H
+#define FF_STUB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <dirent.h>
+
+	typedef unsigned int UINT;
+	typedef unsigned char BYTE;
+	typedef uint16_t WORD;
+	typedef uint32_t DWORD;
+	typedef DWORD FSIZE_t;
+
+	typedef enum
+	{
+		FR_OK = 0,
+		FR_DISK_ERR,
+		FR_INT_ERR,
+		FR_NOT_READY,
+		FR_NO_FILE,
+		FR_NO_PATH,
+		FR_INVALID_NAME,
+		FR_DENIED,
+		FR_EXIST,
+		FR_INVALID_OBJECT,
+	} FRESULT;
+
+	/* Mode flags of f_open */
+#define FA_READ             0x01
+#define FA_WRITE            0x02
+#define FA_OPEN_EXISTING    0x00
+#define FA_CREATE_NEW       0x04
+#define FA_CREATE_ALWAYS    0x08
+#define FA_OPEN_ALWAYS      0x10
+
+	/* `fattrib` of FILINFO */
+#define AM_RDO              0x01
+#define AM_DIR              0x10
+
+	typedef struct
+	{
+		DWORD sclust;
+		FSIZE_t objsize;
+	} FFOBJID;
+
+	typedef struct
+	{
+		FFOBJID obj;
+		BYTE flag;
+		FSIZE_t fptr;
+		FILE* fp;
+	} FIL;
+
+	typedef struct
+	{
+		DIR* dir;
+		char path[256];
+	} FF_DIR;
+
+	typedef struct
+	{
+		FSIZE_t fsize;
+		WORD fdate;
+		WORD ftime;
+		BYTE fattrib;
+		char fname[256];
+	} FILINFO;
+
+#define f_size(fp)  ((fp)->obj.objsize)
+#define f_tell(fp)  ((fp)->fptr)
+
+	/* The directory the absolute paths of FATFS ("/Scenes/...") are in, "." by default */
+	void ff_stub_set_root(const char* dir);
+
+	FRESULT f_open(FIL* fp, const char* path, BYTE mode);
+	FRESULT f_close(FIL* fp);
+	FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br);
+	FRESULT f_write(FIL* fp, const void* buff, UINT btw, UINT* bw);
+	FRESULT f_lseek(FIL* fp, FSIZE_t ofs);
+	FRESULT f_truncate(FIL* fp);
+	FRESULT f_sync(FIL* fp);
+	FRESULT f_rename(const char* path_old, const char* path_new);
+	FRESULT f_stat(const char* path, FILINFO* fno);
+	FRESULT f_opendir(FF_DIR* dp, const char* path);
+	FRESULT f_closedir(FF_DIR* dp);
+	/* An empty `fname` at the end of the directory */
+	FRESULT f_readdir(FF_DIR* dp, FILINFO* fno);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*FF_STUB_H*/
@@ -0,0 +1,189 @@
+/**
+ * @file ff_stub.c
+ * FATFS on a host directory for the unit tests (see ff.h)
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include "ff.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/*********************
+*      DEFINES
+*********************/
+#define PATH_LEN    512
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static bool real_path(char* out, size_t size, const char* path);
+static void stat_to_info(const struct stat* st, const char* name, FILINFO* fno);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static char root[PATH_LEN] = ".";
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void ff_stub_set_root(const char* dir)
+{
+	snprintf(root, sizeof(root), "%s", dir);
+}
+
+FRESULT f_open(FIL* fp, const char* path, BYTE mode)
+{
+	char p[PATH_LEN];
+	if (!real_path(p, sizeof(p), path)) return FR_INVALID_NAME;
+
+	memset(fp, 0, sizeof(FIL));
+	if ((mode & FA_WRITE) == 0) fp->fp = fopen(p, "rb");
+	else if (mode & FA_CREATE_ALWAYS) fp->fp = fopen(p, "w+b");
+	else
+	{
+		fp->fp = fopen(p, "r+b");
+		if (fp->fp == NULL && (mode & (FA_OPEN_ALWAYS | FA_CREATE_NEW))) fp->fp = fopen(p, "w+b");
+	}
+	if (fp->fp == NULL) return FR_NO_FILE;
+
+	fseek(fp->fp, 0, SEEK_END);
+	fp->obj.objsize = ftell(fp->fp);
+	fp->flag = mode;
+	return FR_OK;
+}
+
+FRESULT f_close(FIL* fp)
+{
+	if (fp->fp == NULL) return FR_INVALID_OBJECT;
+	fclose(fp->fp);
+	fp->fp = NULL;
+	return FR_OK;
+}
+
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br)
+{
+	*br = 0;
+	if ((fp->flag & FA_READ) == 0) return FR_DENIED;
+	if (fseek(fp->fp, fp->fptr, SEEK_SET) != 0) return FR_DISK_ERR;
+	*br = fread(buff, 1, btr, fp->fp);
+	fp->fptr += *br;
+	return ferror(fp->fp) ? FR_DISK_ERR : FR_OK;
+}
+
+FRESULT f_write(FIL* fp, const void* buff, UINT btw, UINT* bw)
+{
+	*bw = 0;
+	if ((fp->flag & FA_WRITE) == 0) return FR_DENIED;
+	if (fseek(fp->fp, fp->fptr, SEEK_SET) != 0) return FR_DISK_ERR;
+	*bw = fwrite(buff, 1, btw, fp->fp);
+	fp->fptr += *bw;
+	if (fp->fptr > fp->obj.objsize) fp->obj.objsize = fp->fptr;
+	return *bw == btw ? FR_OK : FR_DISK_ERR;
+}
+
+/* Like FATFS: beyond the end only in write mode, which expands the file */
+FRESULT f_lseek(FIL* fp, FSIZE_t ofs)
+{
+	if (ofs > fp->obj.objsize && (fp->flag & FA_WRITE) == 0) ofs = fp->obj.objsize;
+	fp->fptr = ofs;
+	if (ofs > fp->obj.objsize) fp->obj.objsize = ofs;
+	return FR_OK;
+}
+
+FRESULT f_truncate(FIL* fp)
+{
+	if ((fp->flag & FA_WRITE) == 0) return FR_DENIED;
+	fflush(fp->fp);
+	if (ftruncate(fileno(fp->fp), fp->fptr) != 0) return FR_DISK_ERR;
+	fp->obj.objsize = fp->fptr;
+	return FR_OK;
+}
+
+FRESULT f_sync(FIL* fp)
+{
+	return fflush(fp->fp) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+FRESULT f_rename(const char* path_old, const char* path_new)
+{
+	char p_old[PATH_LEN];
+	char p_new[PATH_LEN];
+	if (!real_path(p_old, sizeof(p_old), path_old) || !real_path(p_new, sizeof(p_new), path_new)) return FR_INVALID_NAME;
+	return rename(p_old, p_new) == 0 ? FR_OK : FR_NO_FILE;
+}
+
+FRESULT f_stat(const char* path, FILINFO* fno)
+{
+	char p[PATH_LEN];
+	struct stat st;
+	if (!real_path(p, sizeof(p), path)) return FR_INVALID_NAME;
+	if (stat(p, &st) != 0) return FR_NO_FILE;
+
+	const char* name = strrchr(path, '/');
+	stat_to_info(&st, name ? name + 1 : path, fno);
+	return FR_OK;
+}
+
+FRESULT f_opendir(FF_DIR* dp, const char* path)
+{
+	if (!real_path(dp->path, sizeof(dp->path), path)) return FR_INVALID_NAME;
+	dp->dir = opendir(dp->path);
+	return dp->dir ? FR_OK : FR_NO_PATH;
+}
+
+FRESULT f_closedir(FF_DIR* dp)
+{
+	if (dp->dir == NULL) return FR_INVALID_OBJECT;
+	closedir(dp->dir);
+	dp->dir = NULL;
+	return FR_OK;
+}
+
+FRESULT f_readdir(FF_DIR* dp, FILINFO* fno)
+{
+	struct dirent* ent = readdir(dp->dir);
+	if (ent == NULL)
+	{
+		memset(fno, 0, sizeof(FILINFO));
+		return FR_OK;
+	}
+
+	char p[PATH_LEN * 2];
+	struct stat st;
+	snprintf(p, sizeof(p), "%s/%s", dp->path, ent->d_name);
+	if (stat(p, &st) != 0) return FR_DISK_ERR;
+	stat_to_info(&st, ent->d_name, fno);
+	return FR_OK;
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+/* false: the path doesn't fit */
+static bool real_path(char* out, size_t size, const char* path)
+{
+	return snprintf(out, size, "%s/%s", root, path[0] == '/' ? path + 1 : path) < PATH_LEN;
+}
+
+/* The size, the FAT date and time stamp and the attributes */
+static void stat_to_info(const struct stat* st, const char* name, FILINFO* fno)
+{
+	struct tm tm;
+	localtime_r(&st->st_mtime, &tm);
+
+	fno->fsize = st->st_size;
+	fno->fdate = (WORD)(((tm.tm_year - 80) << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday);
+	fno->ftime = (WORD)((tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec / 2));
+	fno->fattrib = S_ISDIR(st->st_mode) ? AM_DIR : 0;
+	strncpy(fno->fname, name, sizeof(fno->fname) - 1);
+	fno->fname[sizeof(fno->fname) - 1] = '\0';
+}
@@ -0,0 +1,25 @@
+/**
+ * @file mock_spi.h
+ * Where the mock TFT_eSPI (TFT_eSPI.h) puts the pixels, for the C runner
+ */
+
+#ifndef MOCK_SPI_H
+#define MOCK_SPI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+	/* `panel`: `w` x `h` pixels of RGB565 in the byte order they leave on the bus */
+	void mock_spi_attach(uint8_t* panel, uint16_t w, uint16_t h);
+
+	/* Pixels that reached the panel so far */
+	uint64_t mock_spi_px(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*MOCK_SPI_H*/
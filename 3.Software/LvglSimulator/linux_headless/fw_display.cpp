@@ -0,0 +1,44 @@
+/**
+ * @file fw_display.cpp
+ * The firmware's Display for the runner (see fw_display.h)
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include "fw_display.h"
+#include "display.h"
+#include <stdio.h>
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static Display screen;
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void fw_display_init(void)
+{
+	screen.init();
+}
+
+const char* fw_display_mode(void)
+{
+#if LCD_FLUSH_MODE == LCD_FLUSH_DMA
+	return "LCD_FLUSH_DMA";
+#elif LCD_FLUSH_MODE == LCD_FLUSH_TASK
+	return "LCD_FLUSH_TASK";
+#else
+	return "LCD_FLUSH_BLOCKING";
+#endif
+}
+
+void fw_display_print_stats(void)
+{
+	FlushStats stats;
+	screen.getFlushStats(&stats);
+	printf("# flush: %s, %u stripes, queue max %u, stall %u us, busy %u us, stack %u bytes\n",
+		fw_display_mode(), stats.stripes, stats.queue_depth_max, stats.stall_us, stats.busy_us, stats.stack_free);
+}
@@ -0,0 +1,26 @@
+/**
+ * @file fw_display.h
+ * The firmware's Display (display.cpp) for the runner, pushing to the mock SPI panel of arduino_stub
+ */
+
+#ifndef FW_DISPLAY_H
+#define FW_DISPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* Display::init(), registers the display driver of the firmware */
+	void fw_display_init(void);
+
+	/* LCD_FLUSH_MODE it was built with ("make FLUSH=LCD_FLUSH_DMA") */
+	const char* fw_display_mode(void);
+
+	/* Print Display::getFlushStats() like the firmware's loop() */
+	void fw_display_print_stats(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*FW_DISPLAY_H*/
@@ -0,0 +1,1245 @@
+/**
+* @file main
+* Headless HoloCubic GUI runner for Linux.
+* Renders the firmware's screens with the firmware's LVGL and lv_conf.h into a memory frame buffer
+* holding the bytes the panel would receive, drives the encoder from a script
+* and reports the render and flush time and the pixels of every frame.
+* The LVGL tick is virtual, so the same command renders the same frames on every run.
+*/
+
+/*********************
+*      INCLUDES
+*********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "lv_examples/lv_examples.h"
+#include "lv_cubic_gui.h"
+#include "gui_guider.h"
+#include "lv_port_indev.h"
+#include "lv_port_gpu.h"
+#include "lv_holo_player.h"
+#include "lv_holo_anim.h"
+#include "lv_holo_img.h"
+#include "lv_holo_jpeg.h"
+#include "lv_holo_prefetch.h"
+#include "lv_holo_meta.h"
+#include "lv_holo_io.h"
+#include "lv_port_fs_cache.h"
+#include "mock_spi.h"
+#include "fw_display.h"
+
+/*********************
+*      DEFINES
+*********************/
+#define LOOP_PERIOD     5       /*[ms] virtual time between two `lv_task_handler` calls*/
+#define ENC_STEP_TIME   200     /*[ms] virtual time of one encoder script step*/
+#define BUF_LINES       10      /*Same as `LCD_BUF_LINES` in the firmware*/
+#define HOLO_SCENE      "/Scenes/Holo3D/frame%03d.bin"
+#define HOLO_FPS        25
+#define HOLO_ANIM       "/Scenes/Holo3D.hanim"
+#define INDEXED_SIZE    240     /*[px] width and height of the images of the indexed benchmark*/
+#define INDEXED_LOOPS   20
+#define ROTATE_PERIOD   3000    /*[ms] time of a full turn of the rotate scenario*/
+#define TRANSFORM_LOOPS 10
+#define GPU_LOOPS       2000
+#define IO_LOG          "/io_log.txt"
+#define IO_LOG_PERIOD   10      /*[ms] a log line is appended in the background*/
+
+/**********************
+*      TYPEDEFS
+**********************/
+/* Like in lv_port_fatfs.c */
+typedef struct
+{
+	FILE* fp;
+	lv_port_fs_cache_t cache;
+} file_t;
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void usage(const char* name);
+static void hal_init(bool gpu, bool fw);
+static void fs_init(void);
+static lv_fs_res_t fs_read_at(void* file_p, uint32_t pos, void* buf, uint32_t btr, uint32_t* br);
+static bool fs_stat(const char* path, uint32_t* size, uint32_t* stamp);
+static void anim_src_init(const char* path);
+static void anim_src_task_cb(lv_task_t* task);
+static void files_src_init(const char* path_fmt, uint32_t prefetch_slots);
+static void files_src_task_cb(lv_task_t* task);
+static long frames_count(const char* path_fmt);
+static void io_src_init(const char* path_fmt);
+static void io_src_task_cb(lv_task_t* task);
+static void io_frame_cb(lv_holo_io_res_t* res);
+static void io_log_task_cb(lv_task_t* task);
+static void indexed_bench(void);
+static void indexed_line_ref(const lv_img_dsc_t* img, const lv_color_t* palette, const lv_opa_t* opa,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+static void rotate_init(const char* path);
+static void transform_bench(void);
+static void gpu_bench(void);
+static void gpu_run(lv_disp_drv_t* drv, lv_color_t* buf, const lv_color_t* map, lv_coord_t w, lv_coord_t h,
+	lv_opa_t opa);
+static void transform_run(lv_img_transform_dsc_t* dsc, const lv_area_t* area, bool line,
+	lv_color_t* cbuf, lv_opa_t* abuf, uint64_t* time);
+static void disp_flush(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+static void fw_disp_flush(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+static void panel_sync(void);
+static void panel_write(const lv_area_t* area, const lv_color_t* color_p);
+static void encoder_group_init(void);
+static void encoder_step(char cmd);
+static void snapshot_save(const char* scenario, uint32_t time);
+static uint64_t time_us(void);
+static int cmp_u32(const void* a, const void* b);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static uint8_t panel_buf[LV_HOR_RES_MAX * LV_VER_RES_MAX * 2];  /*RGB565, high byte first like on SPI*/
+static uint32_t frame_px;
+static uint32_t flush_time;
+static uint64_t flush_px;
+static bool cpu_swap;
+static bool fw_flush;
+static void (*fw_flush_cb)(lv_disp_drv_t*, const lv_area_t*, lv_color_t*);
+static uint32_t virt_ms;
+static const char* sd_root = ".";
+static uint32_t fs_cache_sectors;
+static uint32_t fs_open_cnt;
+static uint32_t fs_read_cnt;
+static uint32_t fs_bytes_read;
+static const char* out_dir = ".";
+static char anim_path[LV_HOLO_PLAYER_PATH_MAX];
+static uint32_t anim_frame_cnt;
+static uint32_t anim_frame_id;
+static lv_img_dsc_t io_dsc;
+static uint8_t* io_frame;
+static uint32_t io_log_cnt;
+
+/* Set by the IMU on the device */
+extern int32_t encoder_diff;
+extern lv_indev_state_t encoder_state;
+
+lv_ui guider_ui;
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+int main(int argc, char** argv)
+{
+	uint32_t duration = 0;
+	uint32_t snapshot_period = 0;
+	const char* enc_script = NULL;
+	const char* scene = NULL;
+	uint32_t prefetch_slots = 0;
+	const char* meta_index = NULL;
+	bool gpu = false;
+	bool quiet = false;
+	bool real_time = false;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "d:e:s:o:r:a:p:i:c:gfwtqh")) != -1)
+	{
+		switch (opt)
+		{
+		case 'd': duration = atoi(optarg); break;
+		case 'e': enc_script = optarg; break;
+		case 's': snapshot_period = atoi(optarg); break;
+		case 'o': out_dir = optarg; break;
+		case 'r': sd_root = optarg; break;
+		case 'a': scene = optarg; break;
+		case 'p': prefetch_slots = atoi(optarg); break;
+		case 'i': meta_index = optarg; break;
+		case 'c': fs_cache_sectors = atoi(optarg); break;
+		case 'g': gpu = true; break;
+		case 'f': fw_flush = true; break;
+		case 'w': cpu_swap = true; break;
+		case 't': real_time = true; break;
+		case 'q': quiet = true; break;
+		default: usage(argv[0]); return 1;
+		}
+	}
+	if (optind != argc - 1)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	const char* scenario = argv[optind];
+
+	lv_init();
+	hal_init(gpu, fw_flush);
+	fs_init();
+	lv_holo_anim_decoder_init();
+	lv_holo_img_decoder_init();
+	lv_holo_jpeg_decoder_init();
+
+	if (strcmp(scenario, "benchmark") == 0)
+	{
+		lv_demo_benchmark();
+		if (duration == 0) duration = 100000;
+	}
+	else if (strcmp(scenario, "cubic") == 0)
+	{
+		lv_holo_cubic_gui();
+	}
+	else if (strcmp(scenario, "home") == 0)
+	{
+		setup_scr_home(&guider_ui);
+		lv_scr_load(guider_ui.home);
+	}
+	else if (strcmp(scenario, "scenes") == 0)
+	{
+		setup_scr_scenes(&guider_ui);
+		lv_scr_load(guider_ui.scenes);
+	}
+	else if (strcmp(scenario, "guider") == 0)
+	{
+		setup_ui(&guider_ui);
+	}
+	else if (strcmp(scenario, "holo") == 0)
+	{
+		setup_scr_scenes(&guider_ui);
+		lv_scr_load(guider_ui.scenes);
+
+		char path[LV_HOLO_PLAYER_PATH_MAX];
+		snprintf(path, sizeof(path), "%s%s", sd_root, scene ? scene : HOLO_SCENE);
+		if (!lv_holo_player_open(guider_ui.scenes_canvas, path, 0, scene ? 0 : HOLO_FPS))
+		{
+			fprintf(stderr, "Can't play %s\n", path);
+			return 1;
+		}
+		/* The reader is a real thread */
+		real_time = true;
+	}
+	else if (strcmp(scenario, "anim") == 0)
+	{
+		setup_scr_scenes(&guider_ui);
+		lv_scr_load(guider_ui.scenes);
+		anim_src_init(scene ? scene : HOLO_ANIM);
+	}
+	else if (strcmp(scenario, "files") == 0)
+	{
+		setup_scr_scenes(&guider_ui);
+		lv_scr_load(guider_ui.scenes);
+		files_src_init(scene ? scene : HOLO_SCENE, prefetch_slots);
+		/* The read-ahead worker is a real thread */
+		if (prefetch_slots) real_time = true;
+	}
+	else if (strcmp(scenario, "io") == 0)
+	{
+		setup_scr_scenes(&guider_ui);
+		lv_scr_load(guider_ui.scenes);
+		io_src_init(scene ? scene : HOLO_SCENE);
+		/* The storage service is a real thread */
+		real_time = true;
+	}
+	else if (strcmp(scenario, "indexed") == 0)
+	{
+		/* Only the decoder, nothing is rendered */
+		indexed_bench();
+		return 0;
+	}
+	else if (strcmp(scenario, "rotate") == 0)
+	{
+		rotate_init(scene);
+	}
+	else if (strcmp(scenario, "transform") == 0)
+	{
+		/* Only the transformation, nothing is rendered */
+		transform_bench();
+		return 0;
+	}
+	else if (strcmp(scenario, "gpu") == 0)
+	{
+		/* Only the fills and blends, nothing is rendered */
+		gpu_bench();
+		return 0;
+	}
+	else
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	if (duration == 0) duration = 3000;
+
+	/* After the read-ahead decoder of the files scenario, so the index is asked first */
+	if (meta_index)
+	{
+		char path[LV_FS_MAX_PATH_LENGTH];
+		snprintf(path, sizeof(path), "S:%s", meta_index);
+		lv_holo_meta_init(path, fs_stat);
+	}
+
+	if (enc_script) encoder_group_init();
+
+	uint32_t frame_cnt = 0;
+	uint32_t frame_cap = 1024;
+	uint32_t* frame_times = malloc(frame_cap * sizeof(uint32_t));
+	uint64_t px_sum = 0;
+	uint64_t time_sum = 0;
+	uint64_t flush_sum = 0;
+	uint64_t idle_sum = 0;      /*time in `lv_task_handler` without rendering*/
+
+	/* LVGL renders in the panel's byte order with LV_COLOR_16_SWAP, otherwise the flush swaps */
+	if (LV_COLOR_16_SWAP == 0) cpu_swap = true;
+
+	if (!quiet) printf("frame,time_ms,render_us,flush_us,px\n");
+
+	while (virt_ms < duration)
+	{
+		/* The first step is after ENC_STEP_TIME to let the GUI settle */
+		if (enc_script && virt_ms % ENC_STEP_TIME == 0 && virt_ms > 0)
+		{
+			uint32_t step = virt_ms / ENC_STEP_TIME - 1;
+			encoder_step(step < strlen(enc_script) ? enc_script[step] : '.');
+		}
+
+		frame_px = 0;
+		flush_time = 0;
+		uint64_t start = time_us();
+		lv_task_handler();
+		uint32_t render_time = (uint32_t)(time_us() - start);
+
+		if (frame_px)
+		{
+			if (frame_cnt == frame_cap)
+			{
+				frame_cap *= 2;
+				frame_times = realloc(frame_times, frame_cap * sizeof(uint32_t));
+			}
+			frame_times[frame_cnt] = render_time;
+			frame_cnt++;
+			px_sum += frame_px;
+			time_sum += render_time;
+			flush_sum += flush_time;
+			if (!quiet) printf("%u,%u,%u,%u,%u\n", frame_cnt, virt_ms, render_time, flush_time, frame_px);
+		}
+		else
+		{
+			idle_sum += render_time;
+		}
+
+		virt_ms += LOOP_PERIOD;
+		if (real_time) usleep(LOOP_PERIOD * 1000);
+		if (snapshot_period && virt_ms % snapshot_period == 0) snapshot_save(scenario, virt_ms);
+	}
+	snapshot_save(scenario, virt_ms);
+
+	if (frame_cnt)
+	{
+		qsort(frame_times, frame_cnt, sizeof(uint32_t), cmp_u32);
+		printf("# %s: %u frames, %llu px, render_us avg %llu, p50 %u, p95 %u, max %u, flush_us avg %llu (%s), idle_us %llu\n",
+			scenario, frame_cnt, (unsigned long long)px_sum, (unsigned long long)(time_sum / frame_cnt),
+			frame_times[frame_cnt / 2], frame_times[(frame_cnt * 95) / 100], frame_times[frame_cnt - 1],
+			(unsigned long long)(flush_sum / frame_cnt),
+			fw_flush ? fw_display_mode() : cpu_swap ? "byte swap" : "no swap",
+			(unsigned long long)idle_sum);
+	}
+	else
+	{
+		printf("# %s: nothing was rendered\n", scenario);
+	}
+	if (fw_flush) fw_display_print_stats();
+
+	if (lv_holo_player_is_open())
+	{
+		lv_holo_player_stats_t stats;
+		lv_holo_player_get_stats(&stats);
+		printf("# player: %u frames shown, %u dropped, %.1f fps, %u bytes read in %u us (%.0f kB/s), %u frames by sectors\n",
+			stats.frames_shown, stats.frames_dropped, stats.fps, stats.bytes_read, stats.read_us,
+			stats.read_kb_per_sec, stats.frames_raw);
+		lv_holo_player_close();
+	}
+
+	lv_img_cache_stats_t cache;
+	lv_img_cache_get_stats(&cache);
+	printf("# img cache: %u hits, %u misses (%u ms to open), %u evicted, %u images in %u bytes\n",
+		cache.hits, cache.misses, cache.open_time, cache.evictions, cache.entry_cnt, cache.size);
+
+	if (fs_open_cnt)
+	{
+		printf("# fs: %u bytes in %u reads, %u opens\n", fs_bytes_read, fs_read_cnt, fs_open_cnt);
+	}
+
+	if (fs_cache_sectors)
+	{
+		lv_port_fs_cache_stats_t stats;
+		lv_port_fs_cache_get_stats(&stats);
+		printf("# fs cache: %u hits, %u misses, %u bytes read, %u from the card (%u direct)\n",
+			stats.hits, stats.misses, stats.bytes_read, stats.bytes_file, stats.bytes_direct);
+	}
+
+	if (meta_index)
+	{
+		lv_holo_meta_stats_t stats;
+		lv_holo_meta_get_stats(&stats);
+		printf("# meta: %u hits, %u misses, %u changed, %u replaced, %u files\n",
+			stats.hits, stats.misses, stats.changed, stats.replaced, stats.entry_cnt);
+		if (!lv_holo_meta_save()) fprintf(stderr, "Can't write %s\n", meta_index);
+	}
+
+	if (prefetch_slots)
+	{
+		lv_holo_prefetch_stats_t stats;
+		lv_holo_prefetch_get_stats(&stats);
+		printf("# prefetch: %u hits, %u misses, %u stalls (%u us), %u loads, %u bytes read in %u us\n",
+			stats.hits, stats.misses, stats.stalls, stats.stall_us, stats.loads, stats.bytes_read, stats.read_us);
+	}
+
+	if (strcmp(scenario, "io") == 0)
+	{
+		lv_holo_io_stats_t stats;
+		lv_holo_io_get_stats(&stats);
+		printf("# io: %u requests (%u failed, %u refused), %u bytes read, %u written, busy %u us, "
+			"wait max %u/%u/%u us (low/mid/high)\n",
+			stats.done, stats.failed, stats.full, stats.bytes_read, stats.bytes_written, stats.busy_us,
+			stats.wait_us_max[LV_HOLO_IO_PRIO_LOW], stats.wait_us_max[LV_HOLO_IO_PRIO_MID],
+			stats.wait_us_max[LV_HOLO_IO_PRIO_HIGH]);
+	}
+
+	free(frame_times);
+	return 0;
+}
+
+uint32_t millis(void)
+{
+	return virt_ms;
+}
+
+uint32_t micros(void)
+{
+	return (uint32_t)time_us();
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+static void usage(const char* name)
+{
+	fprintf(stderr,
+		"Usage: %s [options] <benchmark|cubic|home|scenes|guider|holo|anim|files|io|indexed|rotate|transform|gpu>\n"
+		"  holo: play %s from the SD card (-r) with %d fps in real time\n"
+		"  anim: show the frames of %s one by one with the image decoder\n"
+		"  files: show the files of the holo scene one by one with lv_img_set_src\n"
+		"  io: load the files of the holo scene with lv_holo_io while it appends to %s (in real time)\n"
+		"  indexed: time the line reads of indexed images against the pixel by pixel loop\n"
+		"  rotate: turn the logo (or the image of -a) around in every %d ms\n"
+		"  transform: time rotating and zooming the logo line by line against pixel by pixel\n"
+		"  gpu: time the fills and blends of lv_port_gpu (-g) against doing them inline\n"
+		"  -d <ms>      virtual run time (default: 3000, benchmark: 100000)\n"
+		"  -e <script>  encoder script, one step in every %d ms:\n"
+		"               r: turn right, l: turn left, p: press, .: nothing\n"
+		"  -s <ms>      save a PPM snapshot in every <ms> (default: only at the end)\n"
+		"  -o <dir>     directory of the snapshots (default: .)\n"
+		"  -r <dir>     directory used as the SD card \"S:\" (default: .)\n"
+		"  -a <file>    scene of holo (.bin sequence or .hanim), anim and files, image of rotate on the SD card\n"
+		"  -p <n>       files: read ahead with lv_holo_prefetch in <n> buffers (in real time)\n"
+		"  -i <file>    keep the image headers with lv_holo_meta, in the index <file> on the SD card\n"
+		"  -c <n>       cache <n> sectors of every opened file like the firmware's FATFS port\n"
+		"  -g           share fills and blends with a worker thread (lv_port_gpu)\n"
+		"  -f           flush with the firmware's display.cpp to a mock SPI panel, in the\n"
+		"               LCD_FLUSH_MODE it was built with (make FLUSH=LCD_FLUSH_DMA)\n"
+		"  -w           swap the bytes in the flush like pushColors(..., true) even if\n"
+		"               LVGL renders in the panel's byte order (to measure the swap)\n"
+		"  -t           run in real time\n"
+		"  -q           print only the summary, not every frame\n",
+		name, HOLO_SCENE, HOLO_FPS, HOLO_ANIM, IO_LOG, ROTATE_PERIOD, ENC_STEP_TIME);
+}
+
+/**
+* Initialize the display and the encoder like the firmware does,
+* but render into `frame_buf`
+*/
+static void hal_init(bool gpu, bool fw)
+{
+	if (fw)
+	{
+		/* Display::init() registers the firmware's driver, its flush is only timed here */
+		mock_spi_attach(panel_buf, LV_HOR_RES_MAX, LV_VER_RES_MAX);
+		fw_display_init();
+		lv_disp_t* disp = lv_disp_get_default();
+		fw_flush_cb = disp->driver.flush_cb;
+		disp->driver.flush_cb = fw_disp_flush;
+		if (gpu && disp->driver.gpu_blend_cb == NULL) lv_port_gpu_init(&disp->driver);
+
+		lv_port_indev_init();
+		return;
+	}
+
+	static lv_disp_buf_t disp_buf;
+	static lv_color_t buf[LV_HOR_RES_MAX * BUF_LINES];
+	lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * BUF_LINES);
+
+	lv_disp_drv_t disp_drv;
+	lv_disp_drv_init(&disp_drv);
+	disp_drv.hor_res = LV_HOR_RES_MAX;
+	disp_drv.ver_res = LV_VER_RES_MAX;
+	disp_drv.flush_cb = disp_flush;
+	disp_drv.buffer = &disp_buf;
+	if (gpu) lv_port_gpu_init(&disp_drv);
+	lv_disp_drv_register(&disp_drv);
+
+	lv_port_indev_init();
+}
+
+static void disp_flush(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p)
+{
+	uint64_t start = time_us();
+	panel_write(area, color_p);
+	flush_time += (uint32_t)(time_us() - start);
+	frame_px += lv_area_get_size(area);
+	flush_px += lv_area_get_size(area);
+
+	lv_disp_flush_ready(disp_drv);
+}
+
+/* The firmware's flush: LVGL's time in it, the stripe reaches the panel later */
+static void fw_disp_flush(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p)
+{
+	uint64_t start = time_us();
+	fw_flush_cb(disp_drv, area, color_p);
+	flush_time += (uint32_t)(time_us() - start);
+	frame_px += lv_area_get_size(area);
+	flush_px += lv_area_get_size(area);
+}
+
+/* Wait until every flushed pixel is on the mock panel */
+static void panel_sync(void)
+{
+	while (fw_flush && mock_spi_px() < flush_px) usleep(100);
+}
+
+/* Do what TFT_eSPI does with the pixels before they go to SPI */
+static void panel_write(const lv_area_t* area, const lv_color_t* color_p)
+{
+	int32_t w = lv_area_get_width(area);
+	int32_t x;
+	int32_t y;
+	for (y = area->y1; y <= area->y2; y++)
+	{
+		uint8_t* dest = &panel_buf[(y * LV_HOR_RES_MAX + area->x1) * 2];
+		if (cpu_swap)
+		{
+			const uint16_t* src = (const uint16_t*)color_p;
+			for (x = 0; x < w; x++)
+			{
+				dest[2 * x] = src[x] >> 8;
+				dest[2 * x + 1] = src[x] & 0xFF;
+			}
+		}
+		else
+		{
+			memcpy(dest, color_p, w * 2);
+		}
+		color_p += w;
+	}
+}
+
+/*-----------------------------------
+ * "S:" drive on a host directory
+ *----------------------------------*/
+
+static lv_fs_res_t fs_open(lv_fs_drv_t* drv, void* file_p, const char* path, lv_fs_mode_t mode)
+{
+	char real_path[512];
+	snprintf(real_path, sizeof(real_path), "%s/%s", sd_root, path);
+
+	file_t* file = file_p;
+	file->fp = fopen(real_path, mode == LV_FS_MODE_WR ? "wb" : "rb");
+	fs_open_cnt++;
+	if (file->fp == NULL) return LV_FS_RES_NOT_EX;
+
+	lv_port_fs_cache_init(&file->cache, file, fs_read_at, fs_cache_sectors);
+
+	/* Like lv_fs_if_set_open_cb() of the firmware */
+	struct stat st;
+	fstat(fileno(file->fp), &st);
+	lv_holo_meta_file_opened(path, mode & LV_FS_MODE_WR, st.st_size, 0);
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p)
+{
+	file_t* file = file_p;
+	fclose(file->fp);
+	lv_port_fs_cache_free(&file->cache);
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br)
+{
+	return lv_port_fs_cache_read(&((file_t*)file_p)->cache, buf, btr, br);
+}
+
+/* The reads of the card in the firmware */
+static lv_fs_res_t fs_read_at(void* file_p, uint32_t pos, void* buf, uint32_t btr, uint32_t* br)
+{
+	file_t* file = file_p;
+	fseek(file->fp, pos, SEEK_SET);
+	*br = fread(buf, 1, btr, file->fp);
+	fs_read_cnt++;
+	fs_bytes_read += *br;
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_write(lv_fs_drv_t* drv, void* file_p, const void* buf, uint32_t btw, uint32_t* bw)
+{
+	file_t* file = file_p;
+	fseek(file->fp, file->cache.pos, SEEK_SET);
+	*bw = fwrite(buf, 1, btw, file->fp);
+	file->cache.pos += *bw;
+	lv_port_fs_cache_invalidate(&file->cache);
+	return *bw == btw ? LV_FS_RES_OK : LV_FS_RES_FULL;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos)
+{
+	((file_t*)file_p)->cache.pos = pos;
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p)
+{
+	*pos_p = ((file_t*)file_p)->cache.pos;
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_size(lv_fs_drv_t* drv, void* file_p, uint32_t* size_p)
+{
+	FILE* fp = ((file_t*)file_p)->fp;
+	fseek(fp, 0, SEEK_END);
+	*size_p = ftell(fp);
+	return LV_FS_RES_OK;
+}
+
+/* Like lv_fs_if_stat() of the firmware, with the modification time of the host */
+static bool fs_stat(const char* path, uint32_t* size, uint32_t* stamp)
+{
+	char real_path[512];
+	struct stat st;
+	snprintf(real_path, sizeof(real_path), "%s/%s", sd_root, path + 2);
+	if (stat(real_path, &st) != 0 || !S_ISREG(st.st_mode)) return false;
+
+	*size = st.st_size;
+	*stamp = (uint32_t)st.st_mtime;
+	return true;
+}
+
+static void fs_init(void)
+{
+	lv_fs_drv_t drv;
+	lv_fs_drv_init(&drv);
+
+	drv.file_size = sizeof(file_t);
+	drv.file_extra_size = fs_cache_sectors * LV_PORT_FS_CACHE_SECTOR;	/* the cache's buffer */
+	drv.letter = 'S';
+	drv.open_cb = fs_open;
+	drv.close_cb = fs_close;
+	drv.read_cb = fs_read;
+	drv.write_cb = fs_write;
+	drv.seek_cb = fs_seek;
+	drv.tell_cb = fs_tell;
+	drv.size_cb = fs_size;
+	lv_fs_drv_register(&drv);
+}
+
+/*-----------------------------------
+ * Frames of an animation container
+ * through the image decoder
+ *----------------------------------*/
+
+static void anim_src_init(const char* path)
+{
+	lv_fs_file_t file;
+	lv_holo_anim_header_t header;
+	uint32_t br = 0;
+
+	snprintf(anim_path, sizeof(anim_path), "S:%s", path);
+	if (lv_fs_open(&file, anim_path, LV_FS_MODE_RD) == LV_FS_RES_OK)
+	{
+		lv_fs_read(&file, &header, sizeof(header), &br);
+		lv_fs_close(&file);
+	}
+	if (br != sizeof(header) || !lv_holo_anim_header_check(&header))
+	{
+		fprintf(stderr, "Can't read %s\n", anim_path);
+		exit(1);
+	}
+
+	anim_frame_cnt = header.frame_cnt;
+	anim_frame_id = 0;
+	lv_task_t* task = lv_task_create(anim_src_task_cb, 1000 / (header.fps ? header.fps : HOLO_FPS),
+		LV_TASK_PRIO_MID, NULL);
+	lv_task_ready(task);
+}
+
+static void anim_src_task_cb(lv_task_t* task)
+{
+	char src[LV_HOLO_PLAYER_PATH_MAX + 8];
+	snprintf(src, sizeof(src), "%s#%u", anim_path, anim_frame_id);
+	lv_img_set_src(guider_ui.scenes_canvas, src);
+	anim_frame_id = (anim_frame_id + 1) % anim_frame_cnt;
+}
+
+/*-----------------------------------
+ * Frame files through lv_img_set_src
+ *----------------------------------*/
+
+static void files_src_init(const char* path_fmt, uint32_t prefetch_slots)
+{
+	/* The first frame gives the size of the read-ahead buffers */
+	long size = frames_count(path_fmt);
+	if (prefetch_slots && !lv_holo_prefetch_init(sd_root, prefetch_slots, size))
+	{
+		fprintf(stderr, "Can't allocate the read-ahead buffers\n");
+		exit(1);
+	}
+
+	anim_frame_id = 0;
+	lv_task_t* task = lv_task_create(files_src_task_cb, 1000 / HOLO_FPS, LV_TASK_PRIO_MID, NULL);
+	lv_task_ready(task);
+}
+
+static void files_src_task_cb(lv_task_t* task)
+{
+	char src[LV_HOLO_PLAYER_PATH_MAX + 8];
+	snprintf(src, sizeof(src), anim_path, (int)anim_frame_id);
+	lv_img_set_src(guider_ui.scenes_canvas, src);
+	anim_frame_id = (anim_frame_id + 1) % anim_frame_cnt;
+}
+
+/* Set `anim_path` to "S:<path_fmt>", count the frames into `anim_frame_cnt`, returns the size of the first one */
+static long frames_count(const char* path_fmt)
+{
+	char path[512];
+	snprintf(anim_path, sizeof(anim_path), "S:%s", path_fmt);
+
+	long size = 0;
+	for (anim_frame_cnt = 0;; anim_frame_cnt++)
+	{
+		snprintf(path, sizeof(path), "%s/", sd_root);
+		snprintf(path + strlen(path), sizeof(path) - strlen(path), path_fmt, (int)anim_frame_cnt);
+		FILE* fp = fopen(path, "rb");
+		if (fp == NULL) break;
+		if (size == 0)
+		{
+			fseek(fp, 0, SEEK_END);
+			size = ftell(fp);
+		}
+		fclose(fp);
+	}
+	if (anim_frame_cnt == 0)
+	{
+		fprintf(stderr, "Can't read %s\n", anim_path);
+		exit(1);
+	}
+	return size;
+}
+
+/*-----------------------------------
+ * Frame files through lv_holo_io
+ *----------------------------------*/
+
+/* The LVGL loop only queues the loads and the log lines, the frames are shown when they arrive */
+static void io_src_init(const char* path_fmt)
+{
+	frames_count(path_fmt);
+	lv_holo_io_init(sd_root);
+
+	anim_frame_id = 0;
+	lv_task_t* task = lv_task_create(io_src_task_cb, 1000 / HOLO_FPS, LV_TASK_PRIO_MID, NULL);
+	lv_task_ready(task);
+	lv_task_create(io_log_task_cb, IO_LOG_PERIOD, LV_TASK_PRIO_LOW, NULL);
+}
+
+static void io_src_task_cb(lv_task_t* task)
+{
+	char src[LV_HOLO_PLAYER_PATH_MAX + 8];
+	snprintf(src, sizeof(src), anim_path, (int)anim_frame_id);
+	if (lv_holo_io_read(src, 0, NULL, 0, LV_HOLO_IO_PRIO_HIGH, io_frame_cb, NULL))
+	{
+		anim_frame_id = (anim_frame_id + 1) % anim_frame_cnt;
+	}
+}
+
+static void io_frame_cb(lv_holo_io_res_t* res)
+{
+	if (!res->ok || res->len <= sizeof(lv_img_header_t))
+	{
+		fprintf(stderr, "Can't read %s\n", res->path);
+		return;
+	}
+
+	/* Keep the buffer while it's shown */
+	lv_img_cache_invalidate_src(&io_dsc);
+	free(io_frame);
+	io_frame = res->data;
+	res->data = NULL;
+
+	memcpy(&io_dsc.header, io_frame, sizeof(lv_img_header_t));
+	io_dsc.data = io_frame + sizeof(lv_img_header_t);
+	io_dsc.data_size = res->len - sizeof(lv_img_header_t);
+	lv_img_set_src(guider_ui.scenes_canvas, &io_dsc);
+}
+
+static void io_log_task_cb(lv_task_t* task)
+{
+	char line[64];
+	int len = snprintf(line, sizeof(line), "%u ms: log line %u\n", virt_ms, io_log_cnt++);
+	lv_holo_io_write("S:" IO_LOG, io_log_cnt == 1 ? LV_HOLO_IO_WRITE : LV_HOLO_IO_APPEND, line, len,
+		LV_HOLO_IO_PRIO_LOW, NULL, NULL);
+}
+
+/*-----------------------------------
+ * Indexed image decoding benchmark
+ *----------------------------------*/
+
+/* Read every line of 1, 2, 4 and 8 bit indexed images with the built-in decoder
+ * and with the loop it had before LV_IMG_DECODER_INDEXED_LUT, and compare the time and the pixels */
+static void indexed_bench(void)
+{
+	static const lv_img_cf_t cfs[] = { LV_IMG_CF_INDEXED_1BIT, LV_IMG_CF_INDEXED_2BIT,
+		LV_IMG_CF_INDEXED_4BIT, LV_IMG_CF_INDEXED_8BIT };
+	uint8_t line[INDEXED_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE];
+	uint8_t line_ref[INDEXED_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE];
+	uint32_t c;
+
+	for (c = 0; c < sizeof(cfs) / sizeof(cfs[0]); c++)
+	{
+		lv_img_dsc_t img;
+		memset(&img, 0, sizeof(img));
+		img.header.cf = cfs[c];
+		img.header.w = INDEXED_SIZE;
+		img.header.h = INDEXED_SIZE;
+		img.data_size = lv_img_buf_get_img_size(INDEXED_SIZE, INDEXED_SIZE, cfs[c]);
+		uint8_t* data = malloc(img.data_size);
+		uint32_t i;
+		srand(c);
+		for (i = 0; i < img.data_size; i++) data[i] = rand();
+		img.data = data;
+
+		uint32_t palette_size = 1 << lv_img_cf_get_px_size(cfs[c]);
+		const lv_color32_t* palette32 = (const lv_color32_t*)data;
+		lv_color_t palette[256];
+		lv_opa_t opa[256];
+		for (i = 0; i < palette_size; i++)
+		{
+			palette[i] = lv_color_make(palette32[i].ch.red, palette32[i].ch.green, palette32[i].ch.blue);
+			opa[i] = palette32[i].ch.alpha;
+		}
+
+		lv_img_decoder_dsc_t dsc;
+		if (lv_img_decoder_open(&dsc, &img, LV_COLOR_BLACK) != LV_RES_OK)
+		{
+			fprintf(stderr, "Can't open the indexed image\n");
+			exit(1);
+		}
+
+		/* Whole lines, then lines starting and ending inside a byte */
+		uint64_t lut_us = 0;
+		uint64_t ref_us = 0;
+		bool same = true;
+		uint32_t loop;
+		for (loop = 0; loop < INDEXED_LOOPS; loop++)
+		{
+			lv_coord_t x = loop & 1 ? 3 : 0;
+			lv_coord_t len = INDEXED_SIZE - 2 * x;
+			lv_coord_t y;
+			uint64_t start = time_us();
+			for (y = 0; y < INDEXED_SIZE; y++) lv_img_decoder_read_line(&dsc, x, y, len, line);
+			lut_us += time_us() - start;
+
+			start = time_us();
+			for (y = 0; y < INDEXED_SIZE; y++) indexed_line_ref(&img, palette, opa, x, y, len, line_ref);
+			ref_us += time_us() - start;
+
+			/* Check the last line of every pass */
+			lv_img_decoder_read_line(&dsc, x, INDEXED_SIZE - 1, len, line);
+			if (memcmp(line, line_ref, len * LV_IMG_PX_SIZE_ALPHA_BYTE)) same = false;
+		}
+		lv_img_decoder_close(&dsc);
+		free(data);
+
+		uint64_t px = (uint64_t)INDEXED_SIZE * INDEXED_SIZE * INDEXED_LOOPS;
+		printf("# indexed %u bit: decoder %.2f ns/px, pixel loop %.2f ns/px, %.2fx, %s\n",
+			(unsigned)lv_img_cf_get_px_size(cfs[c]), lut_us * 1000.0 / px, ref_us * 1000.0 / px,
+			lut_us ? (double)ref_us / lut_us : 0.0, same ? "same pixels" : "DIFFERENT PIXELS");
+	}
+}
+
+/* The line reader of the built-in decoder without LV_IMG_DECODER_INDEXED_LUT, for a variable image */
+static void indexed_line_ref(const lv_img_dsc_t* img, const lv_color_t* palette, const lv_opa_t* opa,
+	lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf)
+{
+	uint8_t px_size = lv_img_cf_get_px_size(img->header.cf);
+	uint16_t mask = (1 << px_size) - 1;
+	uint8_t px_per_byte = 8 / px_size;
+	lv_coord_t w = (img->header.w + px_per_byte - 1) / px_per_byte;
+	uint32_t ofs = (1 << px_size) * sizeof(lv_color32_t) + w * y + x / px_per_byte;
+	int8_t pos = 8 - px_size - (x % px_per_byte) * px_size;
+
+	/* It got a buffer for the file reads in every call */
+	uint8_t* fs_buf = _lv_mem_buf_get(w);
+	const uint8_t* data_tmp = img->data + ofs;
+	lv_coord_t i;
+	for (i = 0; i < len; i++)
+	{
+		uint8_t val_act = (*data_tmp & (mask << pos)) >> pos;
+		lv_color_t color = palette[val_act];
+		buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE] = color.full & 0xFF;
+		buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 1] = (color.full >> 8) & 0xFF;
+		buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = opa[val_act];
+
+		pos -= px_size;
+		if (pos < 0)
+		{
+			pos = 8 - px_size;
+			data_tmp++;
+		}
+	}
+	_lv_mem_buf_release(fs_buf);
+}
+
+/*-----------------------------------
+ * Image transformation
+ *----------------------------------*/
+
+static void rotate_anim_cb(void* img, lv_anim_value_t angle)
+{
+	lv_img_set_angle(img, angle);
+}
+
+/* Turn an image around its center, the 240x240 logo of the firmware by default */
+static void rotate_init(const char* path)
+{
+	LV_IMG_DECLARE(logo);
+	static char src[LV_FS_MAX_PATH_LENGTH];
+
+	lv_obj_t* scr = lv_scr_act();
+	lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+	lv_obj_t* img = lv_img_create(scr, NULL);
+	if (path)
+	{
+		snprintf(src, sizeof(src), "S:%s", path);
+		lv_img_set_src(img, src);
+	}
+	else
+	{
+		lv_img_set_src(img, &logo);
+	}
+	lv_obj_align(img, NULL, LV_ALIGN_CENTER, 0, 0);
+
+	lv_anim_t a;
+	lv_anim_init(&a);
+	lv_anim_set_var(&a, img);
+	lv_anim_set_exec_cb(&a, rotate_anim_cb);
+	lv_anim_set_values(&a, 0, 3599);
+	lv_anim_set_time(&a, ROTATE_PERIOD);
+	lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+	lv_anim_start(&a);
+}
+
+/* Rotate and zoom the logo of the firmware with `_lv_img_buf_transform` pixel by pixel
+ * and with `_lv_img_buf_transform_line`, and compare the time and the pixels */
+static void transform_bench(void)
+{
+	LV_IMG_DECLARE(logo);
+	static const int16_t angles[] = { 0, 150, 450, 900, 1234 };
+	static const uint16_t zooms[] = { LV_IMG_ZOOM_NONE, 192, 384 };
+	lv_coord_t w = logo.header.w;
+	lv_coord_t h = logo.header.h;
+
+	/* Images are transformed as true color when the decoder opens them as a whole */
+	uint8_t* map = malloc(w * h * sizeof(lv_color_t));
+	uint8_t line[LV_HOR_RES_MAX * LV_IMG_PX_SIZE_ALPHA_BYTE];
+	lv_img_decoder_dsc_t dec;
+	if (lv_img_decoder_open(&dec, &logo, LV_COLOR_BLACK) != LV_RES_OK)
+	{
+		fprintf(stderr, "Can't open the logo\n");
+		exit(1);
+	}
+	lv_coord_t x;
+	lv_coord_t y;
+	for (y = 0; y < h; y++)
+	{
+		lv_img_decoder_read_line(&dec, 0, y, w, line);
+		for (x = 0; x < w; x++) memcpy(&map[(y * w + x) * sizeof(lv_color_t)], &line[x * LV_IMG_PX_SIZE_ALPHA_BYTE], sizeof(lv_color_t));
+	}
+	lv_img_decoder_close(&dec);
+
+	/* The transformed area of the zoomed logo */
+	uint32_t buf_size = (3 * LV_HOR_RES_MAX) * (3 * LV_VER_RES_MAX);
+	lv_color_t* cbuf = malloc(buf_size * sizeof(lv_color_t));
+	lv_opa_t* abuf = malloc(buf_size);
+	lv_color_t* cbuf_ref = malloc(buf_size * sizeof(lv_color_t));
+	lv_opa_t* abuf_ref = malloc(buf_size);
+
+	uint32_t aa;
+	for (aa = 0; aa < 2; aa++)
+	{
+		uint32_t a;
+		uint32_t z;
+		for (z = 0; z < sizeof(zooms) / sizeof(zooms[0]); z++)
+		{
+			for (a = 0; a < sizeof(angles) / sizeof(angles[0]); a++)
+			{
+				if (angles[a] == 0 && zooms[z] == LV_IMG_ZOOM_NONE) continue;
+
+				lv_img_transform_dsc_t dsc;
+				memset(&dsc, 0, sizeof(dsc));
+				dsc.cfg.src = logo.data;
+				dsc.cfg.src_w = w;
+				dsc.cfg.src_h = h;
+				dsc.cfg.pivot_x = w / 2;
+				dsc.cfg.pivot_y = h / 2;
+				dsc.cfg.angle = angles[a];
+				dsc.cfg.zoom = zooms[z];
+				dsc.cfg.cf = logo.header.cf;
+				dsc.cfg.antialias = aa;
+
+				lv_point_t pivot = { w / 2, h / 2 };
+				lv_area_t area;
+				_lv_img_buf_get_transformed_area(&area, w, h, angles[a], zooms[z], &pivot);
+
+				/* The indexed logo directly, like lv_img draws it */
+				uint64_t indexed_us = 0;
+				uint32_t loop;
+				_lv_img_buf_transform_init(&dsc);
+				for (loop = 0; loop < TRANSFORM_LOOPS; loop++) transform_run(&dsc, &area, true, cbuf, abuf, &indexed_us);
+
+				/* The true color logo */
+				dsc.cfg.src = map;
+				dsc.cfg.cf = LV_IMG_CF_TRUE_COLOR;
+				_lv_img_buf_transform_init(&dsc);
+				uint64_t px_us = 0;
+				uint64_t line_us = 0;
+				for (loop = 0; loop < TRANSFORM_LOOPS; loop++)
+				{
+					transform_run(&dsc, &area, false, cbuf_ref, abuf_ref, &px_us);
+					transform_run(&dsc, &area, true, cbuf, abuf, &line_us);
+				}
+
+				uint32_t px_cnt = lv_area_get_size(&area);
+				uint32_t diff = 0;
+				uint32_t i;
+				for (i = 0; i < px_cnt; i++)
+				{
+					if (abuf[i] != abuf_ref[i] || (abuf[i] && cbuf[i].full != cbuf_ref[i].full)) diff++;
+				}
+
+				uint64_t px = (uint64_t)px_cnt * TRANSFORM_LOOPS;
+				printf("# transform %5.1f deg, zoom %u, %s: pixel %.2f ns/px, line %.2f ns/px, %.2fx, "
+					"indexed line %.2f ns/px, %u of %u px differ\n",
+					angles[a] / 10.0, zooms[z], aa ? (LV_IMG_TRANSFORM_AA_EDGE ? "AA edge" : "AA") : "nearest",
+					px_us * 1000.0 / px, line_us * 1000.0 / px, line_us ? (double)px_us / line_us : 0.0,
+					indexed_us * 1000.0 / px, diff, px_cnt);
+			}
+		}
+	}
+
+	free(abuf_ref);
+	free(cbuf_ref);
+	free(abuf);
+	free(cbuf);
+	free(map);
+}
+
+/* Transform every pixel of `area` (relative to the image) into `cbuf` and `abuf`, line by line or pixel by pixel */
+static void transform_run(lv_img_transform_dsc_t* dsc, const lv_area_t* area, bool line,
+	lv_color_t* cbuf, lv_opa_t* abuf, uint64_t* time)
+{
+	lv_coord_t w = lv_area_get_width(area);
+	lv_coord_t x;
+	lv_coord_t y;
+	uint64_t start = time_us();
+	for (y = area->y1; y <= area->y2; y++)
+	{
+		if (line)
+		{
+			_lv_img_buf_transform_line(dsc, area->x1, y, w, cbuf, abuf);
+			cbuf += w;
+			abuf += w;
+			continue;
+		}
+		for (x = area->x1; x <= area->x2; x++, cbuf++, abuf++)
+		{
+			if (_lv_img_buf_transform(dsc, x, y))
+			{
+				*cbuf = dsc->res.color;
+				*abuf = dsc->res.opa;
+			}
+			else
+			{
+				*abuf = LV_OPA_TRANSP;
+			}
+		}
+	}
+	*time += time_us() - start;
+}
+
+/* Fill, copy and mix areas of a draw buffer through the hooks of lv_port_gpu, the way
+ * lv_draw_blend.c calls them, and inline like LVGL without them. Compare the time and the pixels */
+static void gpu_bench(void)
+{
+	static const lv_coord_t sizes[][2] = { { 240, 10 }, { 240, 4 }, { 120, 10 }, { 60, 10 }, { 240, 2 } };
+	static const lv_opa_t opas[] = { LV_OPA_COVER, LV_OPA_50 };
+	static lv_color_t buf[LV_HOR_RES_MAX * BUF_LINES];
+	static lv_color_t buf_ref[LV_HOR_RES_MAX * BUF_LINES];
+	static lv_color_t map[LV_HOR_RES_MAX * BUF_LINES];
+
+	/* The worker of -g, or one started for this */
+	lv_disp_drv_t* drv = &lv_disp_get_default()->driver;
+	static lv_disp_drv_t gpu_drv;
+	if (drv->gpu_wait_cb == NULL)
+	{
+		lv_disp_drv_init(&gpu_drv);
+		lv_port_gpu_init(&gpu_drv);
+		drv = &gpu_drv;
+	}
+
+	uint32_t i;
+	srand(1);
+	for (i = 0; i < LV_HOR_RES_MAX * BUF_LINES; i++) map[i].full = rand();
+
+	uint32_t s;
+	uint32_t o;
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		lv_coord_t w = sizes[s][0];
+		lv_coord_t h = sizes[s][1];
+		/* Fill, then blend the map with every opacity */
+		for (o = 0; o <= sizeof(opas) / sizeof(opas[0]); o++)
+		{
+			const lv_color_t* src = o ? map : NULL;
+			lv_opa_t opa = o ? opas[o - 1] : LV_OPA_COVER;
+			for (i = 0; i < LV_HOR_RES_MAX * BUF_LINES; i++) buf[i] = buf_ref[i] = LV_COLOR_GRAY;
+
+			uint64_t gpu_us = 0;
+			uint64_t inline_us = 0;
+			uint32_t loop;
+			for (loop = 0; loop < GPU_LOOPS; loop++)
+			{
+				uint64_t start = time_us();
+				gpu_run(drv, buf, src, w, h, opa);
+				gpu_us += time_us() - start;
+
+				start = time_us();
+				gpu_run(NULL, buf_ref, src, w, h, opa);
+				inline_us += time_us() - start;
+			}
+			bool same = memcmp(buf, buf_ref, sizeof(buf)) == 0;
+
+			uint64_t px = (uint64_t)w * h * GPU_LOOPS;
+			printf("# gpu %s %3dx%-2d: lv_port_gpu %.2f ns/px, inline %.2f ns/px, %.2fx, %s\n",
+				o == 0 ? "fill" : opa > LV_OPA_MAX ? "copy" : "mix ", w, h,
+				gpu_us * 1000.0 / px, inline_us * 1000.0 / px, gpu_us ? (double)inline_us / gpu_us : 0.0,
+				same ? "same pixels" : "DIFFERENT PIXELS");
+		}
+	}
+}
+
+/* One area of the draw buffer with the hooks of `drv`, or inline if it's NULL. `map` NULL: fill */
+static void gpu_run(lv_disp_drv_t* drv, lv_color_t* buf, const lv_color_t* map, lv_coord_t w, lv_coord_t h,
+	lv_opa_t opa)
+{
+	lv_area_t area = { 0, 0, w - 1, h - 1 };
+	lv_coord_t x;
+	lv_coord_t y;
+	lv_color_t* dest = buf;
+
+	if (map == NULL)
+	{
+		if (drv) drv->gpu_fill_cb(drv, buf, LV_HOR_RES_MAX, &area, LV_COLOR_ORANGE);
+		else for (y = 0; y < h; y++, dest += LV_HOR_RES_MAX) lv_color_fill(dest, LV_COLOR_ORANGE, w);
+	}
+	else
+	{
+		for (y = 0; y < h; y++, dest += LV_HOR_RES_MAX, map += LV_HOR_RES_MAX)
+		{
+			if (drv) drv->gpu_blend_cb(drv, dest, map, w, opa);
+			else if (opa > LV_OPA_MAX) memcpy(dest, map, w * sizeof(lv_color_t));
+			else for (x = 0; x < w; x++) dest[x] = lv_color_mix(map[x], dest[x], opa);
+		}
+	}
+	if (drv) drv->gpu_wait_cb(drv);
+}
+
+/*-----------------------------------
+ * Scripted encoder
+ *----------------------------------*/
+
+/* The firmware doesn't create groups yet, so add the children of the screen to a group */
+static void encoder_group_init(void)
+{
+	lv_group_t* group = lv_group_create();
+	lv_obj_t* child;
+	_LV_LL_READ_BACK(lv_scr_act()->child_ll, child)
+	{
+		lv_group_add_obj(group, child);
+	}
+	lv_indev_set_group(indev_encoder, group);
+}
+
+static void encoder_step(char cmd)
+{
+	encoder_state = LV_INDEV_STATE_REL;
+	switch (cmd)
+	{
+	case 'r': encoder_diff++; break;
+	case 'l': encoder_diff--; break;
+	case 'p': encoder_state = LV_INDEV_STATE_PR; break;
+	default: break;
+	}
+}
+
+/*-----------------------------------
+ * Output
+ *----------------------------------*/
+
+static void snapshot_save(const char* scenario, uint32_t time)
+{
+	panel_sync();
+
+	char path[512];
+	snprintf(path, sizeof(path), "%s/%s_%06u.ppm", out_dir, scenario, time);
+
+	FILE* fp = fopen(path, "wb");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "Can't write %s\n", path);
+		return;
+	}
+
+	fprintf(fp, "P6\n%d %d\n255\n", LV_HOR_RES_MAX, LV_VER_RES_MAX);
+	/* Decode the bytes like the panel does */
+	uint32_t i;
+	for (i = 0; i < LV_HOR_RES_MAX * LV_VER_RES_MAX; i++)
+	{
+		uint16_t c = (panel_buf[2 * i] << 8) | panel_buf[2 * i + 1];
+		fputc((c >> 11) << 3, fp);
+		fputc(((c >> 5) & 0x3F) << 2, fp);
+		fputc((c & 0x1F) << 3, fp);
+	}
+	fclose(fp);
+}
+
+static uint64_t time_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int cmp_u32(const void* a, const void* b)
+{
+	uint32_t va = *(const uint32_t*)a;
+	uint32_t vb = *(const uint32_t*)b;
+	return va < vb ? -1 : va > vb;
+}
@@ -0,0 +1,113 @@
+/**
+* @file holo_test.c
+* Unit tests of the firmware's modules with the firmware's LVGL and lv_conf.h, like LVGL's
+* tests/lv_test_main.c. Built and run by "make test", stops at the first failing assert.
+*/
+
+/*********************
+*      INCLUDES
+*********************/
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "ff.h"
+#include "lv_port_fatfs.h"
+#include "lv_test_assert.h"
+#include "lv_test_holo_anim.h"
+#include "lv_test_holo_img.h"
+#include "lv_test_holo_jpeg.h"
+#include "lv_test_holo_meta.h"
+#include "lv_test_port_fs_cache.h"
+#include "lv_test_sd_config.h"
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void hal_init(void);
+static void dummy_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+static void sd_remove(const char* dir);
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+int main(void)
+{
+	printf("Call lv_init...\n");
+	lv_init();
+
+	hal_init();
+
+	/* The "S:" drive of the firmware in a directory of its own */
+	char sd_dir[] = "/tmp/holo_test_XXXXXX";
+	if (mkdtemp(sd_dir) == NULL) lv_test_exit("Can't create %s", sd_dir);
+	ff_stub_set_root(sd_dir);
+	lv_fs_if_init();
+
+	lv_test_holo_anim();
+	lv_test_holo_img();
+	lv_test_holo_jpeg();
+	lv_test_port_fs_cache();
+	lv_test_sd_config();
+	lv_test_holo_meta();
+
+	sd_remove(sd_dir);
+	printf("Exit with success!\n");
+	return 0;
+}
+
+uint32_t millis(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+uint32_t micros(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+static void hal_init(void)
+{
+	static lv_disp_buf_t disp_buf;
+	static lv_color_t buf[LV_HOR_RES_MAX * 10];
+	lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * 10);
+
+	lv_disp_drv_t disp_drv;
+	lv_disp_drv_init(&disp_drv);
+	disp_drv.hor_res = LV_HOR_RES_MAX;
+	disp_drv.ver_res = LV_VER_RES_MAX;
+	disp_drv.flush_cb = dummy_flush_cb;
+	disp_drv.buffer = &disp_buf;
+	lv_disp_drv_register(&disp_drv);
+}
+
+static void dummy_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p)
+{
+	lv_disp_flush_ready(disp_drv);
+}
+
+/* The files the tests left on the "S:" drive, then its directory */
+static void sd_remove(const char* dir)
+{
+	DIR* d = opendir(dir);
+	struct dirent* ent;
+	while (d && (ent = readdir(d)) != NULL)
+	{
+		char path[512];
+		snprintf(path, sizeof(path), "%s/%s", dir, ent->d_name);
+		if (ent->d_name[0] != '.') unlink(path);
+	}
+	if (d) closedir(d);
+	rmdir(dir);
+}
@@ -0,0 +1,487 @@
+/**
+ * @file img_test_jpeg.c
+ * JPEG files of lv_test_holo_jpeg.c, written with libjpeg (quality 80, optimized Huffman tables)
+ * from the pixels r = 20 + 7x + 3y, g = 220 - 6y + 40 on every other 4x4 square, b = 60 + 2 * ((x * x + 3y) & 63).
+ * The "_rgb" arrays are the pixels libjpeg decodes from them with its "islow" IDCT and without
+ * fancy upsampling (like lv_holo_jpeg), RGB888 row by row.
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <stdint.h>
+
+/**********************
+*   GLOBAL VARIABLES
+**********************/
+
+/* 20x12, 4:4:4, a restart marker in every 3 MCUs (across the MCU rows) */
+const uint8_t lv_test_jpeg_444[] = {
+	0xFF, 0xD8, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x06, 0x05,
+	0x06, 0x07, 0x07, 0x06, 0x08, 0x0A, 0x10, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x14, 0x0E, 0x0F, 0x0C,
+	0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1A, 0x1D, 0x25, 0x1F, 0x1A, 0x1B, 0x23,
+	0x1C, 0x16, 0x16, 0x20, 0x2C, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2A, 0x29, 0x19, 0x1F, 0x2D, 0x30,
+	0x2D, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0A,
+	0x08, 0x0A, 0x13, 0x0A, 0x0A, 0x13, 0x28, 0x1A, 0x16, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0, 0x00, 0x11,
+	0x08, 0x00, 0x0C, 0x00, 0x14, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF,
+	0xC4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x06, 0xFF, 0xC4, 0x00, 0x29, 0x10, 0x00, 0x01, 0x01, 0x04,
+	0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03,
+	0x04, 0x11, 0x05, 0x12, 0x13, 0x21, 0x23, 0x51, 0x61, 0x14, 0x32, 0x33, 0x52, 0x71, 0x91, 0xA2,
+	0xB1, 0xF1, 0xFF, 0xC4, 0x00, 0x19, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x02, 0x03, 0x04, 0x07, 0xFF, 0xC4, 0x00,
+	0x28, 0x11, 0x00, 0x01, 0x04, 0x01, 0x02, 0x03, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x04, 0x11, 0x21, 0x31, 0x22, 0x91, 0xB1, 0x12, 0x13, 0x14,
+	0x51, 0x52, 0x61, 0x92, 0xC1, 0xD1, 0xF0, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x03, 0xFF, 0xDA, 0x00,
+	0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xD3, 0xC0, 0x44, 0x0A, 0x3A,
+	0xF3, 0x88, 0x1B, 0xBF, 0x29, 0x4B, 0xEA, 0x01, 0x56, 0xB8, 0x39, 0x90, 0x8D, 0x1B, 0xAA, 0xE5,
+	0x90, 0x55, 0xF1, 0x1A, 0x6D, 0x84, 0xC4, 0x24, 0x46, 0xC0, 0xCB, 0x20, 0xE2, 0x57, 0x00, 0xE5,
+	0x2B, 0xD5, 0x6D, 0xAE, 0x66, 0x63, 0x63, 0xC6, 0x00, 0x00, 0xF3, 0x70, 0xFC, 0x47, 0xAB, 0xD5,
+	0xEF, 0xF5, 0xDB, 0x09, 0x68, 0x68, 0x5C, 0x2E, 0x37, 0x8E, 0x83, 0x55, 0x2A, 0x71, 0x70, 0x6D,
+	0xE5, 0xD0, 0x23, 0x20, 0x69, 0xB2, 0xFF, 0xD0, 0x4E, 0x82, 0x78, 0xD0, 0x76, 0xFA, 0x47, 0x94,
+	0x7B, 0x59, 0xAE, 0x34, 0x32, 0x07, 0x16, 0xFF, 0x00, 0x64, 0x80, 0x52, 0x48, 0x8D, 0xA4, 0xB5,
+	0x29, 0x41, 0x3D, 0x68, 0x5A, 0x99, 0xEE, 0xD5, 0x97, 0x62, 0x87, 0xDE, 0x71, 0x61, 0xED, 0x7A,
+	0x71, 0x8F, 0x89, 0x3D, 0x53, 0x08, 0x89, 0xBC, 0x2A, 0x5A, 0x34, 0x40, 0x27, 0xA2, 0x1D, 0x6C,
+	0x09, 0x1E, 0x1C, 0x47, 0xB7, 0x22, 0x47, 0xD2, 0x67, 0x8A, 0x36, 0x86, 0xAF, 0xFF, 0xD9,
+};
+const uint32_t lv_test_jpeg_444_size = sizeof(lv_test_jpeg_444);
+const uint8_t lv_test_jpeg_444_rgb[] = {
+	0x0C, 0xDD, 0x3A, 0x19, 0xDA, 0x33, 0x27, 0xD9, 0x43, 0x25, 0xD8, 0x56, 0x3D, 0xFF, 0x6C, 0x30,
+	0xFF, 0x4F, 0x3B, 0xFF, 0x6D, 0x4A, 0xFE, 0xA5, 0x48, 0xE2, 0x32, 0x51, 0xDD, 0x46, 0x61, 0xDB,
+	0x88, 0x60, 0xDA, 0xB3, 0x65, 0xFF, 0x61, 0x6D, 0xFF, 0x9D, 0x70, 0xFF, 0x38, 0x86, 0xFD, 0x7D,
+	0x85, 0xDD, 0x3D, 0x90, 0xDB, 0x7C, 0x89, 0xDB, 0x4B, 0x9D, 0xE1, 0x8A, 0x1A, 0xD7, 0x47, 0x20,
+	0xD5, 0x3B, 0x28, 0xD3, 0x46, 0x27, 0xD5, 0x59, 0x3D, 0xFE, 0x71, 0x32, 0xFF, 0x60, 0x38, 0xFF,
+	0x7D, 0x42, 0xFB, 0xAD, 0x52, 0xDA, 0x48, 0x58, 0xD4, 0x58, 0x64, 0xD3, 0x8F, 0x61, 0xD6, 0xA9,
+	0x68, 0xFD, 0x63, 0x6F, 0xFF, 0x9E, 0x6D, 0xFF, 0x3D, 0x7D, 0xFB, 0x7D, 0x85, 0xD5, 0x40, 0x91,
+	0xD5, 0x82, 0x8C, 0xD3, 0x51, 0x9F, 0xD9, 0x8D, 0x1E, 0xCC, 0x50, 0x20, 0xCA, 0x43, 0x26, 0xCC,
+	0x46, 0x29, 0xD3, 0x59, 0x3D, 0xF6, 0x77, 0x3C, 0xFD, 0x7C, 0x41, 0xFE, 0x97, 0x48, 0xFB, 0xBA,
+	0x52, 0xCC, 0x55, 0x59, 0xC9, 0x67, 0x61, 0xCA, 0x91, 0x61, 0xD4, 0x93, 0x6D, 0xF7, 0x63, 0x77,
+	0xFD, 0xA6, 0x73, 0xFF, 0x4B, 0x80, 0xFC, 0x8A, 0x89, 0xD1, 0x47, 0x95, 0xD1, 0x89, 0x90, 0xD0,
+	0x58, 0xA3, 0xD7, 0x97, 0x20, 0xCF, 0x56, 0x21, 0xD0, 0x4D, 0x27, 0xD3, 0x4D, 0x2E, 0xD7, 0x5A,
+	0x3D, 0xE5, 0x76, 0x44, 0xEA, 0x88, 0x4B, 0xEC, 0x9E, 0x50, 0xEC, 0xAF, 0x51, 0xCF, 0x54, 0x58,
+	0xCE, 0x6E, 0x63, 0xD2, 0x90, 0x64, 0xD6, 0x74, 0x71, 0xEA, 0x5F, 0x7E, 0xE9, 0xA5, 0x7B, 0xEF,
+	0x56, 0x85, 0xEB, 0x97, 0x83, 0xCD, 0x44, 0x8F, 0xCC, 0x86, 0x8A, 0xCB, 0x55, 0x9D, 0xD1, 0x93,
+	0x25, 0xE3, 0x5F, 0x29, 0xE5, 0x5B, 0x2E, 0xE5, 0x59, 0x37, 0xE0, 0x5F, 0x3A, 0xD0, 0x6D, 0x45,
+	0xCA, 0x88, 0x4E, 0xCA, 0x8E, 0x51, 0xCD, 0x87, 0x55, 0xE3, 0x4F, 0x60, 0xE5, 0x78, 0x6C, 0xE5,
+	0x96, 0x6B, 0xDF, 0x5A, 0x73, 0xD7, 0x5D, 0x80, 0xC8, 0xA0, 0x7D, 0xCC, 0x59, 0x87, 0xCB, 0x9A,
+	0x98, 0xE9, 0x5C, 0xA5, 0xE9, 0x9C, 0xA0, 0xE8, 0x6B, 0xB2, 0xEF, 0xAA, 0x26, 0xE6, 0x5B, 0x28,
+	0xEB, 0x61, 0x30, 0xEC, 0x62, 0x3C, 0xE5, 0x68, 0x3A, 0xBE, 0x72, 0x4D, 0xB5, 0x90, 0x55, 0xB7,
+	0x86, 0x56, 0xBC, 0x66, 0x55, 0xEA, 0x48, 0x61, 0xED, 0x80, 0x6F, 0xEC, 0xA0, 0x6D, 0xDF, 0x49,
+	0x77, 0xC7, 0x66, 0x85, 0xB3, 0xA6, 0x83, 0xB7, 0x64, 0x8D, 0xB9, 0xA0, 0x92, 0xE5, 0x59, 0x9D,
+	0xE4, 0x98, 0x98, 0xE2, 0x67, 0xAB, 0xE9, 0xA6, 0x27, 0xDB, 0x54, 0x28, 0xE1, 0x62, 0x2D, 0xE4,
+	0x66, 0x3F, 0xE1, 0x74, 0x3B, 0xB6, 0x80, 0x54, 0xAF, 0xA6, 0x5B, 0xB3, 0x8B, 0x56, 0xBB, 0x53,
+	0x57, 0xDF, 0x4D, 0x62, 0xE2, 0x8D, 0x70, 0xE2, 0xAE, 0x6E, 0xDA, 0x48, 0x7C, 0xBE, 0x77, 0x8D,
+	0xAE, 0xB5, 0x87, 0xB4, 0x6F, 0x8E, 0xBA, 0xA3, 0x96, 0xE1, 0x60, 0xA3, 0xE1, 0xA2, 0x9D, 0xDF,
+	0x71, 0xAF, 0xE6, 0xAD, 0x33, 0xD7, 0x5A, 0x2E, 0xDB, 0x68, 0x2F, 0xDD, 0x6E, 0x42, 0xDD, 0x7F,
+	0x3A, 0xB0, 0x8D, 0x55, 0xAE, 0xB6, 0x56, 0xB1, 0x8E, 0x4B, 0xB8, 0x45, 0x63, 0xD9, 0x5F, 0x69,
+	0xDB, 0xA0, 0x72, 0xDB, 0xBD, 0x6F, 0xD4, 0x4A, 0x7F, 0xB9, 0x87, 0x8D, 0xAC, 0xBE, 0x83, 0xB5,
+	0x70, 0x83, 0xB8, 0x9A, 0x98, 0xD9, 0x65, 0xA4, 0xD9, 0xA5, 0x9E, 0xD8, 0x74, 0xB1, 0xDE, 0xB3,
+	0x2A, 0xA8, 0x78, 0x3A, 0xB3, 0x56, 0x42, 0xB0, 0x69, 0x3B, 0xA5, 0xA5, 0x50, 0xD9, 0x7F, 0x50,
+	0xD6, 0xA1, 0x56, 0xCF, 0xA4, 0x5F, 0xD5, 0x5B, 0x5B, 0xAC, 0x6A, 0x74, 0xAE, 0x95, 0x79, 0xA2,
+	0xB6, 0x76, 0xB1, 0x6D, 0x86, 0xD0, 0x81, 0x79, 0xD2, 0x54, 0x90, 0xD8, 0x75, 0xA0, 0xCC, 0xBD,
+	0x9C, 0xAE, 0x74, 0xA6, 0xA5, 0xAB, 0xAC, 0xAD, 0x71, 0xAE, 0xAE, 0x3C, 0x2C, 0xA4, 0x77, 0x3C,
+	0xAB, 0x66, 0x42, 0xAA, 0x6D, 0x3A, 0xA2, 0x9B, 0x53, 0xD3, 0x89, 0x50, 0xD0, 0xA0, 0x57, 0xCD,
+	0x90, 0x60, 0xCE, 0x5B, 0x5E, 0xA8, 0x6D, 0x73, 0xA8, 0x98, 0x78, 0xA0, 0x97, 0x77, 0xAC, 0x66,
+	0x88, 0xCB, 0x88, 0x7D, 0xCF, 0x51, 0x91, 0xD1, 0x7D, 0x9F, 0xC9, 0xA3, 0x9F, 0xA8, 0x79, 0xA6,
+	0xA2, 0xA3, 0xAD, 0xA6, 0x78, 0xB0, 0xA8, 0x43, 0x2F, 0x9F, 0x79, 0x3D, 0xA1, 0x7B, 0x45, 0xA2,
+	0x73, 0x3E, 0x9F, 0x8E, 0x54, 0xC9, 0x95, 0x51, 0xC7, 0xA4, 0x59, 0xCA, 0x70, 0x63, 0xC6, 0x5C,
+	0x63, 0xA1, 0x72, 0x76, 0x9E, 0x9E, 0x78, 0x9E, 0x6B, 0x77, 0xA5, 0x5C, 0x8C, 0xC3, 0x99, 0x84,
+	0xCC, 0x4F, 0x94, 0xC8, 0x88, 0x9D, 0xC5, 0x7C, 0xA2, 0x9F, 0x7C, 0xA9, 0x9D, 0x91, 0xB1, 0x9E,
+	0x80, 0xB3, 0xA1, 0x4B, 0x33, 0x9C, 0x7D, 0x3F, 0x99, 0x8D, 0x48, 0x9B, 0x7D, 0x42, 0x9C, 0x83,
+	0x59, 0xC2, 0xA3, 0x54, 0xC0, 0xA8, 0x5B, 0xC8, 0x51, 0x66, 0xC0, 0x5E, 0x6A, 0x9E, 0x78, 0x7A,
+	0x97, 0xA7, 0x7A, 0x9C, 0x46, 0x7A, 0xA0, 0x55, 0x91, 0xBD, 0xA6, 0x89, 0xC9, 0x4E, 0x96, 0xC0,
+	0x90, 0x9D, 0xC3, 0x56, 0xA4, 0x99, 0x7B, 0xAA, 0x9B, 0x70, 0xB2, 0x96, 0x81, 0xB8, 0x9D, 0x4C,
+};
+
+/* 24x16, 4:2:2 */
+const uint8_t lv_test_jpeg_422[] = {
+	0xFF, 0xD8, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x06, 0x05,
+	0x06, 0x07, 0x07, 0x06, 0x08, 0x0A, 0x10, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x14, 0x0E, 0x0F, 0x0C,
+	0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1A, 0x1D, 0x25, 0x1F, 0x1A, 0x1B, 0x23,
+	0x1C, 0x16, 0x16, 0x20, 0x2C, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2A, 0x29, 0x19, 0x1F, 0x2D, 0x30,
+	0x2D, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0A,
+	0x08, 0x0A, 0x13, 0x0A, 0x0A, 0x13, 0x28, 0x1A, 0x16, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0, 0x00, 0x11,
+	0x08, 0x00, 0x10, 0x00, 0x18, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF,
+	0xC4, 0x00, 0x17, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x07, 0xFF, 0xC4, 0x00, 0x26, 0x10, 0x00, 0x01, 0x02,
+	0x05, 0x02, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x11,
+	0x00, 0x02, 0x13, 0x21, 0x51, 0x03, 0x05, 0x12, 0x14, 0x15, 0x23, 0x31, 0xF1, 0x41, 0xC1, 0xE1,
+	0xFF, 0xC4, 0x00, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x04, 0x07, 0xFF, 0xC4, 0x00, 0x26, 0x11, 0x00, 0x01,
+	0x02, 0x03, 0x07, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x04, 0x02, 0x03, 0x11, 0x05, 0x12, 0x13, 0x21, 0x31, 0x62, 0xC1, 0x32, 0x41, 0x61, 0xA1, 0xD1,
+	0xB1, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xD3,
+	0xA0, 0x50, 0x36, 0xEB, 0x9E, 0xE0, 0x9E, 0xF8, 0x66, 0xF7, 0x0C, 0x24, 0x51, 0xC8, 0x4B, 0x28,
+	0x3D, 0xCE, 0x30, 0x0E, 0x1A, 0xF0, 0x7C, 0x37, 0xAC, 0x02, 0x10, 0x3A, 0x81, 0xE3, 0xE2, 0xE7,
+	0x76, 0x73, 0x5B, 0xE4, 0x6E, 0xE1, 0x2E, 0x91, 0x47, 0x4F, 0x12, 0xF8, 0xD4, 0xA9, 0x6C, 0x33,
+	0x01, 0x14, 0x4D, 0x98, 0xC8, 0xCD, 0xCF, 0x44, 0xDD, 0xB3, 0x2C, 0x48, 0x2F, 0xE9, 0x55, 0xCD,
+	0xF4, 0x14, 0xF4, 0xED, 0x3F, 0x35, 0x2A, 0xDB, 0x0C, 0xDE, 0xE1, 0x64, 0xEA, 0x4E, 0xDF, 0x77,
+	0xA9, 0xC4, 0xCD, 0xF0, 0xCC, 0x3F, 0x61, 0x33, 0x99, 0x44, 0x9A, 0x43, 0xE3, 0xD5, 0x4F, 0xC5,
+	0x2E, 0xCC, 0x6B, 0x7E, 0x9B, 0xB8, 0x4B, 0xA4, 0x52, 0x50, 0x10, 0x5E, 0xA1, 0x9C, 0x81, 0x86,
+	0x67, 0x1F, 0x71, 0x46, 0x66, 0xEC, 0xCC, 0xF0, 0x63, 0x3D, 0xF3, 0xFD, 0x4D, 0xA4, 0x31, 0xC5,
+	0x80, 0x47, 0xA2, 0xFF, 0xD9,
+};
+const uint32_t lv_test_jpeg_422_size = sizeof(lv_test_jpeg_422);
+const uint8_t lv_test_jpeg_422_rgb[] = {
+	0x19, 0xD7, 0x37, 0x1A, 0xD8, 0x38, 0x28, 0xD7, 0x4C, 0x29, 0xD8, 0x4D, 0x35, 0xFF, 0x56, 0x2F,
+	0xFF, 0x50, 0x38, 0xFD, 0x94, 0x40, 0xFF, 0x9C, 0x50, 0xDB, 0x42, 0x52, 0xDD, 0x44, 0x63, 0xD6,
+	0x9D, 0x67, 0xDA, 0xA1, 0x62, 0xFC, 0x7A, 0x6B, 0xFF, 0x83, 0x70, 0xFE, 0x52, 0x7B, 0xFF, 0x5D,
+	0x81, 0xCF, 0x58, 0x96, 0xE4, 0x6D, 0x7F, 0xDA, 0x59, 0x8F, 0xEA, 0x69, 0x97, 0xFC, 0x6E, 0xA3,
+	0xFF, 0x7A, 0xA8, 0xFF, 0x71, 0xAB, 0xFF, 0x74, 0x1B, 0xD7, 0x42, 0x1A, 0xD6, 0x41, 0x25, 0xD2,
+	0x54, 0x28, 0xD5, 0x57, 0x39, 0xFF, 0x62, 0x37, 0xFF, 0x60, 0x3D, 0xF9, 0x9B, 0x42, 0xFE, 0xA0,
+	0x51, 0xDB, 0x4A, 0x51, 0xDB, 0x4A, 0x60, 0xD3, 0x9C, 0x64, 0xD7, 0xA0, 0x68, 0xF7, 0x83, 0x72,
+	0xFF, 0x8D, 0x74, 0xFA, 0x5D, 0x7B, 0xFF, 0x64, 0x8F, 0xCD, 0x68, 0x9F, 0xDD, 0x78, 0x89, 0xD3,
+	0x62, 0x9A, 0xE4, 0x73, 0xA2, 0xF7, 0x78, 0xAF, 0xFF, 0x85, 0xAF, 0xFF, 0x75, 0xB0, 0xFF, 0x76,
+	0x17, 0xD1, 0x48, 0x15, 0xCF, 0x46, 0x20, 0xCB, 0x59, 0x27, 0xD2, 0x60, 0x3D, 0xF7, 0x72, 0x42,
+	0xFC, 0x77, 0x4D, 0xF5, 0xA7, 0x51, 0xF9, 0xAB, 0x49, 0xD3, 0x4C, 0x4B, 0xD5, 0x4E, 0x5B, 0xCD,
+	0x92, 0x61, 0xD3, 0x98, 0x6E, 0xEF, 0x8B, 0x7C, 0xFD, 0x99, 0x81, 0xF5, 0x6E, 0x88, 0xFC, 0x75,
+	0x8F, 0xC4, 0x6A, 0x9D, 0xD2, 0x78, 0x8C, 0xC8, 0x66, 0xA1, 0xDD, 0x7B, 0xAB, 0xEE, 0x7D, 0xB9,
+	0xFC, 0x8B, 0xBE, 0xFC, 0x81, 0xBD, 0xFB, 0x80, 0x1A, 0xD4, 0x4D, 0x1A, 0xD4, 0x4D, 0x25, 0xCF,
+	0x62, 0x2B, 0xD5, 0x68, 0x40, 0xE3, 0x7A, 0x47, 0xEA, 0x81, 0x52, 0xE8, 0x9E, 0x55, 0xEB, 0xA1,
+	0x48, 0xD4, 0x4F, 0x4D, 0xD9, 0x54, 0x60, 0xD4, 0x8D, 0x60, 0xD4, 0x8D, 0x74, 0xE0, 0x8A, 0x7F,
+	0xEB, 0x95, 0x84, 0xE5, 0x71, 0x8C, 0xED, 0x79, 0x8C, 0xCA, 0x69, 0x98, 0xD6, 0x75, 0x92, 0xCC,
+	0x68, 0xA5, 0xDF, 0x7B, 0xAB, 0xE0, 0x78, 0xB4, 0xE9, 0x81, 0xBE, 0xE9, 0x7D, 0xBF, 0xEA, 0x7E,
+	0x29, 0xE2, 0x58, 0x2B, 0xE4, 0x5A, 0x33, 0xDE, 0x6E, 0x34, 0xDF, 0x6F, 0x3E, 0xCC, 0x78, 0x41,
+	0xCF, 0x7B, 0x4D, 0xCD, 0x83, 0x4F, 0xCF, 0x85, 0x55, 0xE1, 0x5C, 0x5E, 0xEA, 0x65, 0x6F, 0xE6,
+	0x8C, 0x64, 0xDB, 0x81, 0x77, 0xCD, 0x84, 0x7A, 0xD0, 0x87, 0x7D, 0xC9, 0x67, 0x87, 0xD3, 0x71,
+	0x8E, 0xE1, 0x6F, 0x99, 0xEC, 0x7A, 0x9C, 0xDE, 0x72, 0xA7, 0xE9, 0x7D, 0xA6, 0xD0, 0x6E, 0xA5,
+	0xCF, 0x6D, 0xB6, 0xCD, 0x72, 0xB8, 0xCF, 0x74, 0x2B, 0xE5, 0x56, 0x2F, 0xE9, 0x5A, 0x39, 0xE4,
+	0x74, 0x39, 0xE4, 0x74, 0x41, 0xB9, 0x7C, 0x45, 0xBD, 0x80, 0x4F, 0xBC, 0x78, 0x4F, 0xBC, 0x78,
+	0x57, 0xE4, 0x62, 0x63, 0xF0, 0x6E, 0x76, 0xED, 0x89, 0x64, 0xDB, 0x77, 0x7D, 0xBE, 0x86, 0x7D,
+	0xBE, 0x86, 0x81, 0xB6, 0x6E, 0x8C, 0xC1, 0x79, 0x8E, 0xE9, 0x72, 0x98, 0xF3, 0x7C, 0xA4, 0xE6,
+	0x7C, 0xAD, 0xEF, 0x85, 0xA8, 0xC4, 0x6D, 0xA3, 0xBF, 0x68, 0xBB, 0xBF, 0x75, 0xBF, 0xC3, 0x79,
+	0x26, 0xDC, 0x53, 0x2B, 0xE1, 0x58, 0x34, 0xDE, 0x74, 0x39, 0xE3, 0x79, 0x46, 0xAE, 0x89, 0x4E,
+	0xB6, 0x91, 0x5B, 0xB6, 0x7D, 0x58, 0xB3, 0x7A, 0x50, 0xDE, 0x66, 0x5C, 0xEA, 0x72, 0x72, 0xE8,
+	0x87, 0x61, 0xD7, 0x76, 0x83, 0xB4, 0x94, 0x86, 0xB7, 0x97, 0x8A, 0xAF, 0x84, 0x95, 0xBA, 0x8F,
+	0x8F, 0xDF, 0x7C, 0x95, 0xE5, 0x82, 0xA9, 0xD9, 0x85, 0xB6, 0xE6, 0x92, 0xB1, 0xBA, 0x79, 0xAE,
+	0xB7, 0x76, 0xC9, 0xB9, 0x85, 0xCB, 0xBB, 0x87, 0x28, 0xDD, 0x5A, 0x2A, 0xDF, 0x5C, 0x31, 0xDA,
+	0x77, 0x39, 0xE2, 0x7F, 0x4A, 0xA7, 0x94, 0x55, 0xB2, 0x9F, 0x5E, 0xB0, 0x82, 0x56, 0xA8, 0x7A,
+	0x52, 0xDE, 0x71, 0x5C, 0xE8, 0x7B, 0x70, 0xE6, 0x88, 0x5E, 0xD4, 0x76, 0x89, 0xAF, 0xA0, 0x8C,
+	0xB2, 0xA3, 0x8F, 0xA8, 0x93, 0x96, 0xAF, 0x9A, 0x98, 0xD8, 0x8A, 0x9B, 0xDB, 0x8D, 0xAF, 0xCD,
+	0x8D, 0xBD, 0xDB, 0x9B, 0xB9, 0xB1, 0x82, 0xB6, 0xAE, 0x7F, 0xCD, 0xB1, 0x8A, 0xCC, 0xB0, 0x89,
+	0x2E, 0xA9, 0x66, 0x34, 0xAF, 0x6C, 0x43, 0xA8, 0x88, 0x3F, 0xA4, 0x84, 0x4F, 0xD4, 0x9B, 0x4F,
+	0xD4, 0x9B, 0x54, 0xD8, 0x73, 0x4F, 0xD3, 0x6E, 0x69, 0x9F, 0x7D, 0x7A, 0xB0, 0x8E, 0x7D, 0xA9,
+	0x90, 0x79, 0xA5, 0x8C, 0x85, 0xDE, 0x5E, 0x79, 0xD2, 0x52, 0x91, 0xCB, 0xA3, 0x9A, 0xD4, 0xAC,
+	0x9A, 0xA4, 0x99, 0xA7, 0xB1, 0xA6, 0xA6, 0xB4, 0x65, 0x9D, 0xAB, 0x5C, 0xCE, 0xD8, 0x82, 0xBB,
+	0xC5, 0x6F, 0xCE, 0xDA, 0x84, 0xCE, 0xDA, 0x84, 0x2F, 0xA9, 0x6E, 0x32, 0xAC, 0x71, 0x3F, 0xA4,
+	0x82, 0x3E, 0xA3, 0x81, 0x52, 0xCD, 0xA1, 0x54, 0xCF, 0xA3, 0x56, 0xD4, 0x69, 0x4F, 0xCD, 0x62,
+	0x6B, 0xA0, 0x86, 0x77, 0xAC, 0x92, 0x76, 0xA5, 0x7B, 0x76, 0xA5, 0x7B, 0x88, 0xD7, 0x62, 0x80,
+	0xCF, 0x5A, 0x92, 0xC8, 0x97, 0x96, 0xCC, 0x9B, 0xA4, 0xA1, 0x90, 0xAD, 0xAA, 0x99, 0xAB, 0xAC,
+	0x60, 0xA5, 0xA6, 0x5A, 0xD2, 0xD0, 0x83, 0xC2, 0xC0, 0x73, 0xD0, 0xD3, 0x82, 0xCE, 0xD1, 0x80,
+	0x2B, 0xA0, 0x73, 0x2C, 0xA1, 0x74, 0x39, 0x9F, 0x78, 0x3D, 0xA3, 0x7C, 0x56, 0xC2, 0xA8, 0x5B,
+	0xC7, 0xAD, 0x62, 0xCF, 0x62, 0x5C, 0xC9, 0x5C, 0x65, 0x9A, 0x8A, 0x6D, 0xA2, 0x92, 0x6C, 0x9F,
+	0x5D, 0x72, 0xA5, 0x63, 0x8D, 0xCD, 0x6C, 0x8B, 0xCB, 0x6A, 0x9D, 0xC6, 0x8E, 0x9D, 0xC6, 0x8E,
+	0xA3, 0x98, 0x7A, 0xA9, 0x9E, 0x80, 0xAE, 0xA2, 0x5A, 0xAD, 0xA1, 0x59, 0xD8, 0xC6, 0x86, 0xCE,
+	0xBC, 0x7C, 0xD8, 0xCB, 0x85, 0xD7, 0xCA, 0x84, 0x2F, 0xA2, 0x81, 0x30, 0xA3, 0x82, 0x3E, 0xA4,
+	0x7F, 0x44, 0xAA, 0x85, 0x59, 0xB1, 0xA5, 0x5D, 0xB5, 0xA9, 0x64, 0xBF, 0x58, 0x62, 0xBD, 0x56,
+	0x68, 0x9D, 0x95, 0x6F, 0xA4, 0x9C, 0x6F, 0xA3, 0x50, 0x77, 0xAB, 0x58, 0x91, 0xBA, 0x74, 0x90,
+	0xB9, 0x73, 0x9F, 0xB8, 0x7E, 0x9D, 0xB6, 0x7C, 0xA3, 0xA0, 0x6D, 0xA6, 0xA3, 0x70, 0xB3, 0xA6,
+	0x60, 0xB2, 0xA5, 0x5F, 0xD4, 0xB8, 0x89, 0xCC, 0xB0, 0x81, 0xD7, 0xB8, 0x81, 0xDA, 0xBB, 0x84,
+	0x3F, 0xAF, 0x96, 0x41, 0xB1, 0x98, 0x4D, 0xB2, 0x90, 0x4F, 0xB4, 0x92, 0x57, 0x9D, 0x95, 0x54,
+	0x9A, 0x92, 0x5F, 0xA0, 0x4E, 0x60, 0xA1, 0x4F, 0x75, 0xAD, 0xA4, 0x7D, 0xB5, 0xAC, 0x7D, 0xB2,
+	0x5A, 0x80, 0xB5, 0x5D, 0x93, 0xA3, 0x7C, 0x8D, 0x9D, 0x76, 0x99, 0x9D, 0x6A, 0x97, 0x9B, 0x68,
+	0xAA, 0xB7, 0x71, 0xA9, 0xB6, 0x70, 0xBD, 0xB8, 0x76, 0xB5, 0xB0, 0x6E, 0xCA, 0xA6, 0x8C, 0xBF,
+	0x9B, 0x81, 0xCA, 0x9A, 0x74, 0xD2, 0xA2, 0x7C, 0x42, 0xB2, 0x99, 0x45, 0xB5, 0x9C, 0x53, 0xB7,
+	0x9D, 0x55, 0xB9, 0x9F, 0x5B, 0x90, 0x80, 0x56, 0x8B, 0x7B, 0x61, 0x8B, 0x59, 0x65, 0x8F, 0x5D,
+	0x78, 0xB1, 0xA0, 0x81, 0xBA, 0xA9, 0x82, 0xB5, 0x68, 0x86, 0xB9, 0x6C, 0x97, 0x91, 0x85, 0x91,
+	0x8B, 0x7F, 0x9B, 0x8D, 0x6A, 0x9A, 0x8C, 0x69, 0xAA, 0xC0, 0x6E, 0xA6, 0xBC, 0x6A, 0xC3, 0xBC,
+	0x85, 0xBA, 0xB3, 0x7C, 0xC5, 0x98, 0x95, 0xBC, 0x8F, 0x8C, 0xCB, 0x88, 0x77, 0xD8, 0x95, 0x84,
+	0x3C, 0xAD, 0x8F, 0x3E, 0xAF, 0x91, 0x4C, 0xAF, 0x9D, 0x55, 0xB8, 0xA6, 0x5E, 0x89, 0x6D, 0x5D,
+	0x88, 0x6C, 0x6C, 0x81, 0x6E, 0x71, 0x86, 0x73, 0x70, 0xAC, 0x90, 0x7A, 0xB6, 0x9A, 0x80, 0xAD,
+	0x74, 0x89, 0xB6, 0x7D, 0x9B, 0x86, 0x8F, 0x9A, 0x85, 0x8E, 0xA7, 0x87, 0x78, 0xA6, 0x86, 0x77,
+	0xAD, 0xB9, 0x67, 0xA4, 0xB0, 0x5E, 0xC6, 0xB0, 0x89, 0xC2, 0xAC, 0x85, 0xCA, 0x8B, 0xA0, 0xC8,
+	0x89, 0x9E, 0xD6, 0x82, 0x82, 0xE5, 0x91, 0x91, 0x3D, 0xAF, 0x8E, 0x3C, 0xAE, 0x8D, 0x49, 0xAB,
+	0x9E, 0x54, 0xB6, 0xA9, 0x61, 0x85, 0x61, 0x62, 0x86, 0x62, 0x6F, 0x79, 0x7A, 0x72, 0x7C, 0x7D,
+	0x71, 0xAF, 0x8A, 0x78, 0xB6, 0x91, 0x7D, 0xA8, 0x7B, 0x89, 0xB4, 0x87, 0x9E, 0x7E, 0x95, 0x9F,
+	0x7F, 0x96, 0xA9, 0x81, 0x7F, 0xA5, 0x7D, 0x7B, 0xBA, 0xB7, 0x68, 0xAC, 0xA9, 0x5A, 0xCA, 0xA7,
+	0x8B, 0xC8, 0xA5, 0x89, 0xCF, 0x82, 0xA6, 0xD1, 0x84, 0xA8, 0xD8, 0x7B, 0x86, 0xE6, 0x89, 0x94,
+};
+
+/* 32x32, 4:2:0, a restart marker after every MCU */
+const uint8_t lv_test_jpeg_420[] = {
+	0xFF, 0xD8, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x06, 0x05,
+	0x06, 0x07, 0x07, 0x06, 0x08, 0x0A, 0x10, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x14, 0x0E, 0x0F, 0x0C,
+	0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1A, 0x1D, 0x25, 0x1F, 0x1A, 0x1B, 0x23,
+	0x1C, 0x16, 0x16, 0x20, 0x2C, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2A, 0x29, 0x19, 0x1F, 0x2D, 0x30,
+	0x2D, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0A,
+	0x08, 0x0A, 0x13, 0x0A, 0x0A, 0x13, 0x28, 0x1A, 0x16, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0, 0x00, 0x11,
+	0x08, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF,
+	0xC4, 0x00, 0x18, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x04, 0x03, 0x07, 0xFF, 0xC4, 0x00, 0x2C, 0x10, 0x00, 0x01,
+	0x02, 0x03, 0x07, 0x02, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04,
+	0x11, 0x00, 0x02, 0x03, 0x05, 0x12, 0x13, 0x21, 0x23, 0x51, 0xF1, 0x15, 0x31, 0x14, 0x41, 0x71,
+	0xE1, 0xF0, 0x33, 0x61, 0x62, 0x81, 0xC1, 0xFF, 0xC4, 0x00, 0x18, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x03,
+	0x07, 0xFF, 0xC4, 0x00, 0x26, 0x11, 0x00, 0x01, 0x02, 0x04, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x02, 0x00, 0x03, 0x04, 0x05, 0x21, 0x31, 0xA1,
+	0xB1, 0xD1, 0x12, 0x32, 0x61, 0xC1, 0x71, 0x81, 0x91, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x01, 0xFF,
+	0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xA7, 0x40, 0xA0,
+	0x59, 0xD9, 0x9D, 0x41, 0x3E, 0x7B, 0x33, 0x73, 0x0C, 0x24, 0x51, 0xE0, 0x25, 0x94, 0x1D, 0x4B,
+	0xE0, 0x1D, 0x9B, 0x38, 0x8E, 0xA0, 0xA7, 0xA7, 0x53, 0xEF, 0x89, 0x8B, 0x96, 0xCC, 0xDC, 0xC2,
+	0xC9, 0xD4, 0x9B, 0x3F, 0x37, 0xC4, 0xBC, 0xCD, 0xE4, 0xCC, 0x3D, 0xE1, 0x4C, 0xCA, 0x34, 0x96,
+	0x88, 0xD0, 0x7D, 0x9E, 0x04, 0x46, 0xDB, 0x6D, 0x7D, 0x43, 0x02, 0x75, 0xE0, 0x47, 0xFF, 0xD0,
+	0xF5, 0x64, 0x8A, 0x3A, 0x78, 0x97, 0xB5, 0x4C, 0x4C, 0xB6, 0x66, 0x02, 0x14, 0xA2, 0xA0, 0x21,
+	0xA7, 0x21, 0xFA, 0x97, 0xC3, 0x6C, 0xCD, 0x12, 0x09, 0x14, 0x94, 0x04, 0x17, 0xC4, 0x33, 0x90,
+	0x36, 0x66, 0x71, 0xFD, 0x85, 0x53, 0x2A, 0xE9, 0xF2, 0x4C, 0x1F, 0x12, 0xF1, 0xF4, 0x6F, 0x8F,
+	0x12, 0x73, 0xA8, 0xD2, 0x62, 0x74, 0x0E, 0xE2, 0x3C, 0x8D, 0xB2, 0x58, 0x36, 0xDB, 0x6C, 0xC9,
+	0x41, 0xF7, 0xC0, 0x8F, 0xFF, 0xD1, 0xC0, 0x99, 0x60, 0x49, 0x52, 0x56, 0xD4, 0x13, 0x76, 0xF2,
+	0xED, 0xCC, 0x2C, 0x99, 0x48, 0xB3, 0xDA, 0x61, 0xAA, 0x2A, 0x13, 0xF8, 0xB7, 0xC7, 0x88, 0xD4,
+	0x4A, 0x7A, 0x68, 0x33, 0x38, 0xA9, 0x7C, 0x7A, 0x33, 0x73, 0x0B, 0xA4, 0x52, 0x2C, 0xF3, 0x28,
+	0x7C, 0x4C, 0x40, 0x06, 0xCC, 0xC7, 0xDE, 0x34, 0x99, 0x4E, 0xE7, 0xA1, 0x7E, 0x2E, 0x76, 0x3B,
+	0x0F, 0xC1, 0x0D, 0xED, 0xB6, 0xA2, 0x30, 0x27, 0x5E, 0x04, 0x7F, 0xFF, 0xD2, 0x79, 0x3A, 0x90,
+	0x89, 0xDB, 0x50, 0x4E, 0x0F, 0xDB, 0xB7, 0x31, 0xBF, 0xC7, 0x0B, 0x32, 0x71, 0x30, 0xD5, 0x96,
+	0xA0, 0xF4, 0x66, 0xE6, 0x25, 0x13, 0x2A, 0x16, 0x75, 0xD0, 0x4D, 0xFB, 0xFF, 0x00, 0xA6, 0xCA,
+	0x3B, 0x15, 0x9E, 0x06, 0x98, 0xCC, 0x54, 0xBF, 0x96, 0xCC, 0xDC, 0xC0, 0x13, 0x69, 0x9C, 0xE2,
+	0xAD, 0xEE, 0xCF, 0xE4, 0x6C, 0x0F, 0xD8, 0x8E, 0x9F, 0x4D, 0x6E, 0x46, 0xB1, 0x30, 0x27, 0x5E,
+	0x04, 0x7F, 0xFF, 0xD9,
+};
+const uint32_t lv_test_jpeg_420_size = sizeof(lv_test_jpeg_420);
+const uint8_t lv_test_jpeg_420_rgb[] = {
+	0x18, 0xD5, 0x47, 0x19, 0xD6, 0x48, 0x2A, 0xD5, 0x53, 0x2B, 0xD6, 0x54, 0x3F, 0xFF, 0x63, 0x39,
+	0xFD, 0x5D, 0x42, 0xF9, 0x8D, 0x4A, 0xFF, 0x95, 0x4F, 0xD8, 0x57, 0x51, 0xDA, 0x59, 0x5E, 0xDD,
+	0x82, 0x62, 0xE1, 0x86, 0x61, 0xFF, 0x6D, 0x6A, 0xFF, 0x76, 0x6F, 0xFB, 0x67, 0x7A, 0xFF, 0x72,
+	0x7A, 0xD2, 0x57, 0x8F, 0xE7, 0x6C, 0x95, 0xCD, 0x5E, 0xA5, 0xDD, 0x6E, 0xAA, 0xF3, 0x70, 0xB6,
+	0xFF, 0x7C, 0xB2, 0xFD, 0x7E, 0xB5, 0xFF, 0x81, 0xB3, 0xD2, 0x6A, 0xC5, 0xE4, 0x7C, 0xC7, 0xE4,
+	0x6D, 0xC5, 0xE2, 0x6B, 0xD1, 0xFC, 0x57, 0xD9, 0xFF, 0x5F, 0xEE, 0xF7, 0x4C, 0xF2, 0xFB, 0x50,
+	0x1A, 0xD7, 0x49, 0x19, 0xD6, 0x48, 0x27, 0xD2, 0x50, 0x2A, 0xD5, 0x53, 0x3D, 0xFF, 0x61, 0x3B,
+	0xFF, 0x5F, 0x42, 0xF9, 0x8D, 0x47, 0xFE, 0x92, 0x50, 0xD9, 0x58, 0x50, 0xD9, 0x58, 0x5B, 0xDA,
+	0x7F, 0x5F, 0xDE, 0x83, 0x61, 0xFF, 0x6D, 0x6B, 0xFF, 0x77, 0x6F, 0xFB, 0x67, 0x76, 0xFF, 0x6E,
+	0x7F, 0xD7, 0x5C, 0x8F, 0xE7, 0x6C, 0x95, 0xCD, 0x5E, 0xA6, 0xDE, 0x6F, 0xAB, 0xF4, 0x71, 0xB8,
+	0xFF, 0x7E, 0xB2, 0xFD, 0x7E, 0xB3, 0xFE, 0x7F, 0xB6, 0xD5, 0x6D, 0xC3, 0xE2, 0x7A, 0xC5, 0xE2,
+	0x6B, 0xC4, 0xE1, 0x6A, 0xD1, 0xFC, 0x57, 0xDA, 0xFF, 0x60, 0xEE, 0xF7, 0x4C, 0xEF, 0xF8, 0x4D,
+	0x22, 0xCD, 0x43, 0x20, 0xCB, 0x41, 0x15, 0xD5, 0x42, 0x1C, 0xDC, 0x49, 0x3A, 0xF7, 0x79, 0x3F,
+	0xFC, 0x7E, 0x55, 0xF0, 0xAE, 0x59, 0xF4, 0xB2, 0x4B, 0xD1, 0x4A, 0x4D, 0xD3, 0x4C, 0x68, 0xCC,
+	0x72, 0x6E, 0xD2, 0x78, 0x81, 0xE5, 0x8D, 0x8F, 0xF3, 0x9B, 0x79, 0xF5, 0x87, 0x80, 0xFC, 0x8E,
+	0x88, 0xC7, 0x6E, 0x96, 0xD5, 0x7C, 0x82, 0xCE, 0x62, 0x97, 0xE3, 0x77, 0xAA, 0xF3, 0x64, 0xB8,
+	0xFF, 0x72, 0xC6, 0xF6, 0x89, 0xC5, 0xF5, 0x88, 0xB5, 0xCC, 0x72, 0xC0, 0xD7, 0x7D, 0xD4, 0xCD,
+	0x85, 0xD8, 0xD1, 0x89, 0xF2, 0xE7, 0x67, 0xFC, 0xF1, 0x71, 0xF7, 0xF8, 0x52, 0xF6, 0xF7, 0x51,
+	0x25, 0xD0, 0x46, 0x25, 0xD0, 0x46, 0x1A, 0xDA, 0x47, 0x20, 0xE0, 0x4D, 0x30, 0xED, 0x6F, 0x37,
+	0xF4, 0x76, 0x4E, 0xE9, 0xA7, 0x51, 0xEC, 0xAA, 0x4C, 0xD2, 0x4B, 0x51, 0xD7, 0x50, 0x6D, 0xD1,
+	0x77, 0x6D, 0xD1, 0x77, 0x7A, 0xDE, 0x86, 0x85, 0xE9, 0x91, 0x71, 0xED, 0x7F, 0x79, 0xF5, 0x87,
+	0x8A, 0xC9, 0x70, 0x96, 0xD5, 0x7C, 0x86, 0xD2, 0x66, 0x99, 0xE5, 0x79, 0xA1, 0xEA, 0x5B, 0xAA,
+	0xF3, 0x64, 0xBB, 0xEB, 0x7E, 0xBC, 0xEC, 0x7F, 0xB9, 0xD0, 0x76, 0xC2, 0xD9, 0x7F, 0xDA, 0xD3,
+	0x8B, 0xDC, 0xD5, 0x8D, 0xEC, 0xE1, 0x61, 0xF2, 0xE7, 0x67, 0xEF, 0xF0, 0x4A, 0xEF, 0xF0, 0x4A,
+	0x25, 0xE4, 0x59, 0x27, 0xE6, 0x5B, 0x28, 0xE8, 0x57, 0x29, 0xE9, 0x58, 0x49, 0xC5, 0x7F, 0x4C,
+	0xC8, 0x82, 0x5F, 0xBC, 0xA7, 0x61, 0xBE, 0xA9, 0x4E, 0xE5, 0x5A, 0x57, 0xEE, 0x63, 0x6E, 0xE8,
+	0x83, 0x63, 0xDD, 0x78, 0x88, 0xC1, 0x98, 0x8B, 0xC4, 0x9B, 0x85, 0xBE, 0x87, 0x8F, 0xC8, 0x91,
+	0x8E, 0xDF, 0x78, 0x99, 0xEA, 0x83, 0x97, 0xDD, 0x87, 0xA2, 0xE8, 0x92, 0xBB, 0xC5, 0x6F, 0xBA,
+	0xC4, 0x6E, 0xCB, 0xBC, 0x91, 0xCD, 0xBE, 0x93, 0xBE, 0xE6, 0x74, 0xC5, 0xED, 0x7B, 0xDB, 0xE9,
+	0x94, 0xD7, 0xE5, 0x90, 0xFA, 0xC9, 0x63, 0xF6, 0xC5, 0x5F, 0xFF, 0xC3, 0x63, 0xFF, 0xC3, 0x63,
+	0x27, 0xE6, 0x5B, 0x2B, 0xEA, 0x5F, 0x2E, 0xEE, 0x5D, 0x2E, 0xEE, 0x5D, 0x3F, 0xBB, 0x75, 0x43,
+	0xBF, 0x79, 0x55, 0xB2, 0x9D, 0x55, 0xB2, 0x9D, 0x51, 0xE8, 0x5D, 0x5D, 0xF4, 0x69, 0x74, 0xEE,
+	0x89, 0x62, 0xDC, 0x77, 0x81, 0xBA, 0x91, 0x81, 0xBA, 0x91, 0x7C, 0xB5, 0x7E, 0x87, 0xC0, 0x89,
+	0x93, 0xE4, 0x7D, 0x9D, 0xEE, 0x87, 0x9F, 0xE5, 0x8F, 0xA8, 0xEE, 0x98, 0xB5, 0xBF, 0x69, 0xB0,
+	0xBA, 0x64, 0xC4, 0xB5, 0x8A, 0xC8, 0xB9, 0x8E, 0xC0, 0xE8, 0x76, 0xC5, 0xED, 0x7B, 0xDF, 0xED,
+	0x98, 0xDA, 0xE8, 0x93, 0xF3, 0xC2, 0x5C, 0xEB, 0xBA, 0x54, 0xF6, 0xBA, 0x5A, 0xF7, 0xBB, 0x5B,
+	0x23, 0xD9, 0x6A, 0x28, 0xDE, 0x6F, 0x3D, 0xD9, 0x74, 0x42, 0xDE, 0x79, 0x4D, 0xAE, 0x7B, 0x55,
+	0xB6, 0x83, 0x5F, 0xB0, 0x8F, 0x5C, 0xAD, 0x8C, 0x59, 0xD7, 0x73, 0x65, 0xE3, 0x7F, 0x74, 0xE7,
+	0x8C, 0x63, 0xD6, 0x7B, 0x82, 0xB8, 0x87, 0x85, 0xBB, 0x8A, 0x8E, 0xAD, 0x81, 0x99, 0xB8, 0x8C,
+	0x95, 0xDB, 0x82, 0x9B, 0xE1, 0x88, 0xAC, 0xD6, 0x8C, 0xB9, 0xE3, 0x99, 0xC1, 0xB5, 0x6D, 0xBE,
+	0xB2, 0x6A, 0xD0, 0xB2, 0x9A, 0xD2, 0xB4, 0x9C, 0xC8, 0xDC, 0x6B, 0xCA, 0xDE, 0x6D, 0xE0, 0xE1,
+	0x9B, 0xDF, 0xE0, 0x9A, 0xF0, 0xBD, 0x6E, 0xE9, 0xB6, 0x67, 0xFF, 0xB4, 0x6D, 0xFF, 0xB2, 0x6B,
+	0x25, 0xDB, 0x6C, 0x27, 0xDD, 0x6E, 0x3A, 0xD6, 0x71, 0x42, 0xDE, 0x79, 0x4B, 0xAC, 0x79, 0x56,
+	0xB7, 0x84, 0x5D, 0xAE, 0x8D, 0x55, 0xA6, 0x85, 0x5B, 0xD9, 0x75, 0x65, 0xE3, 0x7F, 0x72, 0xE5,
+	0x8A, 0x60, 0xD3, 0x78, 0x82, 0xB8, 0x87, 0x85, 0xBB, 0x8A, 0x8D, 0xAC, 0x80, 0x94, 0xB3, 0x87,
+	0x95, 0xDB, 0x82, 0x98, 0xDE, 0x85, 0xA8, 0xD2, 0x88, 0xB6, 0xE0, 0x96, 0xBF, 0xB3, 0x6B, 0xBC,
+	0xB0, 0x68, 0xCD, 0xAF, 0x97, 0xCC, 0xAE, 0x96, 0xCA, 0xDE, 0x6D, 0xC8, 0xDC, 0x6B, 0xDC, 0xDD,
+	0x97, 0xDD, 0xDE, 0x98, 0xEF, 0xBC, 0x6D, 0xE9, 0xB6, 0x67, 0xFF, 0xB2, 0x6B, 0xFE, 0xAE, 0x67,
+	0x30, 0xA7, 0x6D, 0x36, 0xAD, 0x73, 0x3C, 0xAD, 0x81, 0x38, 0xA9, 0x7D, 0x4F, 0xD7, 0x8F, 0x4F,
+	0xD7, 0x8F, 0x59, 0xD3, 0x7C, 0x54, 0xCE, 0x77, 0x65, 0xA1, 0x7D, 0x76, 0xB2, 0x8E, 0x7D, 0xAE,
+	0x76, 0x79, 0xAA, 0x72, 0x8E, 0xD4, 0x7E, 0x82, 0xC8, 0x72, 0x91, 0xD0, 0x89, 0x9A, 0xD9, 0x92,
+	0xA1, 0xA3, 0x8E, 0xAE, 0xB0, 0x9B, 0xAA, 0xB3, 0x60, 0xA1, 0xAA, 0x57, 0xC1, 0xE4, 0x66, 0xAE,
+	0xD1, 0x53, 0xCD, 0xD8, 0x96, 0xCD, 0xD8, 0x96, 0xDB, 0xAB, 0x6B, 0xD6, 0xA6, 0x66, 0xEC, 0xA5,
+	0xA1, 0xF1, 0xAA, 0xA6, 0xFA, 0xCE, 0x9D, 0xF5, 0xC9, 0x98, 0xFD, 0xDC, 0x69, 0xF9, 0xD8, 0x65,
+	0x31, 0xA8, 0x6E, 0x34, 0xAB, 0x71, 0x38, 0xA9, 0x7D, 0x37, 0xA8, 0x7C, 0x4C, 0xD4, 0x8C, 0x4E,
+	0xD6, 0x8E, 0x56, 0xD0, 0x79, 0x4F, 0xC9, 0x72, 0x67, 0xA3, 0x7F, 0x73, 0xAF, 0x8B, 0x76, 0xA7,
+	0x6F, 0x76, 0xA7, 0x6F, 0x8B, 0xD1, 0x7B, 0x83, 0xC9, 0x73, 0x8E, 0xCD, 0x86, 0x92, 0xD1, 0x8A,
+	0xA1, 0xA3, 0x8E, 0xAA, 0xAC, 0x97, 0xA6, 0xAF, 0x5C, 0xA0, 0xA9, 0x56, 0xBE, 0xE1, 0x63, 0xAE,
+	0xD1, 0x53, 0xC9, 0xD4, 0x92, 0xC7, 0xD2, 0x90, 0xDC, 0xAC, 0x6C, 0xD5, 0xA5, 0x65, 0xE7, 0xA0,
+	0x9C, 0xEE, 0xA7, 0xA3, 0xF7, 0xCB, 0x9A, 0xF5, 0xC9, 0x98, 0xFA, 0xD9, 0x66, 0xF4, 0xD3, 0x60,
+	0x2E, 0x9E, 0x7A, 0x2F, 0x9F, 0x7B, 0x44, 0x95, 0x8F, 0x48, 0x99, 0x93, 0x59, 0xC6, 0x8D, 0x5E,
+	0xCB, 0x92, 0x5F, 0xD0, 0x68, 0x59, 0xCA, 0x62, 0x6D, 0x94, 0x8F, 0x75, 0x9C, 0x97, 0x70, 0x9A,
+	0x68, 0x76, 0xA0, 0x6E, 0x89, 0xCF, 0x6D, 0x87, 0xCD, 0x6B, 0x9F, 0xC6, 0x85, 0x9F, 0xC6, 0x85,
+	0xA0, 0x98, 0x81, 0xA6, 0x9E, 0x87, 0xB2, 0xA1, 0x4F, 0xB1, 0xA0, 0x4E, 0xC8, 0xCE, 0x84, 0xBE,
+	0xC4, 0x7A, 0xCF, 0xCD, 0x92, 0xCE, 0xCC, 0x91, 0xE2, 0xA0, 0x66, 0xDB, 0x99, 0x5F, 0xE6, 0x9A,
+	0x76, 0xF1, 0xA5, 0x81, 0xF4, 0xC4, 0xAE, 0xF6, 0xC6, 0xB0, 0xFF, 0xCD, 0x80, 0xFF, 0xC8, 0x7B,
+	0x32, 0xA2, 0x7E, 0x33, 0xA3, 0x7F, 0x49, 0x9A, 0x94, 0x4F, 0xA0, 0x9A, 0x4F, 0xBC, 0x83, 0x53,
+	0xC0, 0x87, 0x55, 0xC6, 0x5E, 0x53, 0xC4, 0x5C, 0x71, 0x98, 0x93, 0x78, 0x9F, 0x9A, 0x72, 0x9C,
+	0x6A, 0x7A, 0xA4, 0x72, 0x80, 0xC6, 0x64, 0x7F, 0xC5, 0x63, 0x96, 0xBD, 0x7C, 0x94, 0xBB, 0x7A,
+	0xA3, 0x9B, 0x84, 0xA6, 0x9E, 0x87, 0xB7, 0xA6, 0x54, 0xB6, 0xA5, 0x53, 0xBF, 0xC5, 0x7B, 0xB7,
+	0xBD, 0x73, 0xC3, 0xC1, 0x86, 0xC6, 0xC4, 0x89, 0xE4, 0xA2, 0x68, 0xE0, 0x9E, 0x64, 0xE9, 0x9D,
+	0x79, 0xF3, 0xA7, 0x83, 0xEC, 0xBC, 0xA6, 0xEE, 0xBE, 0xA8, 0xFB, 0xC3, 0x76, 0xF9, 0xC1, 0x74,
+	0x33, 0xB8, 0x8D, 0x35, 0xBA, 0x8F, 0x59, 0xA9, 0xA0, 0x5B, 0xAB, 0xA2, 0x6A, 0x95, 0x8E, 0x67,
+	0x92, 0x8B, 0x66, 0x9A, 0x58, 0x67, 0x9B, 0x59, 0x75, 0xAD, 0xA0, 0x7D, 0xB5, 0xA8, 0x74, 0xB2,
+	0x6F, 0x77, 0xB5, 0x72, 0x8D, 0xA9, 0x6F, 0x87, 0xA3, 0x69, 0xAB, 0x90, 0x7F, 0xA9, 0x8E, 0x7D,
+	0xA7, 0xB7, 0x76, 0xA6, 0xB6, 0x75, 0xC8, 0xB5, 0x66, 0xC0, 0xAD, 0x5E, 0xD8, 0x97, 0xB9, 0xCD,
+	0x8C, 0xAE, 0xD2, 0x93, 0x84, 0xDA, 0x9B, 0x8C, 0xEB, 0xB7, 0x6E, 0xEA, 0xB6, 0x6D, 0xE9, 0xBC,
+	0x49, 0xED, 0xC0, 0x4D, 0xF8, 0xA0, 0xAC, 0xF4, 0x9C, 0xA8, 0xFF, 0x90, 0x99, 0xFF, 0x92, 0x9B,
+	0x36, 0xBB, 0x90, 0x39, 0xBE, 0x93, 0x5F, 0xAF, 0xA6, 0x61, 0xB1, 0xA8, 0x61, 0x8C, 0x85, 0x5C,
+	0x87, 0x80, 0x5C, 0x90, 0x4E, 0x60, 0x94, 0x52, 0x78, 0xB0, 0xA3, 0x81, 0xB9, 0xAC, 0x79, 0xB7,
+	0x74, 0x7D, 0xBB, 0x78, 0x84, 0xA0, 0x66, 0x7E, 0x9A, 0x60, 0xA2, 0x87, 0x76, 0xA1, 0x86, 0x75,
+	0xAC, 0xBC, 0x7B, 0xA8, 0xB8, 0x77, 0xCE, 0xBB, 0x6C, 0xC5, 0xB2, 0x63, 0xCF, 0x8E, 0xB0, 0xC6,
+	0x85, 0xA7, 0xC8, 0x89, 0x7A, 0xD5, 0x96, 0x87, 0xEE, 0xBA, 0x71, 0xF0, 0xBC, 0x73, 0xEC, 0xBF,
+	0x4C, 0xEF, 0xC2, 0x4F, 0xEF, 0x97, 0xA3, 0xEC, 0x94, 0xA0, 0xFD, 0x85, 0x8E, 0xFF, 0x8A, 0x93,
+	0x3E, 0xAF, 0x84, 0x40, 0xB1, 0x86, 0x4A, 0xB1, 0x93, 0x53, 0xBA, 0x9C, 0x5D, 0x81, 0x9B, 0x5C,
+	0x80, 0x9A, 0x6C, 0x83, 0x69, 0x71, 0x88, 0x6E, 0x75, 0xA9, 0x92, 0x7F, 0xB3, 0x9C, 0x87, 0xAC,
+	0x67, 0x90, 0xB5, 0x70, 0xA2, 0x85, 0x81, 0xA1, 0x84, 0x80, 0xAB, 0x80, 0x91, 0xAA, 0x7F, 0x90,
+	0xB6, 0xB0, 0x7E, 0xAD, 0xA7, 0x75, 0xBA, 0xBD, 0x66, 0xB6, 0xB9, 0x62, 0xCA, 0x84, 0xC0, 0xC8,
+	0x82, 0xBE, 0xD9, 0x82, 0x79, 0xE8, 0x91, 0x88, 0xEC, 0xAF, 0x79, 0xEE, 0xB1, 0x7B, 0xF6, 0xAD,
+	0x3E, 0xFE, 0xB5, 0x46, 0xFF, 0x80, 0xB4, 0xFF, 0x81, 0xB5, 0xFF, 0x80, 0x98, 0xFF, 0x86, 0x9E,
+	0x3F, 0xB0, 0x85, 0x3E, 0xAF, 0x84, 0x47, 0xAE, 0x90, 0x52, 0xB9, 0x9B, 0x5A, 0x7E, 0x98, 0x5B,
+	0x7F, 0x99, 0x69, 0x80, 0x66, 0x6C, 0x83, 0x69, 0x76, 0xAA, 0x93, 0x7D, 0xB1, 0x9A, 0x84, 0xA9,
+	0x64, 0x90, 0xB5, 0x70, 0x9F, 0x82, 0x7E, 0xA0, 0x83, 0x7F, 0xA9, 0x7E, 0x8F, 0xA5, 0x7A, 0x8B,
+	0xB9, 0xB3, 0x81, 0xAB, 0xA5, 0x73, 0xB6, 0xB9, 0x62, 0xB4, 0xB7, 0x60, 0xC7, 0x81, 0xBD, 0xC9,
+	0x83, 0xBF, 0xD6, 0x7F, 0x76, 0xE4, 0x8D, 0x84, 0xED, 0xB0, 0x7A, 0xED, 0xB0, 0x7A, 0xF1, 0xA8,
+	0x39, 0xFB, 0xB2, 0x43, 0xFF, 0x7E, 0xB2, 0xFF, 0x81, 0xB5, 0xFE, 0x7C, 0x94, 0xFF, 0x80, 0x98,
+	0x4C, 0x71, 0xA8, 0x53, 0x78, 0xAF, 0x64, 0x75, 0xBB, 0x5C, 0x6D, 0xB3, 0x68, 0xA6, 0x53, 0x61,
+	0x9F, 0x4C, 0x6D, 0x9B, 0x7E, 0x76, 0xA4, 0x87, 0x85, 0x7C, 0x75, 0x78, 0x6F, 0x68, 0x88, 0x78,
+	0x83, 0x8C, 0x7C, 0x87, 0x92, 0xA9, 0x3F, 0x93, 0xAA, 0x40, 0xAE, 0xA4, 0x9B, 0xA8, 0x9E, 0x95,
+	0xB8, 0x78, 0x92, 0xB7, 0x77, 0x91, 0xCB, 0x77, 0x84, 0xC7, 0x73, 0x80, 0xDB, 0xA2, 0x6B, 0xDA,
+	0xA1, 0x6A, 0xE3, 0xA2, 0x68, 0xDC, 0x9B, 0x61, 0xF2, 0x74, 0x89, 0xF7, 0x79, 0x8E, 0xF5, 0x82,
+	0x70, 0xEC, 0x79, 0x67, 0xF6, 0xA8, 0x77, 0xF5, 0xA7, 0x76, 0xFF, 0x9D, 0xB2, 0xFF, 0x9F, 0xB4,
+	0x4E, 0x73, 0xAA, 0x53, 0x78, 0xAF, 0x62, 0x73, 0xB9, 0x5B, 0x6C, 0xB2, 0x65, 0xA3, 0x50, 0x61,
+	0x9F, 0x4C, 0x6C, 0x9A, 0x7D, 0x74, 0xA2, 0x85, 0x8B, 0x82, 0x7B, 0x7C, 0x73, 0x6C, 0x88, 0x78,
+	0x83, 0x8C, 0x7C, 0x87, 0x90, 0xA7, 0x3D, 0x91, 0xA8, 0x3E, 0xA9, 0x9F, 0x96, 0xA1, 0x97, 0x8E,
+	0xB9, 0x79, 0x93, 0xB7, 0x77, 0x91, 0xCB, 0x77, 0x84, 0xC8, 0x74, 0x81, 0xD7, 0x9E, 0x67, 0xD8,
+	0x9F, 0x68, 0xE2, 0xA1, 0x67, 0xDB, 0x9A, 0x60, 0xF5, 0x77, 0x8C, 0xF6, 0x78, 0x8D, 0xF1, 0x7E,
+	0x6C, 0xEB, 0x78, 0x66, 0xF3, 0xA5, 0x74, 0xF5, 0xA7, 0x76, 0xFF, 0x9D, 0xB2, 0xFF, 0x9C, 0xB1,
+	0x57, 0x6A, 0x92, 0x5A, 0x6D, 0x95, 0x4F, 0x7C, 0x81, 0x4E, 0x7B, 0x80, 0x63, 0x9B, 0x50, 0x66,
+	0x9E, 0x53, 0x80, 0x91, 0x9B, 0x86, 0x97, 0xA1, 0x84, 0x79, 0x67, 0x78, 0x6D, 0x5B, 0x93, 0x65,
+	0x81, 0x9D, 0x6F, 0x8B, 0xB0, 0x8D, 0x67, 0xB7, 0x94, 0x6E, 0xB5, 0xA2, 0x94, 0xAF, 0x9C, 0x8E,
+	0xC2, 0x6C, 0x89, 0xC2, 0x6C, 0x89, 0xBC, 0x7A, 0x7C, 0xBE, 0x7C, 0x7E, 0xD5, 0x94, 0x6C, 0xDC,
+	0x9B, 0x73, 0xF7, 0x9E, 0x5A, 0xF2, 0x99, 0x55, 0xF3, 0x6C, 0xA7, 0xF2, 0x6B, 0xA6, 0xFD, 0x6E,
+	0x66, 0xFB, 0x6C, 0x64, 0xFF, 0x8F, 0x6C, 0xFF, 0x97, 0x74, 0xFF, 0x9F, 0x9C, 0xFF, 0x9F, 0x9C,
+	0x5C, 0x6F, 0x97, 0x5C, 0x6F, 0x97, 0x4E, 0x7B, 0x80, 0x4F, 0x7C, 0x81, 0x5A, 0x92, 0x47, 0x60,
+	0x98, 0x4D, 0x78, 0x89, 0x93, 0x7D, 0x8E, 0x98, 0x85, 0x7A, 0x68, 0x7D, 0x72, 0x60, 0x97, 0x69,
+	0x85, 0xA0, 0x72, 0x8E, 0xA8, 0x85, 0x5F, 0xAE, 0x8B, 0x65, 0xAB, 0x98, 0x8A, 0xAA, 0x97, 0x89,
+	0xC7, 0x71, 0x8E, 0xC5, 0x6F, 0x8C, 0xBF, 0x7D, 0x7F, 0xC1, 0x7F, 0x81, 0xCC, 0x8B, 0x63, 0xD5,
+	0x94, 0x6C, 0xF0, 0x97, 0x53, 0xEA, 0x91, 0x4D, 0xF7, 0x70, 0xAB, 0xF7, 0x70, 0xAB, 0xFF, 0x73,
+	0x6B, 0xFE, 0x6F, 0x67, 0xFF, 0x82, 0x5F, 0xFF, 0x8A, 0x67, 0xFC, 0x93, 0x90, 0xFD, 0x94, 0x91,
+	0x5D, 0x8A, 0x87, 0x59, 0x86, 0x83, 0x57, 0x89, 0x54, 0x56, 0x88, 0x53, 0x77, 0x6F, 0x48, 0x7A,
+	0x72, 0x4B, 0x8B, 0x5D, 0x9D, 0x8C, 0x5E, 0x9E, 0x8E, 0x93, 0x73, 0x8A, 0x8F, 0x6F, 0x9B, 0x81,
+	0x9E, 0x9C, 0x82, 0x9F, 0xB5, 0x62, 0x7E, 0xB1, 0x5E, 0x7A, 0xB5, 0x65, 0x64, 0xB8, 0x68, 0x67,
+	0xCB, 0x89, 0x8B, 0xC7, 0x85, 0x87, 0xCC, 0x8B, 0x65, 0xCB, 0x8A, 0x64, 0xEB, 0x5D, 0x95, 0xF1,
+	0x63, 0x9B, 0xFF, 0x65, 0x78, 0xFB, 0x5E, 0x71, 0xFC, 0x89, 0x9A, 0xFE, 0x8B, 0x9C, 0xFF, 0x91,
+	0x51, 0xF8, 0x88, 0x48, 0xFF, 0x60, 0x6F, 0xFF, 0x61, 0x70, 0xFF, 0x69, 0x65, 0xFF, 0x6A, 0x66,
+	0x5B, 0x88, 0x85, 0x59, 0x86, 0x83, 0x58, 0x8A, 0x55, 0x58, 0x8A, 0x55, 0x6D, 0x65, 0x3E, 0x71,
+	0x69, 0x42, 0x83, 0x55, 0x95, 0x84, 0x56, 0x96, 0x8A, 0x8F, 0x6F, 0x8D, 0x92, 0x72, 0x9E, 0x84,
+	0xA1, 0xA0, 0x86, 0xA3, 0xAE, 0x5B, 0x77, 0xA9, 0x56, 0x72, 0xAA, 0x5A, 0x59, 0xB1, 0x61, 0x60,
+	0xCC, 0x8A, 0x8C, 0xC8, 0x86, 0x88, 0xCD, 0x8C, 0x66, 0xCE, 0x8D, 0x67, 0xE2, 0x54, 0x8C, 0xE9,
+	0x5B, 0x93, 0xFA, 0x5D, 0x70, 0xF2, 0x55, 0x68, 0xFB, 0x88, 0x99, 0xFF, 0x8C, 0x9D, 0xFF, 0x95,
+	0x55, 0xFD, 0x8D, 0x4D, 0xFE, 0x56, 0x65, 0xFD, 0x55, 0x64, 0xFA, 0x5B, 0x57, 0xFB, 0x5C, 0x58,
+	0x54, 0x7C, 0x61, 0x55, 0x7D, 0x62, 0x65, 0x7B, 0x4A, 0x6C, 0x82, 0x51, 0x78, 0x52, 0x4F, 0x81,
+	0x5B, 0x58, 0x8E, 0x4F, 0x9E, 0x92, 0x53, 0xA2, 0x86, 0x78, 0x6B, 0x8C, 0x7E, 0x71, 0x9A, 0x78,
+	0x99, 0xA3, 0x81, 0xA2, 0xAE, 0x57, 0x81, 0xAF, 0x58, 0x82, 0xC0, 0x57, 0x5C, 0xC7, 0x5E, 0x63,
+	0xC8, 0x7D, 0x78, 0xC6, 0x7B, 0x76, 0xDD, 0x7A, 0x63, 0xE5, 0x82, 0x6B, 0xF0, 0x45, 0x91, 0xFB,
+	0x50, 0x9C, 0xFF, 0x53, 0x94, 0xFE, 0x4B, 0x8C, 0xF8, 0x7A, 0x7E, 0xFE, 0x80, 0x84, 0xFF, 0x8A,
+	0x5E, 0xFF, 0x8A, 0x5E, 0xFA, 0x53, 0x65, 0xFD, 0x56, 0x68, 0xFF, 0x57, 0x48, 0xFF, 0x55, 0x46,
+	0x4F, 0x77, 0x5C, 0x52, 0x7A, 0x5F, 0x65, 0x7B, 0x4A, 0x6D, 0x83, 0x52, 0x74, 0x4E, 0x4B, 0x7E,
+	0x58, 0x55, 0x8C, 0x4D, 0x9C, 0x91, 0x52, 0xA1, 0x88, 0x7A, 0x6D, 0x8D, 0x7F, 0x72, 0x98, 0x76,
+	0x97, 0xA3, 0x81, 0xA2, 0xAD, 0x56, 0x80, 0xAE, 0x57, 0x81, 0xBA, 0x51, 0x56, 0xBF, 0x56, 0x5B,
+	0xC5, 0x7A, 0x75, 0xC3, 0x78, 0x73, 0xDC, 0x79, 0x62, 0xE6, 0x83, 0x6C, 0xED, 0x42, 0x8E, 0xFA,
+	0x4F, 0x9B, 0xFF, 0x51, 0x92, 0xFC, 0x49, 0x8A, 0xF5, 0x77, 0x7B, 0xF9, 0x7B, 0x7F, 0xFA, 0x85,
+	0x59, 0xFF, 0x8A, 0x5E, 0xF9, 0x52, 0x64, 0xFE, 0x57, 0x69, 0xFF, 0x55, 0x46, 0xFF, 0x50, 0x41,
+	0x5C, 0x4C, 0x3C, 0x62, 0x52, 0x42, 0x67, 0x50, 0x56, 0x61, 0x4A, 0x50, 0x7A, 0x71, 0x82, 0x7C,
+	0x73, 0x84, 0x8D, 0x70, 0xA6, 0x90, 0x73, 0xA9, 0x92, 0x43, 0x63, 0x9D, 0x4E, 0x6E, 0xB0, 0x4F,
+	0x82, 0xA0, 0x3F, 0x72, 0xBA, 0x6F, 0x86, 0xBF, 0x74, 0x8B, 0xBB, 0x70, 0x75, 0xC2, 0x77, 0x7C,
+	0xCE, 0x45, 0x61, 0xD6, 0x4D, 0x69, 0xDA, 0x46, 0x80, 0xE8, 0x54, 0x8E, 0xE8, 0x70, 0x5F, 0xEC,
+	0x74, 0x63, 0xFF, 0x77, 0x85, 0xFB, 0x73, 0x81, 0xFD, 0x3F, 0x87, 0xFF, 0x48, 0x90, 0xFF, 0x4A,
+	0xA0, 0xFF, 0x41, 0x97, 0xFF, 0x78, 0x5C, 0xFF, 0x72, 0x56, 0xFB, 0x75, 0x4F, 0xFB, 0x75, 0x4F,
+	0x5F, 0x4F, 0x3F, 0x61, 0x51, 0x41, 0x65, 0x4E, 0x54, 0x62, 0x4B, 0x51, 0x79, 0x70, 0x81, 0x7E,
+	0x75, 0x86, 0x8C, 0x6F, 0xA5, 0x8B, 0x6E, 0xA4, 0x94, 0x45, 0x65, 0x9C, 0x4D, 0x6D, 0xAC, 0x4B,
+	0x7E, 0x9F, 0x3E, 0x71, 0xB7, 0x6C, 0x83, 0xBE, 0x73, 0x8A, 0xB9, 0x6E, 0x73, 0xBE, 0x73, 0x78,
+	0xD1, 0x48, 0x64, 0xD6, 0x4D, 0x69, 0xD7, 0x43, 0x7D, 0xE6, 0x52, 0x8C, 0xE7, 0x6F, 0x5E, 0xEB,
+	0x73, 0x62, 0xFB, 0x73, 0x81, 0xF6, 0x6E, 0x7C, 0xFF, 0x41, 0x89, 0xFF, 0x46, 0x8E, 0xFF, 0x47,
+	0x9D, 0xFF, 0x40, 0x96, 0xFF, 0x77, 0x5B, 0xFF, 0x73, 0x57, 0xFA, 0x74, 0x4E, 0xF7, 0x71, 0x4B,
+	0x5E, 0x45, 0x3E, 0x5F, 0x46, 0x3F, 0x73, 0x35, 0x74, 0x76, 0x38, 0x77, 0x86, 0x5F, 0x98, 0x8F,
+	0x68, 0xA1, 0x96, 0x6E, 0x93, 0x93, 0x6B, 0x90, 0x9A, 0x38, 0x6B, 0xA0, 0x3E, 0x71, 0xAA, 0x44,
+	0x74, 0xA3, 0x3D, 0x6D, 0xB5, 0x68, 0x7A, 0xC1, 0x74, 0x86, 0xCB, 0x63, 0x88, 0xD1, 0x69, 0x8E,
+	0xD0, 0x40, 0x64, 0xD5, 0x45, 0x69, 0xE5, 0x32, 0x83, 0xF5, 0x42, 0x93, 0xF4, 0x65, 0x5D, 0xFA,
+	0x6B, 0x63, 0xFF, 0x6C, 0x97, 0xFD, 0x66, 0x91, 0xFF, 0x3B, 0x69, 0xFF, 0x3E, 0x6C, 0xFC, 0x3A,
+	0xAA, 0xFD, 0x3B, 0xAB, 0xFB, 0x6F, 0x70, 0xFC, 0x70, 0x71, 0xFF, 0x6C, 0x66, 0xFF, 0x68, 0x62,
+	0x5F, 0x46, 0x3F, 0x62, 0x49, 0x42, 0x77, 0x39, 0x78, 0x7B, 0x3D, 0x7C, 0x7C, 0x55, 0x8E, 0x85,
+	0x5E, 0x97, 0x8A, 0x62, 0x87, 0x88, 0x60, 0x85, 0x9F, 0x3D, 0x70, 0xA4, 0x42, 0x75, 0xAE, 0x48,
+	0x78, 0xA9, 0x43, 0x73, 0xAC, 0x5F, 0x71, 0xB7, 0x6A, 0x7C, 0xC3, 0x5B, 0x80, 0xCB, 0x63, 0x88,
+	0xD2, 0x42, 0x66, 0xD9, 0x49, 0x6D, 0xEA, 0x37, 0x88, 0xF5, 0x42, 0x93, 0xEE, 0x5F, 0x57, 0xF0,
+	0x61, 0x59, 0xFA, 0x63, 0x8E, 0xF8, 0x61, 0x8C, 0xFF, 0x3B, 0x69, 0xFF, 0x3E, 0x6C, 0xFD, 0x3B,
+	0xAB, 0xFF, 0x3D, 0xAD, 0xF0, 0x64, 0x65, 0xF0, 0x64, 0x65, 0xFA, 0x61, 0x5B, 0xF8, 0x5F, 0x59,
+	0x62, 0x59, 0x5C, 0x66, 0x5D, 0x60, 0x88, 0x44, 0x97, 0x87, 0x43, 0x96, 0x99, 0x31, 0x94, 0x9B,
+	0x33, 0x96, 0x9B, 0x3B, 0x6B, 0x99, 0x39, 0x69, 0xA5, 0x53, 0x7B, 0xAA, 0x58, 0x80, 0xAF, 0x5D,
+	0x85, 0xA6, 0x54, 0x7C, 0xB8, 0x41, 0x7B, 0xBC, 0x45, 0x7F, 0xD6, 0x2C, 0x84, 0xE2, 0x38, 0x90,
+	0xD2, 0x56, 0x7B, 0xDB, 0x5F, 0x84, 0xF8, 0x4A, 0x7D, 0xFA, 0x4C, 0x7F, 0xFF, 0x37, 0x83, 0xFF,
+	0x30, 0x7C, 0xFF, 0x37, 0x9E, 0xFF, 0x37, 0x9E, 0xFF, 0x5A, 0x47, 0xFF, 0x5D, 0x4A, 0xF7, 0x57,
+	0x93, 0xF6, 0x56, 0x92, 0xF6, 0x40, 0x97, 0xF1, 0x3B, 0x92, 0xFF, 0x34, 0x66, 0xFF, 0x35, 0x67,
+	0x67, 0x5E, 0x61, 0x6C, 0x63, 0x66, 0x8F, 0x4B, 0x9E, 0x8F, 0x4B, 0x9E, 0x92, 0x2A, 0x8D, 0x94,
+	0x2C, 0x8F, 0x93, 0x33, 0x63, 0x90, 0x30, 0x60, 0xA8, 0x56, 0x7E, 0xAD, 0x5B, 0x83, 0xB3, 0x61,
+	0x89, 0xAB, 0x59, 0x81, 0xAD, 0x36, 0x70, 0xB1, 0x3A, 0x74, 0xCC, 0x22, 0x7A, 0xDB, 0x31, 0x89,
+	0xD4, 0x58, 0x7D, 0xDF, 0x63, 0x88, 0xFD, 0x4F, 0x82, 0xF9, 0x4B, 0x7E, 0xFF, 0x30, 0x7C, 0xF8,
+	0x24, 0x70, 0xFF, 0x2C, 0x93, 0xFF, 0x2F, 0x96, 0xFF, 0x5E, 0x4B, 0xFF, 0x60, 0x4D, 0xFA, 0x5A,
+	0x96, 0xFC, 0x5C, 0x98, 0xEE, 0x38, 0x8F, 0xE9, 0x33, 0x8A, 0xFF, 0x2C, 0x5E, 0xFF, 0x2F, 0x61,
+	0x6F, 0x4F, 0x64, 0x73, 0x53, 0x68, 0x7B, 0x4C, 0x94, 0x81, 0x52, 0x9A, 0x90, 0x23, 0x90, 0x97,
+	0x2A, 0x97, 0xA4, 0x2A, 0x63, 0xA0, 0x26, 0x5F, 0xA5, 0x50, 0x6D, 0xA8, 0x53, 0x70, 0xBE, 0x50,
+	0x81, 0xBC, 0x4E, 0x7F, 0xCA, 0x1B, 0x84, 0xD2, 0x23, 0x8C, 0xD3, 0x1B, 0x8B, 0xE2, 0x2A, 0x9A,
+	0xDC, 0x4A, 0x88, 0xE6, 0x54, 0x92, 0xE9, 0x50, 0x7E, 0xE6, 0x4D, 0x7B, 0xFF, 0x2B, 0x7B, 0xF5,
+	0x20, 0x70, 0xFF, 0x28, 0x70, 0xFF, 0x2B, 0x73, 0xFC, 0x52, 0x5B, 0xFC, 0x52, 0x5B, 0xFF, 0x4A,
+	0x94, 0xFF, 0x52, 0x9C, 0xFF, 0x21, 0x9F, 0xFF, 0x20, 0x9E, 0xFF, 0x29, 0x6B, 0xFF, 0x2B, 0x6D,
+	0x6F, 0x4F, 0x64, 0x6F, 0x4F, 0x64, 0x76, 0x47, 0x8F, 0x7E, 0x4F, 0x97, 0x8B, 0x1E, 0x8B, 0x95,
+	0x28, 0x95, 0xA0, 0x26, 0x5F, 0x98, 0x1E, 0x57, 0xA5, 0x50, 0x6D, 0xA5, 0x50, 0x6D, 0xB9, 0x4B,
+	0x7C, 0xBA, 0x4C, 0x7D, 0xC6, 0x17, 0x80, 0xD0, 0x21, 0x8A, 0xD0, 0x18, 0x88, 0xDD, 0x25, 0x95,
+	0xDE, 0x4C, 0x8A, 0xE6, 0x54, 0x92, 0xE6, 0x4D, 0x7B, 0xE3, 0x4A, 0x78, 0xFD, 0x28, 0x78, 0xF2,
+	0x1D, 0x6D, 0xFF, 0x23, 0x6B, 0xFF, 0x23, 0x6B, 0xFB, 0x51, 0x5A, 0xF7, 0x4D, 0x56, 0xFB, 0x43,
+	0x8D, 0xFF, 0x4E, 0x98, 0xFF, 0x1C, 0x9A, 0xFF, 0x1D, 0x9B, 0xFF, 0x24, 0x66, 0xFF, 0x24, 0x66,
+};
+
+/* 16x16, progressive */
+const uint8_t lv_test_jpeg_progressive[] = {
+	0xFF, 0xD8, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x06, 0x05,
+	0x06, 0x07, 0x07, 0x06, 0x08, 0x0A, 0x10, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x14, 0x0E, 0x0F, 0x0C,
+	0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1A, 0x1D, 0x25, 0x1F, 0x1A, 0x1B, 0x23,
+	0x1C, 0x16, 0x16, 0x20, 0x2C, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2A, 0x29, 0x19, 0x1F, 0x2D, 0x30,
+	0x2D, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0A,
+	0x08, 0x0A, 0x13, 0x0A, 0x0A, 0x13, 0x28, 0x1A, 0x16, 0x1A, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC2, 0x00, 0x11,
+	0x08, 0x00, 0x10, 0x00, 0x10, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF,
+	0xC4, 0x00, 0x15, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0xFF, 0xC4, 0x00, 0x18, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x03, 0x06,
+	0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x10, 0x03, 0x10, 0x00, 0x00, 0x01, 0xA7, 0x3F,
+	0x95, 0x60, 0xBF, 0x1D, 0xF2, 0x5E, 0x14, 0x7F, 0xFF, 0xC4, 0x00, 0x18, 0x10, 0x01, 0x00, 0x03,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x13, 0x12, 0xFF, 0xDA, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x05, 0x02, 0x0B, 0x38, 0x57, 0x12,
+	0x96, 0x74, 0x56, 0x73, 0xFF, 0xC4, 0x00, 0x18, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x12, 0x13, 0x02, 0xFF, 0xDA,
+	0x00, 0x08, 0x01, 0x03, 0x01, 0x01, 0x3F, 0x01, 0xF0, 0x5D, 0x23, 0x2D, 0xC4, 0x5D, 0x22, 0x2D,
+	0xDF, 0xFF, 0xC4, 0x00, 0x1F, 0x11, 0x00, 0x01, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x12, 0x21, 0x51, 0x22, 0x31, 0x42,
+	0xD1, 0xF0, 0xFF, 0xDA, 0x00, 0x08, 0x01, 0x02, 0x01, 0x01, 0x3F, 0x01, 0x8A, 0x3E, 0x58, 0x42,
+	0x3A, 0xC0, 0x6F, 0xB7, 0x52, 0x37, 0x42, 0x7B, 0x49, 0xBE, 0x3A, 0x5F, 0xFF, 0xC4, 0x00, 0x16,
+	0x10, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x51, 0x11, 0xFF, 0xDA, 0x00, 0x08, 0x01, 0x01, 0x00, 0x06, 0x3F, 0x02, 0xAA, 0xBA,
+	0xAF, 0xFF, 0xC4, 0x00, 0x19, 0x10, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x01, 0x10, 0x11, 0x51, 0xFF, 0xDA, 0x00, 0x08,
+	0x01, 0x01, 0x00, 0x01, 0x3F, 0x21, 0x70, 0x65, 0x8E, 0xAA, 0x06, 0x07, 0xFF, 0xDA, 0x00, 0x0C,
+	0x03, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xAF, 0xFF, 0xC4, 0x00, 0x18,
+	0x11, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x31, 0x51, 0x71, 0xFF, 0xDA, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01, 0x3F, 0x10,
+	0x92, 0x22, 0x98, 0x86, 0x31, 0x1C, 0x27, 0xFF, 0xC4, 0x00, 0x1D, 0x11, 0x01, 0x00, 0x02, 0x02,
+	0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x21, 0x00,
+	0x91, 0x31, 0x61, 0xA1, 0xB1, 0xD1, 0xFF, 0xDA, 0x00, 0x08, 0x01, 0x02, 0x01, 0x01, 0x3F, 0x10,
+	0x06, 0x51, 0x56, 0xC4, 0x84, 0x80, 0x07, 0x63, 0xE6, 0x5A, 0x8A, 0x5A, 0xDF, 0x3E, 0x07, 0x1F,
+	0x7A, 0x63, 0x67, 0xDE, 0x7F, 0xFF, 0xC4, 0x00, 0x1C, 0x10, 0x00, 0x02, 0x02, 0x03, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x21, 0x31, 0x41,
+	0x51, 0xF1, 0xE1, 0xFF, 0xDA, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3F, 0x10, 0x15, 0xCD, 0x2F,
+	0xC4, 0xBD, 0x8A, 0x87, 0x08, 0x3C, 0x57, 0x37, 0xDA, 0x78, 0x97, 0xB0, 0xB6, 0x78, 0x16, 0x92,
+	0x1F, 0x67, 0xFF, 0xD9,
+};
+const uint32_t lv_test_jpeg_progressive_size = sizeof(lv_test_jpeg_progressive);
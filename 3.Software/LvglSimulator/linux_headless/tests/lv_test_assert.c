@@ -0,0 +1,84 @@
+/**
+ * @file lv_test_assert.c
+ * Asserts of the runner's unit tests, like LVGL's tests/lv_test_assert.c (see lv_test_assert.h)
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include "lv_test_assert.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_print(const char* s, ...)
+{
+	va_list args;
+	va_start(args, s);
+	vfprintf(stdout, s, args);
+	fprintf(stdout, "\n");
+	va_end(args);
+}
+
+void lv_test_exit(const char* s, ...)
+{
+	va_list args;
+	va_start(args, s);
+	vfprintf(stderr, s, args);
+	fprintf(stderr, "\n");
+	va_end(args);
+
+	exit(1);
+}
+
+void lv_test_error(const char* s, ...)
+{
+	va_list args;
+	va_start(args, s);
+	vfprintf(stderr, s, args);
+	fprintf(stderr, "\n");
+	va_end(args);
+
+	exit(1);
+}
+
+void lv_test_assert_true(int32_t expression, const char* s)
+{
+	if (!expression) lv_test_error("   FAIL: %s. (Expected: not zero)", s);
+	else lv_test_print("   PASS: %s. (Expected: not zero)", s);
+}
+
+void lv_test_assert_int_eq(int32_t n_ref, int32_t n_act, const char* s)
+{
+	if (n_ref != n_act) lv_test_error("   FAIL: %s. (Expected:  %d, Actual: %d)", s, n_ref, n_act);
+	else lv_test_print("   PASS: %s. (Expected: %d)", s, n_ref);
+}
+
+void lv_test_assert_int_gt(int32_t n_ref, int32_t n_act, const char* s)
+{
+	if (n_act <= n_ref) lv_test_error("   FAIL: %s. (Expected:  > %d, Actual: %d)", s, n_ref, n_act);
+	else lv_test_print("   PASS: %s. (Expected: > %d, Actual: %d)", s, n_ref, n_act);
+}
+
+void lv_test_assert_int_lt(int32_t n_ref, int32_t n_act, const char* s)
+{
+	if (n_act >= n_ref) lv_test_error("   FAIL: %s. (Expected:  < %d, Actual: %d)", s, n_ref, n_act);
+	else lv_test_print("   PASS: %s. (Expected: < %d, Actual: %d)", s, n_ref, n_act);
+}
+
+void lv_test_assert_str_eq(const char* s_ref, const char* s_act, const char* s)
+{
+	if (strcmp(s_ref, s_act) != 0) lv_test_error("   FAIL: %s. (Expected:  %s, Actual: %s)", s, s_ref, s_act);
+	else lv_test_print("   PASS: %s. (Expected: %s)", s, s_ref);
+}
+
+void lv_test_assert_array_eq(const uint8_t* p_ref, const uint8_t* p_act, int32_t size, const char* s)
+{
+	if (memcmp(p_ref, p_act, size) != 0) lv_test_error("   FAIL: %s. (Expected: all %d bytes should be equal)", s, size);
+	else lv_test_print("   PASS: %s. (Expected: all %d bytes should be equal)", s, size);
+}
@@ -0,0 +1,32 @@
+/**
+ * @file lv_test_assert.h
+ * The asserts of LVGL's tests/lv_test_assert.h for the runner's unit tests.
+ * LVGL's own lv_test_assert.c compares colors by `ch.green`, which doesn't exist with the
+ * firmware's `LV_COLOR_16_SWAP`, and needs libpng for the screenshots; the tests here don't.
+ */
+
+#ifndef LV_TEST_ASSERT_H
+#define LV_TEST_ASSERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+	void lv_test_print(const char* s, ...);
+	void lv_test_exit(const char* s, ...);
+	void lv_test_error(const char* s, ...);
+	void lv_test_assert_true(int32_t expression, const char* s);
+	void lv_test_assert_int_eq(int32_t n_ref, int32_t n_act, const char* s);
+	void lv_test_assert_int_gt(int32_t n_ref, int32_t n_act, const char* s);
+	void lv_test_assert_int_lt(int32_t n_ref, int32_t n_act, const char* s);
+	void lv_test_assert_str_eq(const char* s_ref, const char* s_act, const char* s);
+	void lv_test_assert_array_eq(const uint8_t* p_ref, const uint8_t* p_act, int32_t size, const char* s);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_ASSERT_H*/
@@ -0,0 +1,376 @@
+/**
+ * @file lv_test_holo_anim.c
+ *
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <string.h>
+#include "lvgl.h"
+#include "lv_holo_anim.h"
+#include "lv_test_assert.h"
+#include "lv_test_holo_anim.h"
+
+/*********************
+*      DEFINES
+*********************/
+#define IMG_W       20  /*Not a multiple of the tile size: the last column and row of tiles are clipped*/
+#define IMG_H       13
+#define TILE_SIZE   8
+#define OBJ_X       33  /*Not aligned to the tiles of the display either*/
+#define OBJ_Y       50
+#define RLE_UNITS   300
+#define BUF_SIZE    (RLE_UNITS * 4 * 2)
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void rle_splits(uint8_t unit);
+static void key_frame(lv_img_cf_t cf, uint8_t unit);
+static void delta_frame(lv_img_cf_t cf, uint8_t unit, bool rle);
+static void header_init(lv_holo_anim_header_t* header, lv_img_cf_t cf, uint8_t unit);
+static void frame_fill(const lv_holo_anim_header_t* header, uint8_t* frame, uint8_t seed);
+static void tile_touch(const lv_holo_anim_header_t* header, uint8_t* frame, lv_coord_t col, lv_coord_t row);
+static uint32_t delta_build(const lv_holo_anim_header_t* header, const uint8_t* prev, const uint8_t* next,
+	bool rle, uint8_t* out);
+static uint32_t rle_encode(uint8_t unit, const uint8_t* in, uint32_t len, uint8_t* out);
+static void inv_clear(void);
+static uint32_t inv_check(const lv_area_t* areas, uint32_t cnt);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static lv_obj_t* img;
+static uint8_t prev[IMG_W * IMG_H * 4];
+static uint8_t next[IMG_W * IMG_H * 4];
+static uint8_t frame[IMG_W * IMG_H * 4];
+static uint8_t raw[BUF_SIZE];
+static uint8_t enc[BUF_SIZE];
+static uint8_t out[BUF_SIZE];
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_holo_anim(void)
+{
+	lv_test_print("");
+	lv_test_print("===========================");
+	lv_test_print("Start lv_holo_anim testing");
+	lv_test_print("===========================");
+
+	img = lv_obj_create(lv_scr_act(), NULL);
+	lv_obj_set_pos(img, OBJ_X, OBJ_Y);
+	lv_obj_set_size(img, IMG_W, IMG_H);
+
+	rle_splits(2);
+	rle_splits(3);
+
+	/* Units of 2 and 3 bytes are the pixels of these with 16 bit colors */
+	key_frame(LV_IMG_CF_TRUE_COLOR, 2);
+	key_frame(LV_IMG_CF_TRUE_COLOR_ALPHA, 3);
+	delta_frame(LV_IMG_CF_TRUE_COLOR, 2, false);
+	delta_frame(LV_IMG_CF_TRUE_COLOR, 2, true);
+	delta_frame(LV_IMG_CF_TRUE_COLOR_ALPHA, 3, false);
+	delta_frame(LV_IMG_CF_TRUE_COLOR_ALPHA, 3, true);
+
+	lv_obj_del(img);
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+/* The input and the output of the decoder split in two at every byte */
+static void rle_splits(uint8_t unit)
+{
+	lv_test_print("");
+	lv_test_print("RLE with %d byte units split at every byte:", unit);
+
+	/* A run and a literal longer than the 128 units of a control byte, and some short ones */
+	uint32_t total = RLE_UNITS * unit;
+	uint32_t i;
+	for (i = 0; i < total; i++)
+	{
+		uint32_t u = i / unit;
+		if (u < 5) raw[i] = 0x11 + i % unit;
+		else if (u < 10) raw[i] = (uint8_t)(u * 31 + i % unit);
+		else if (u < 150) raw[i] = 0x77 - i % unit;
+		else raw[i] = (uint8_t)(u * 7 + i % unit * 3);
+	}
+	uint32_t enc_len = rle_encode(unit, raw, total, enc);
+
+	lv_holo_anim_rle_t rle;
+	uint32_t used;
+	uint32_t used2;
+	uint32_t fails = 0;
+	uint32_t split;
+	for (split = 0; split <= enc_len; split++)
+	{
+		memset(out, 0, sizeof(out));
+		lv_holo_anim_rle_init(&rle, unit);
+		uint32_t n = lv_holo_anim_rle_decode(&rle, enc, split, &used, out, total);
+		if (used != split) fails++;
+		n += lv_holo_anim_rle_decode(&rle, enc + split, enc_len - split, &used2, out + n, total - n);
+		if (n != total || used2 != enc_len - split || memcmp(raw, out, total) != 0) fails++;
+	}
+	lv_test_assert_int_eq(0, fails, "Input split at every byte");
+
+	fails = 0;
+	for (split = 0; split <= total; split++)
+	{
+		memset(out, 0xA5, sizeof(out));
+		lv_holo_anim_rle_init(&rle, unit);
+		uint32_t n = lv_holo_anim_rle_decode(&rle, enc, enc_len, &used, out, split);
+		if (n != split || out[split] != 0xA5) fails++;
+		n += lv_holo_anim_rle_decode(&rle, enc + used, enc_len - used, &used2, out + n, total - n);
+		if (n != total || used + used2 != enc_len || memcmp(raw, out, total) != 0) fails++;
+	}
+	lv_test_assert_int_eq(0, fails, "Output split at every byte");
+
+	/* The last unit of a run missing */
+	lv_holo_anim_rle_init(&rle, unit);
+	enc[0] = 0x80 | 3;
+	enc[1] = 0x42;
+	lv_test_assert_int_eq(0, lv_holo_anim_rle_decode(&rle, enc, 2, &used, out, total), "Incomplete run unit");
+	lv_test_assert_int_eq(2, used, "Incomplete run unit is taken");
+}
+
+static void key_frame(lv_img_cf_t cf, uint8_t unit)
+{
+	lv_test_print("");
+	lv_test_print("Key frames with %d byte pixels:", unit);
+
+	lv_holo_anim_header_t header;
+	header_init(&header, cf, unit);
+	uint32_t size = lv_holo_anim_frame_size(&header);
+	lv_area_t area;
+	lv_obj_get_coords(img, &area);
+
+	frame_fill(&header, next, 1);
+	inv_clear();
+	lv_test_assert_true(lv_holo_anim_frame_apply(&header, size, next, frame, img), "Uncompressed frame applied");
+	lv_test_assert_array_eq(next, frame, size, "Uncompressed frame");
+	lv_test_assert_int_eq(0, inv_check(&area, 1), "Whole image invalidated");
+
+	lv_test_assert_true(!lv_holo_anim_frame_apply(&header, size - 1, next, frame, img), "Short frame refused");
+	lv_test_assert_true(!lv_holo_anim_frame_apply(&header, size + 1, next, frame, img), "Long frame refused");
+
+	uint32_t enc_len = rle_encode(unit, next, size, enc);
+	lv_test_assert_int_lt(size, enc_len, "Frame compressed");
+	memset(frame, 0, sizeof(frame));
+	inv_clear();
+	lv_test_assert_true(lv_holo_anim_frame_apply(&header, enc_len | LV_HOLO_ANIM_RLE, enc, frame, img),
+		"RLE frame applied");
+	lv_test_assert_array_eq(next, frame, size, "RLE frame");
+	lv_test_assert_int_eq(0, inv_check(&area, 1), "Whole image invalidated");
+
+	uint32_t applied = 0;
+	uint32_t len;
+	for (len = 0; len < enc_len; len++)
+	{
+		if (lv_holo_anim_frame_apply(&header, len | LV_HOLO_ANIM_RLE, enc, frame, img)) applied++;
+	}
+	lv_test_assert_int_eq(0, applied, "Every truncated RLE frame refused");
+}
+
+static void delta_frame(lv_img_cf_t cf, uint8_t unit, bool rle)
+{
+	lv_test_print("");
+	lv_test_print("%s delta frames with %d byte pixels:", rle ? "RLE" : "Uncompressed", unit);
+
+	lv_holo_anim_header_t header;
+	header_init(&header, cf, unit);
+	uint32_t size = lv_holo_anim_frame_size(&header);
+	uint32_t flags = LV_HOLO_ANIM_DELTA | (rle ? LV_HOLO_ANIM_RLE : 0);
+
+	/* The first and the clipped last tile of the first row, the clipped corner tile */
+	frame_fill(&header, prev, 1);
+	memcpy(next, prev, size);
+	tile_touch(&header, next, 0, 0);
+	tile_touch(&header, next, 2, 0);
+	tile_touch(&header, next, 2, 1);
+	uint32_t len = delta_build(&header, prev, next, rle, enc);
+
+	/* One area per row of tiles, from the first to the last changed tile */
+	lv_area_t areas[2];
+	lv_area_set(&areas[0], OBJ_X, OBJ_Y, OBJ_X + IMG_W - 1, OBJ_Y + TILE_SIZE - 1);
+	lv_area_set(&areas[1], OBJ_X + 2 * TILE_SIZE, OBJ_Y + TILE_SIZE, OBJ_X + IMG_W - 1, OBJ_Y + IMG_H - 1);
+
+	memcpy(frame, prev, size);
+	inv_clear();
+	lv_test_assert_true(lv_holo_anim_frame_apply(&header, len | flags, enc, frame, img), "Delta frame applied");
+	lv_test_assert_array_eq(next, frame, size, "Delta frame");
+	lv_test_assert_int_eq(0, inv_check(areas, 2), "Rows of changed tiles invalidated");
+
+	uint32_t applied = 0;
+	uint32_t n;
+	for (n = 0; n < len; n++)
+	{
+		memcpy(frame, prev, size);
+		if (lv_holo_anim_frame_apply(&header, n | flags, enc, frame, img)) applied++;
+	}
+	lv_test_assert_int_eq(0, applied, "Every truncated delta frame refused");
+
+	/* A tile in the bitmap without its pixels */
+	enc[0] |= 1 << 1;
+	memcpy(frame, prev, size);
+	lv_test_assert_true(!lv_holo_anim_frame_apply(&header, len | flags, enc, frame, img), "Damaged bitmap refused");
+
+	header.tile_size = 0;
+	lv_test_assert_true(!lv_holo_anim_frame_apply(&header, len | flags, enc, frame, img),
+		"Delta frame without tiles refused");
+}
+
+static void header_init(lv_holo_anim_header_t* header, lv_img_cf_t cf, uint8_t unit)
+{
+	memset(header, 0, sizeof(lv_holo_anim_header_t));
+	memcpy(header->magic, LV_HOLO_ANIM_MAGIC, 4);
+	header->version = LV_HOLO_ANIM_VERSION;
+	header->rle_unit = unit;
+	header->header.cf = cf;
+	header->header.w = IMG_W;
+	header->header.h = IMG_H;
+	header->frame_cnt = 2;
+	header->tile_size = TILE_SIZE;
+}
+
+/* Runs of 3 equal pixels, so RLE has something to do */
+static void frame_fill(const lv_holo_anim_header_t* header, uint8_t* frame, uint8_t seed)
+{
+	uint32_t px_size = header->rle_unit;
+	lv_coord_t x;
+	lv_coord_t y;
+	for (y = 0; y < IMG_H; y++)
+	{
+		for (x = 0; x < IMG_W; x++)
+		{
+			uint32_t b;
+			for (b = 0; b < px_size; b++)
+			{
+				frame[(y * IMG_W + x) * px_size + b] = (uint8_t)(seed + y * 13 + x / 3 * 5 + b);
+			}
+		}
+	}
+}
+
+/* Change the bottom right pixel of a tile, the one clipped away at the edges */
+static void tile_touch(const lv_holo_anim_header_t* header, uint8_t* frame, lv_coord_t col, lv_coord_t row)
+{
+	lv_coord_t x = LV_MATH_MIN((col + 1) * TILE_SIZE, IMG_W) - 1;
+	lv_coord_t y = LV_MATH_MIN((row + 1) * TILE_SIZE, IMG_H) - 1;
+	frame[(y * IMG_W + x) * header->rle_unit] ^= 0xFF;
+}
+
+/* Like ImageToHolo's get_holo_anim.py: the bitmap of the changed tiles, then their clipped lines */
+static uint32_t delta_build(const lv_holo_anim_header_t* header, const uint8_t* prev, const uint8_t* next,
+	bool rle, uint8_t* out)
+{
+	uint32_t px_size = header->rle_unit;
+	uint32_t bitmap_size = lv_holo_anim_delta_bitmap_size(header);
+	uint32_t px_len = 0;
+	uint32_t tile_id = 0;
+	memset(out, 0, bitmap_size);
+
+	lv_coord_t ty;
+	lv_coord_t tx;
+	lv_coord_t y;
+	for (ty = 0; ty < IMG_H; ty += TILE_SIZE)
+	{
+		lv_coord_t th = LV_MATH_MIN(TILE_SIZE, IMG_H - ty);
+		for (tx = 0; tx < IMG_W; tx += TILE_SIZE, tile_id++)
+		{
+			lv_coord_t tw = LV_MATH_MIN(TILE_SIZE, IMG_W - tx);
+			uint32_t line_len = tw * px_size;
+			bool changed = false;
+			for (y = ty; y < ty + th; y++)
+			{
+				uint32_t ofs = (y * IMG_W + tx) * px_size;
+				if (memcmp(&prev[ofs], &next[ofs], line_len) != 0) changed = true;
+			}
+			if (!changed) continue;
+
+			out[tile_id >> 3] |= 1 << (tile_id & 7);
+			for (y = ty; y < ty + th; y++)
+			{
+				memcpy(&raw[px_len], &next[(y * IMG_W + tx) * px_size], line_len);
+				px_len += line_len;
+			}
+		}
+	}
+
+	if (rle) return bitmap_size + rle_encode(px_size, raw, px_len, out + bitmap_size);
+	memcpy(out + bitmap_size, raw, px_len);
+	return bitmap_size + px_len;
+}
+
+/* Runs of 2 or more equal units, literals of the rest */
+static uint32_t rle_encode(uint8_t unit, const uint8_t* in, uint32_t len, uint8_t* out)
+{
+	uint32_t units = len / unit;
+	uint32_t out_len = 0;
+	uint32_t i = 0;
+	while (i < units)
+	{
+		uint32_t run = 1;
+		while (i + run < units && run < 128 && memcmp(&in[i * unit], &in[(i + run) * unit], unit) == 0) run++;
+		if (run >= 2)
+		{
+			out[out_len++] = 0x80 | (run - 1);
+			memcpy(&out[out_len], &in[i * unit], unit);
+			out_len += unit;
+			i += run;
+			continue;
+		}
+
+		uint32_t lit = 1;
+		while (i + lit < units && lit < 128 &&
+			(i + lit + 1 == units || memcmp(&in[(i + lit) * unit], &in[(i + lit + 1) * unit], unit) != 0)) lit++;
+		out[out_len++] = lit - 1;
+		memcpy(&out[out_len], &in[i * unit], lit * unit);
+		out_len += lit * unit;
+		i += lit;
+	}
+	return out_len;
+}
+
+static void inv_clear(void)
+{
+	_lv_inv_area(lv_obj_get_disp(img), NULL);
+}
+
+/* Number of display tiles (or areas without `LV_REFR_TILE_TRACK`) not invalidated as `areas` */
+static uint32_t inv_check(const lv_area_t* areas, uint32_t cnt)
+{
+	lv_disp_t* disp = lv_obj_get_disp(img);
+	uint32_t bad = 0;
+	uint32_t i;
+#if LV_REFR_TILE_TRACK
+	lv_coord_t row;
+	lv_coord_t col;
+	for (row = 0; row < LV_REFR_TILE_ROWS; row++)
+	{
+		for (col = 0; col < LV_REFR_TILE_COLS; col++)
+		{
+			lv_area_t tile;
+			lv_area_set(&tile, col * LV_REFR_TILE_SIZE, row * LV_REFR_TILE_SIZE,
+				(col + 1) * LV_REFR_TILE_SIZE - 1, (row + 1) * LV_REFR_TILE_SIZE - 1);
+			bool expected = false;
+			for (i = 0; i < cnt; i++)
+			{
+				if (_lv_area_is_on(&tile, &areas[i])) expected = true;
+			}
+			bool marked = (disp->inv_tiles[row][col >> 5] >> (col & 0x1F)) & 1;
+			if (expected != marked) bad++;
+		}
+	}
+#else
+	if (disp->inv_p != cnt) return LV_MATH_MAX(cnt, disp->inv_p);
+	for (i = 0; i < cnt; i++)
+	{
+		if (memcmp(&disp->inv_areas[i], &areas[i], sizeof(lv_area_t)) != 0) bad++;
+	}
+#endif
+	return bad;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file lv_test_holo_anim.h
+ *
+ */
+
+#ifndef LV_TEST_HOLO_ANIM_H
+#define LV_TEST_HOLO_ANIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* RLE decoder and key/delta frames of the animation container (lv_holo_anim.c) */
+	void lv_test_holo_anim(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_HOLO_ANIM_H*/
@@ -0,0 +1,248 @@
+/**
+ * @file lv_test_holo_img.c
+ *
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <string.h>
+#include "lvgl.h"
+#include "ff.h"
+#include "lv_holo_img.h"
+#include "lv_test_assert.h"
+#include "lv_test_holo_img.h"
+
+/*********************
+*      DEFINES
+*********************/
+#define IMG_PATH        "/lv_test_holo_img.himg"
+#define IMG_SRC         "S:" IMG_PATH
+#define IMG_W           7
+#define IMG_H           19  /*Not a multiple of the restart rows: the last block is shorter*/
+#define RESTART_ROWS    4
+#define PX_SIZE         2
+#define BLOCK0_OFS      0x24    /*The first marker of the fixture*/
+#define BLOCK1_OFS      0x48
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void lines_down(void);
+static void lines_back(void);
+static void restart_markers(void);
+static void truncated(void);
+static void damaged_header(void);
+static bool img_open(lv_img_decoder_dsc_t* dsc, const uint8_t* data, uint32_t len);
+static uint32_t line_check(lv_img_decoder_dsc_t* dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len);
+static uint8_t px_byte(lv_coord_t x, lv_coord_t y, uint32_t b);
+static void file_write(const char* path, const uint8_t* data, uint32_t len);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+/* ImageToHolo's himg_pack() of a 7x19 RGB565 (swapped) image with 4 restart rows, the pixels of px_byte() */
+static const uint8_t himg[] = {
+	0x48, 0x49, 0x4D, 0x47, 0x01, 0x00, 0x02, 0x00, 0x04, 0x1E, 0x60, 0x02, 0x04, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0x9C, 0x00, 0x00, 0x00, 0x82, 0x00, 0x01, 0x82, 0x05, 0x06, 0x00, 0x0A, 0x0B, 0x82, 0x0D, 0x0E,
+	0x82, 0x12, 0x13, 0x00, 0x17, 0x18, 0x82, 0x1A, 0x1B, 0x82, 0x1F, 0x20, 0x00, 0x24, 0x25, 0x82,
+	0x27, 0x28, 0x82, 0x2C, 0x2D, 0x00, 0x31, 0x32, 0x82, 0x34, 0x35, 0x82, 0x39, 0x3A, 0x00, 0x3E,
+	0x3F, 0x82, 0x41, 0x42, 0x82, 0x46, 0x47, 0x00, 0x4B, 0x4C, 0x82, 0x4E, 0x4F, 0x82, 0x53, 0x54,
+	0x00, 0x58, 0x59, 0x82, 0x5B, 0x5C, 0x82, 0x60, 0x61, 0x00, 0x65, 0x66, 0x94, 0x5A, 0x5B, 0x82,
+	0x8F, 0x90, 0x82, 0x94, 0x95, 0x00, 0x99, 0x9A, 0x82, 0x9C, 0x9D, 0x82, 0xA1, 0xA2, 0x00, 0xA6,
+	0xA7, 0x82, 0xA9, 0xAA, 0x82, 0xAE, 0xAF, 0x00, 0xB3, 0xB4, 0x82, 0xB6, 0xB7, 0x82, 0xBB, 0xBC,
+	0x00, 0xC0, 0xC1, 0x82, 0xC3, 0xC4, 0x82, 0xC8, 0xC9, 0x00, 0xCD, 0xCE, 0x82, 0xD0, 0xD1, 0x82,
+	0xD5, 0xD6, 0x00, 0xDA, 0xDB, 0x82, 0xDD, 0xDE, 0x82, 0xE2, 0xE3, 0x00, 0xE7, 0xE8, 0x82, 0xEA,
+	0xEB, 0x82, 0xEF, 0xF0, 0x00, 0xF4, 0xF5
+};
+static uint8_t file_buf[sizeof(himg)];
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_holo_img(void)
+{
+	lv_test_print("");
+	lv_test_print("===========================");
+	lv_test_print("Start lv_holo_img testing");
+	lv_test_print("===========================");
+
+	lv_holo_img_decoder_init();
+
+	lines_down();
+	lines_back();
+	restart_markers();
+	truncated();
+	damaged_header();
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+static void lines_down(void)
+{
+	lv_test_print("");
+	lv_test_print("Lines read downwards:");
+
+	lv_img_decoder_dsc_t dsc;
+	lv_test_assert_true(img_open(&dsc, himg, sizeof(himg)), "Opened");
+	lv_test_assert_int_eq(LV_IMG_CF_TRUE_COLOR, dsc.header.cf, "Color format");
+	lv_test_assert_int_eq(IMG_W, dsc.header.w, "Width");
+	lv_test_assert_int_eq(IMG_H, dsc.header.h, "Height");
+
+	uint32_t bad = 0;
+	lv_coord_t y;
+	for (y = 0; y < IMG_H; y++) bad += line_check(&dsc, 0, y, IMG_W);
+	lv_test_assert_int_eq(0, bad, "Whole lines");
+
+	/* Parts of the lines skip the rest of the line before */
+	bad = 0;
+	for (y = 0; y < IMG_H; y++) bad += line_check(&dsc, 2, y, 3);
+	lv_test_assert_int_eq(0, bad, "Middle of the lines");
+	lv_img_decoder_close(&dsc);
+}
+
+static void lines_back(void)
+{
+	lv_test_print("");
+	lv_test_print("Lines read backwards:");
+
+	lv_img_decoder_dsc_t dsc;
+	lv_test_assert_true(img_open(&dsc, himg, sizeof(himg)), "Opened");
+
+	uint32_t bad = 0;
+	lv_coord_t y;
+	for (y = IMG_H - 1; y >= 0; y--) bad += line_check(&dsc, 0, y, IMG_W);
+	lv_test_assert_int_eq(0, bad, "Upwards");
+
+	/* Rows 8..10 are one run of pixels, row 9 starts in the middle of it */
+	static const lv_coord_t rows[] = { 18, 0, 9, 8, 10, 3, 4, 17, 9 };
+	bad = 0;
+	uint32_t i;
+	for (i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) bad += line_check(&dsc, 1, rows[i], IMG_W - 1);
+	lv_test_assert_int_eq(0, bad, "Any order, from the middle of a run");
+
+	bad = 0;
+	for (y = IMG_H - 1; y >= 0; y--) bad += line_check(&dsc, IMG_W - 1, y, 1);
+	lv_test_assert_int_eq(0, bad, "Last pixel upwards");
+	lv_img_decoder_close(&dsc);
+}
+
+/* With the data of the first block damaged only its lines are wrong: the others are found by their markers */
+static void restart_markers(void)
+{
+	lv_test_print("");
+	lv_test_print("Restart markers:");
+
+	memcpy(file_buf, himg, sizeof(himg));
+	memset(&file_buf[BLOCK0_OFS], 0x7F, BLOCK1_OFS - BLOCK0_OFS);
+
+	lv_img_decoder_dsc_t dsc;
+	lv_test_assert_true(img_open(&dsc, file_buf, sizeof(file_buf)), "Opened");
+
+	uint32_t bad = 0;
+	lv_coord_t y;
+	for (y = RESTART_ROWS; y < IMG_H; y++) bad += line_check(&dsc, 0, y, IMG_W);
+	lv_test_assert_int_eq(0, bad, "Blocks after the damaged one");
+
+	bad = 0;
+	for (y = IMG_H - 1; y >= RESTART_ROWS; y -= 3) bad += line_check(&dsc, 0, y, IMG_W);
+	lv_test_assert_int_eq(0, bad, "Blocks after the damaged one upwards");
+
+	lv_test_assert_int_gt(0, line_check(&dsc, 0, 1, IMG_W), "Damaged block");
+	lv_test_assert_int_eq(0, line_check(&dsc, 0, IMG_H - 1, IMG_W), "Last line after the damaged block");
+	lv_img_decoder_close(&dsc);
+}
+
+static void truncated(void)
+{
+	lv_test_print("");
+	lv_test_print("Truncated files:");
+
+	uint32_t opened = 0;
+	uint32_t read = 0;
+	uint32_t len;
+	for (len = 0; len < sizeof(himg); len++)
+	{
+		lv_img_decoder_dsc_t dsc;
+		if (!img_open(&dsc, himg, len)) continue;
+		opened++;
+
+		uint8_t buf[IMG_W * PX_SIZE];
+		bool ok = true;
+		lv_coord_t y;
+		for (y = 0; y < IMG_H && ok; y++) ok = lv_img_decoder_read_line(&dsc, 0, y, IMG_W, buf) == LV_RES_OK;
+		if (ok) read++;
+		lv_img_decoder_close(&dsc);
+	}
+
+	/* Opened with the header and the markers, the data is read line by line */
+	lv_test_assert_int_eq(sizeof(himg) - BLOCK0_OFS, opened, "Opened without the whole data");
+	lv_test_assert_int_eq(0, read, "Every truncated file fails at a line");
+}
+
+static void damaged_header(void)
+{
+	lv_test_print("");
+	lv_test_print("Damaged headers:");
+
+	lv_img_decoder_dsc_t dsc;
+	lv_holo_img_header_t* header = (lv_holo_img_header_t*)file_buf;
+
+	memcpy(file_buf, himg, sizeof(himg));
+	header->magic[0] = 'X';
+	lv_test_assert_true(!img_open(&dsc, file_buf, sizeof(file_buf)), "Magic refused");
+
+	memcpy(file_buf, himg, sizeof(himg));
+	header->version++;
+	lv_test_assert_true(!img_open(&dsc, file_buf, sizeof(file_buf)), "Version refused");
+
+	memcpy(file_buf, himg, sizeof(himg));
+	header->restart_rows = 0;
+	lv_test_assert_true(!img_open(&dsc, file_buf, sizeof(file_buf)), "No restart rows refused");
+
+	memcpy(file_buf, himg, sizeof(himg));
+	header->header.reserved = LV_COLOR_16_SWAP ? LV_IMG_BYTE_ORDER_565 : LV_IMG_BYTE_ORDER_565_SWAP;
+	lv_test_assert_true(!img_open(&dsc, file_buf, sizeof(file_buf)), "Other RGB565 byte order refused");
+}
+
+static bool img_open(lv_img_decoder_dsc_t* dsc, const uint8_t* data, uint32_t len)
+{
+	file_write(IMG_PATH, data, len);
+	return lv_img_decoder_open(dsc, IMG_SRC, LV_COLOR_BLACK) == LV_RES_OK;
+}
+
+/* Number of wrong bytes in a line read from the decoder, all of them if it can't be read */
+static uint32_t line_check(lv_img_decoder_dsc_t* dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len)
+{
+	uint8_t buf[IMG_W * PX_SIZE];
+	if (lv_img_decoder_read_line(dsc, x, y, len, buf) != LV_RES_OK) return len * PX_SIZE;
+
+	uint32_t bad = 0;
+	uint32_t i;
+	for (i = 0; i < len * PX_SIZE; i++)
+	{
+		if (buf[i] != px_byte(x + i / PX_SIZE, y, i % PX_SIZE)) bad++;
+	}
+	return bad;
+}
+
+/* Runs of 3 pixels in the lines, rows 8..10 one color */
+static uint8_t px_byte(lv_coord_t x, lv_coord_t y, uint32_t b)
+{
+	if (y >= 8 && y < 11) return 0x5A + b;
+	return (uint8_t)(y * 13 + x / 3 * 5 + b);
+}
+
+static void file_write(const char* path, const uint8_t* data, uint32_t len)
+{
+	FIL fil;
+	UINT bw = 0;
+	if (f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) lv_test_exit("Can't create %s", path);
+	f_write(&fil, data, len, &bw);
+	f_close(&fil);
+	if (bw != len) lv_test_exit("Can't write %s", path);
+}
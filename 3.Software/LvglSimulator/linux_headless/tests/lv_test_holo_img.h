@@ -0,0 +1,20 @@
+/**
+ * @file lv_test_holo_img.h
+ *
+ */
+
+#ifndef LV_TEST_HOLO_IMG_H
+#define LV_TEST_HOLO_IMG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* Image decoder of the compressed image files (lv_holo_img.c) */
+	void lv_test_holo_img(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_HOLO_IMG_H*/
@@ -0,0 +1,321 @@
+/**
+ * @file lv_test_holo_jpeg.c
+ *
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "ff.h"
+#include "lv_holo_jpeg.h"
+#include "lv_test_assert.h"
+#include "lv_test_holo_jpeg.h"
+
+/*********************
+*      DEFINES
+*********************/
+#define JPEG_PATH       "/lv_test_holo_jpeg.jpg"
+#define JPEG_SRC        "S:" JPEG_PATH
+#define W_MAX           32
+
+/**********************
+*      TYPEDEFS
+**********************/
+typedef struct
+{
+	const char* name;
+	const uint8_t* jpeg;
+	const uint32_t* size;
+	const uint8_t* rgb;
+	lv_coord_t w;
+	lv_coord_t h;
+	uint8_t tol;				/* of a color channel (0..255) of the scaled images */
+} fixture_t;
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void full_size(const fixture_t* f);
+static void scaled(const fixture_t* f);
+static void truncated(const fixture_t* f);
+static void progressive(void);
+static void oversized(void);
+static bool jpeg_open(lv_img_decoder_dsc_t* dsc, const uint8_t* data, uint32_t len);
+static uint32_t line_check(lv_img_decoder_dsc_t* dsc, const fixture_t* f, lv_coord_t y, uint8_t scale);
+static void ref_avg(const fixture_t* f, lv_coord_t x, lv_coord_t y, uint8_t scale, uint8_t* rgb);
+static bool marker_find(const uint8_t* data, uint32_t len, uint8_t marker, uint32_t* pos);
+static void file_write(const char* path, const uint8_t* data, uint32_t len);
+
+/**********************
+*  GLOBAL PROTOTYPES
+**********************/
+/* img_test_jpeg.c */
+extern const uint8_t lv_test_jpeg_444[];
+extern const uint32_t lv_test_jpeg_444_size;
+extern const uint8_t lv_test_jpeg_444_rgb[];
+extern const uint8_t lv_test_jpeg_422[];
+extern const uint32_t lv_test_jpeg_422_size;
+extern const uint8_t lv_test_jpeg_422_rgb[];
+extern const uint8_t lv_test_jpeg_420[];
+extern const uint32_t lv_test_jpeg_420_size;
+extern const uint8_t lv_test_jpeg_420_rgb[];
+extern const uint8_t lv_test_jpeg_progressive[];
+extern const uint32_t lv_test_jpeg_progressive_size;
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+/* `tol`: lv_holo_jpeg averages Y, Cb and Cr, not RGB, and RGB565 drops 2 or 3 bits.
+ * 4:2:2 chroma is scaled like the luma and then doubled, so it's the average of twice the columns */
+static const fixture_t fixtures[] =
+{
+	{ "4:4:4, restart interval of 3 MCUs", lv_test_jpeg_444, &lv_test_jpeg_444_size, lv_test_jpeg_444_rgb, 20, 12, 10 },
+	{ "4:2:2", lv_test_jpeg_422, &lv_test_jpeg_422_size, lv_test_jpeg_422_rgb, 24, 16, 48 },
+	{ "4:2:0, restart interval of 1 MCU", lv_test_jpeg_420, &lv_test_jpeg_420_size, lv_test_jpeg_420_rgb, 32, 32, 10 },
+};
+static uint8_t file_buf[1024];
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_holo_jpeg(void)
+{
+	lv_test_print("");
+	lv_test_print("===========================");
+	lv_test_print("Start lv_holo_jpeg testing");
+	lv_test_print("===========================");
+
+	lv_holo_jpeg_decoder_init();
+
+	uint32_t i;
+	for (i = 0; i < sizeof(fixtures) / sizeof(fixtures[0]); i++) full_size(&fixtures[i]);
+	for (i = 0; i < sizeof(fixtures) / sizeof(fixtures[0]); i++) scaled(&fixtures[i]);
+	for (i = 0; i < sizeof(fixtures) / sizeof(fixtures[0]); i++) truncated(&fixtures[i]);
+	progressive();
+	oversized();
+
+	lv_holo_jpeg_set_fit(LV_HOR_RES_MAX, LV_VER_RES_MAX);
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+/* The same pixels as libjpeg, line by line in both directions */
+static void full_size(const fixture_t* f)
+{
+	lv_test_print("");
+	lv_test_print("%s:", f->name);
+
+	lv_holo_jpeg_set_fit(0, 0);
+	lv_img_decoder_dsc_t dsc;
+	lv_test_assert_true(jpeg_open(&dsc, f->jpeg, *f->size), "Opened");
+	lv_test_assert_int_eq(LV_IMG_CF_TRUE_COLOR, dsc.header.cf, "Color format");
+	lv_test_assert_int_eq(f->w, dsc.header.w, "Width");
+	lv_test_assert_int_eq(f->h, dsc.header.h, "Height");
+
+	uint32_t bad = 0;
+	lv_coord_t y;
+	for (y = 0; y < f->h; y++) bad += line_check(&dsc, f, y, 0);
+	lv_test_assert_int_eq(0, bad, "Pixels of libjpeg downwards");
+
+	bad = 0;
+	for (y = f->h - 1; y >= 0; y--) bad += line_check(&dsc, f, y, 0);
+	lv_test_assert_int_eq(0, bad, "Pixels of libjpeg upwards");
+	lv_img_decoder_close(&dsc);
+}
+
+/* 1/2, 1/4 and 1/8 picked by the fit size, against the average of libjpeg's pixels */
+static void scaled(const fixture_t* f)
+{
+	lv_test_print("");
+	lv_test_print("%s scaled down:", f->name);
+
+	uint8_t scale;
+	for (scale = 1; scale <= 3; scale++)
+	{
+		lv_coord_t w = (f->w + (1 << scale) - 1) >> scale;
+		lv_coord_t h = (f->h + (1 << scale) - 1) >> scale;
+		lv_holo_jpeg_set_fit(w, h);
+
+		lv_img_decoder_dsc_t dsc;
+		lv_test_assert_true(jpeg_open(&dsc, f->jpeg, *f->size), "Opened");
+		lv_test_assert_int_eq(w, dsc.header.w, "Width");
+		lv_test_assert_int_eq(h, dsc.header.h, "Height");
+
+		lv_img_header_t header;
+		lv_test_assert_int_eq(LV_RES_OK, lv_img_decoder_get_info(JPEG_SRC, &header), "Info");
+		lv_test_assert_int_eq(w, header.w, "Width of the info");
+
+		uint32_t bad = 0;
+		lv_coord_t y;
+		for (y = h - 1; y >= 0; y--) bad += line_check(&dsc, f, y, scale);
+		lv_test_assert_int_eq(0, bad, scale == 1 ? "1/2" : scale == 2 ? "1/4" : "1/8");
+		lv_img_decoder_close(&dsc);
+	}
+}
+
+/* Cut anywhere before the EOI marker: refused by the open or by a line read */
+static void truncated(const fixture_t* f)
+{
+	lv_test_print("");
+	lv_test_print("%s truncated:", f->name);
+
+	uint32_t size = *f->size;
+	uint32_t sos = 0;
+	lv_test_assert_true(marker_find(f->jpeg, size, 0xDA, &sos), "Start of scan found");
+
+	lv_holo_jpeg_set_fit(0, 0);
+	uint32_t opened = 0;
+	uint32_t read = 0;
+	uint32_t len;
+	for (len = 0; len < size - 2; len++)
+	{
+		lv_img_decoder_dsc_t dsc;
+		if (!jpeg_open(&dsc, f->jpeg, len)) continue;
+		opened++;
+
+		lv_color_t buf[W_MAX];
+		bool ok = true;
+		lv_coord_t y;
+		for (y = 0; y < f->h && ok; y++) ok = lv_img_decoder_read_line(&dsc, 0, y, f->w, (uint8_t*)buf) == LV_RES_OK;
+		if (ok) read++;
+		lv_img_decoder_close(&dsc);
+	}
+	lv_test_assert_int_eq(size - 2 - (sos + 14), opened, "Opened with the whole scan header");
+	lv_test_assert_int_eq(0, read, "Every truncated file fails at a line");
+
+	/* Everything but the EOI marker: all the data is there */
+	lv_img_decoder_dsc_t dsc;
+	lv_test_assert_true(jpeg_open(&dsc, f->jpeg, size - 2), "Opened without the EOI marker");
+	lv_test_assert_int_eq(0, line_check(&dsc, f, f->h - 1, 0), "Last line without the EOI marker");
+	lv_img_decoder_close(&dsc);
+}
+
+static void progressive(void)
+{
+	lv_test_print("");
+	lv_test_print("Progressive file:");
+
+	lv_img_decoder_dsc_t dsc;
+	lv_img_header_t header;
+	file_write(JPEG_PATH, lv_test_jpeg_progressive, lv_test_jpeg_progressive_size);
+	lv_test_assert_int_eq(LV_RES_INV, lv_img_decoder_get_info(JPEG_SRC, &header), "Info refused");
+	lv_test_assert_true(!jpeg_open(&dsc, lv_test_jpeg_progressive, lv_test_jpeg_progressive_size), "Refused");
+}
+
+/* Sizes in the frame header that can't be decoded */
+static void oversized(void)
+{
+	lv_test_print("");
+	lv_test_print("Oversized files:");
+
+	uint32_t size = lv_test_jpeg_444_size;
+	uint32_t sof = 0;
+	lv_test_assert_true(marker_find(lv_test_jpeg_444, size, 0xC0, &sof), "Frame header found");
+	lv_holo_jpeg_set_fit(0, 0);
+
+	static const uint16_t sizes[][2] = { { 65535, 65535 }, { 65535, 12 }, { 20, 20000 }, { 0, 12 }, { 20, 0 } };
+	uint32_t opened = 0;
+	uint32_t i;
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		memcpy(file_buf, lv_test_jpeg_444, size);
+		file_buf[sof + 5] = sizes[i][1] >> 8;
+		file_buf[sof + 6] = sizes[i][1] & 0xFF;
+		file_buf[sof + 7] = sizes[i][0] >> 8;
+		file_buf[sof + 8] = sizes[i][0] & 0xFF;
+
+		lv_img_decoder_dsc_t dsc;
+		if (jpeg_open(&dsc, file_buf, size))
+		{
+			opened++;
+			lv_img_decoder_close(&dsc);
+		}
+	}
+	lv_test_assert_int_eq(0, opened, "Larger than 2047 pixels at 1/8 or empty refused");
+}
+
+static bool jpeg_open(lv_img_decoder_dsc_t* dsc, const uint8_t* data, uint32_t len)
+{
+	file_write(JPEG_PATH, data, len);
+	return lv_img_decoder_open(dsc, JPEG_SRC, LV_COLOR_BLACK) == LV_RES_OK;
+}
+
+/* Number of wrong pixels in a line read from the decoder, all of them if it can't be read.
+ * Full size: exactly libjpeg's pixels in RGB565, scaled: the average of them with the fixture's `tol` */
+static uint32_t line_check(lv_img_decoder_dsc_t* dsc, const fixture_t* f, lv_coord_t y, uint8_t scale)
+{
+	lv_color_t buf[W_MAX];
+	lv_coord_t w = dsc->header.w;
+	if (lv_img_decoder_read_line(dsc, 0, y, w, (uint8_t*)buf) != LV_RES_OK) return w;
+
+	uint32_t bad = 0;
+	lv_coord_t x;
+	for (x = 0; x < w; x++)
+	{
+		uint8_t rgb[3];
+		ref_avg(f, x, y, scale, rgb);
+		lv_color_t ref = lv_color_make(rgb[0], rgb[1], rgb[2]);
+		if (scale == 0)
+		{
+			if (buf[x].full != ref.full) bad++;
+			continue;
+		}
+
+		lv_color32_t act32;
+		lv_color32_t ref32;
+		act32.full = lv_color_to32(buf[x]);
+		ref32.full = lv_color_to32(ref);
+		if (abs(act32.ch.red - ref32.ch.red) > f->tol || abs(act32.ch.green - ref32.ch.green) > f->tol ||
+			abs(act32.ch.blue - ref32.ch.blue) > f->tol) bad++;
+	}
+	return bad;
+}
+
+/* The average of the 2^scale x 2^scale pixels of libjpeg under a scaled pixel.
+ * Past the edges the last column and row are repeated, like the encoder fills the MCUs */
+static void ref_avg(const fixture_t* f, lv_coord_t x, lv_coord_t y, uint8_t scale, uint8_t* rgb)
+{
+	uint32_t n = 1 << scale;
+	uint32_t sum[3] = { 0, 0, 0 };
+	uint32_t i, j, c;
+	for (j = 0; j < n; j++)
+	{
+		for (i = 0; i < n; i++)
+		{
+			lv_coord_t sx = LV_MATH_MIN((x << scale) + i, f->w - 1);
+			lv_coord_t sy = LV_MATH_MIN((y << scale) + j, f->h - 1);
+			for (c = 0; c < 3; c++) sum[c] += f->rgb[(sy * f->w + sx) * 3 + c];
+		}
+	}
+	for (c = 0; c < 3; c++) rgb[c] = (sum[c] + n * n / 2) / (n * n);
+}
+
+static bool marker_find(const uint8_t* data, uint32_t len, uint8_t marker, uint32_t* pos)
+{
+	uint32_t i;
+	for (i = 0; i + 1 < len; i++)
+	{
+		if (data[i] == 0xFF && data[i + 1] == marker)
+		{
+			*pos = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+static void file_write(const char* path, const uint8_t* data, uint32_t len)
+{
+	FIL fil;
+	UINT bw = 0;
+	if (f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) lv_test_exit("Can't create %s", path);
+	f_write(&fil, data, len, &bw);
+	f_close(&fil);
+	if (bw != len) lv_test_exit("Can't write %s", path);
+}
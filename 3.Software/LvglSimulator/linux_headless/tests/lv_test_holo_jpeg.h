@@ -0,0 +1,20 @@
+/**
+ * @file lv_test_holo_jpeg.h
+ *
+ */
+
+#ifndef LV_TEST_HOLO_JPEG_H
+#define LV_TEST_HOLO_JPEG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* Baseline JPEG decoder against libjpeg's pixels, scaling and refused files (lv_holo_jpeg.c) */
+	void lv_test_holo_jpeg(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_HOLO_JPEG_H*/
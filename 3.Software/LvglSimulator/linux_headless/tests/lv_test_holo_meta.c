@@ -0,0 +1,177 @@
+/**
+ * @file lv_test_holo_meta.c
+ *
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <string.h>
+#include "lvgl.h"
+#include "ff.h"
+#include "lv_port_fatfs.h"
+#include "lv_holo_meta.h"
+#include "lv_test_assert.h"
+#include "lv_test_holo_meta.h"
+
+/*********************
+*      DEFINES
+*********************/
+#define IMG_PATH        "/lv_test_holo_meta.bin"
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void first_and_again(void);
+static void changed_elsewhere(void);
+static void written_here(void);
+static void forgotten(void);
+static void img_write_ff(lv_coord_t w, lv_coord_t h);
+static void img_write_lv(lv_coord_t w, lv_coord_t h);
+static uint32_t img_fill(uint8_t* buf, lv_coord_t w, lv_coord_t h);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static uint8_t img_buf[4 + 16 * 16 * LV_COLOR_SIZE / 8];
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_holo_meta(void)
+{
+	lv_test_print("");
+	lv_test_print("===========================");
+	lv_test_print("Start lv_holo_meta testing");
+	lv_test_print("===========================");
+
+	lv_holo_meta_init(NULL, lv_fs_if_stat);
+	lv_fs_if_set_open_cb(lv_holo_meta_file_opened);
+
+	first_and_again();
+	changed_elsewhere();
+	written_here();
+	forgotten();
+
+	lv_fs_if_set_open_cb(NULL);
+	lv_holo_meta_invalidate(NULL);
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+static void first_and_again(void)
+{
+	lv_test_print("");
+	lv_test_print("Read once, then from the index:");
+
+	lv_holo_meta_stats_t stats;
+	lv_holo_meta_t meta;
+	img_write_ff(4, 2);
+	lv_holo_meta_get_stats(&stats);
+
+	lv_test_assert_true(lv_holo_meta_get("S:" IMG_PATH, &meta), "Found");
+	lv_test_assert_int_eq(4, meta.header.w, "Width");
+	lv_test_assert_int_eq(2, meta.header.h, "Height");
+	lv_test_assert_int_eq(img_fill(img_buf, 4, 2), meta.size, "Size of the file");
+
+	lv_test_assert_true(lv_holo_meta_get("S:" IMG_PATH, &meta), "Found again");
+	lv_test_assert_int_eq(4, meta.header.w, "Width again");
+	lv_holo_meta_get_stats(&stats);
+	lv_test_assert_int_eq(1, stats.misses, "Read once");
+	lv_test_assert_int_eq(1, stats.hits, "Then from the index");
+
+	lv_test_assert_true(!lv_holo_meta_get("S:/lv_test_holo_meta_none.bin", &meta), "Missing file");
+}
+
+/* Like on a PC: the index sees it from the size or the time */
+static void changed_elsewhere(void)
+{
+	lv_test_print("");
+	lv_test_print("Changed without the \"S:\" drive:");
+
+	lv_holo_meta_stats_t stats;
+	lv_holo_meta_t meta;
+	img_write_ff(8, 2);
+	lv_holo_meta_get_stats(&stats);
+
+	lv_test_assert_true(lv_holo_meta_get("S:" IMG_PATH, &meta), "Found");
+	lv_test_assert_int_eq(8, meta.header.w, "New width");
+	lv_holo_meta_get_stats(&stats);
+	lv_test_assert_int_eq(1, stats.changed, "Entry of the changed file dropped");
+	lv_test_assert_int_eq(1, stats.misses, "Read again");
+}
+
+/* Same size within the same second: only the open for writing tells */
+static void written_here(void)
+{
+	lv_test_print("");
+	lv_test_print("Written through the \"S:\" drive:");
+
+	lv_holo_meta_stats_t stats;
+	lv_holo_meta_t meta;
+	img_write_lv(2, 8);
+	lv_holo_meta_get_stats(&stats);
+
+	lv_test_assert_true(lv_holo_meta_get("S:" IMG_PATH, &meta), "Found");
+	lv_test_assert_int_eq(2, meta.header.w, "New width");
+	lv_test_assert_int_eq(8, meta.header.h, "New height");
+	lv_holo_meta_get_stats(&stats);
+	lv_test_assert_int_eq(1, stats.misses, "Read again");
+}
+
+/* By lv_holo_io and SdCard with the paths of the card */
+static void forgotten(void)
+{
+	lv_test_print("");
+	lv_test_print("Forget a file:");
+
+	lv_holo_meta_stats_t stats;
+	lv_holo_meta_t meta;
+	lv_holo_meta_get_stats(&stats);
+
+	lv_holo_meta_invalidate(IMG_PATH);
+	lv_holo_meta_get("S:" IMG_PATH, &meta);
+	lv_holo_meta_get_stats(&stats);
+	lv_test_assert_int_eq(1, stats.misses, "Path without the drive letter");
+	lv_test_assert_int_eq(1, stats.entry_cnt, "Added again");
+}
+
+/* Without the "S:" drive, like a PC */
+static void img_write_ff(lv_coord_t w, lv_coord_t h)
+{
+	FIL fil;
+	UINT bw = 0;
+	uint32_t len = img_fill(img_buf, w, h);
+	if (f_open(&fil, IMG_PATH, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) lv_test_exit("Can't create %s", IMG_PATH);
+	f_write(&fil, img_buf, len, &bw);
+	f_close(&fil);
+}
+
+static void img_write_lv(lv_coord_t w, lv_coord_t h)
+{
+	lv_fs_file_t file;
+	uint32_t bw = 0;
+	uint32_t len = img_fill(img_buf, w, h);
+	if (lv_fs_open(&file, "S:" IMG_PATH, LV_FS_MODE_WR) != LV_FS_RES_OK) lv_test_exit("Can't open %s", IMG_PATH);
+	lv_fs_write(&file, img_buf, len, &bw);
+	lv_fs_trunc(&file);
+	lv_fs_close(&file);
+}
+
+/* A true color image file of LVGL's built-in decoder, returns its size */
+static uint32_t img_fill(uint8_t* buf, lv_coord_t w, lv_coord_t h)
+{
+	lv_img_header_t header;
+	memset(&header, 0, sizeof(header));
+	header.cf = LV_IMG_CF_TRUE_COLOR;
+	header.w = w;
+	header.h = h;
+	memcpy(buf, &header, sizeof(header));
+
+	uint32_t len = sizeof(header) + w * h * LV_COLOR_SIZE / 8;
+	memset(&buf[sizeof(header)], 0x5a, len - sizeof(header));
+	return len;
+}
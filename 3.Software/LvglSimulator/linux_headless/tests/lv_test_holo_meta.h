@@ -0,0 +1,20 @@
+/**
+ * @file lv_test_holo_meta.h
+ *
+ */
+
+#ifndef LV_TEST_HOLO_META_H
+#define LV_TEST_HOLO_META_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* Index of the image headers (lv_holo_meta.c on the "S:" drive of lv_port_fatfs.c) */
+	void lv_test_holo_meta(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_HOLO_META_H*/
@@ -0,0 +1,318 @@
+/**
+ * @file lv_test_port_fs_cache.c
+ *
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <pthread.h>
+#include <string.h>
+#include "lvgl.h"
+#include "lv_port_fatfs.h"
+#include "lv_port_fs_cache.h"
+#include "lv_test_assert.h"
+#include "lv_test_port_fs_cache.h"
+
+/*********************
+*      DEFINES
+*********************/
+#define FILE_PATH       "/lv_test_port_fs_cache.bin"
+#define FILE_SIZE       20000   /*Doesn't end at a sector*/
+#define SECTOR          LV_PORT_FS_CACHE_SECTOR
+#define CACHE_SIZE      (LV_PORT_FS_CACHE_SECTORS * SECTOR)
+#define THREAD_READS    1000000
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void read_ahead(void);
+static void unaligned(void);
+static void larger_than_cache(void);
+static void end_of_file(void);
+static void write_invalidates(void);
+static void trunc_invalidates(void);
+static void stats_threads(void);
+static void extra_size(void);
+static void file_create(void);
+static void file_open(lv_fs_file_t* file, lv_fs_mode_t mode);
+static void read_check(lv_fs_file_t* file, uint32_t pos, uint32_t btr, uint32_t br_ref, const char* s);
+static uint8_t file_byte(uint32_t pos);
+static lv_fs_res_t mem_read_at(void* file, uint32_t pos, void* buf, uint32_t btr, uint32_t* br);
+static void* stats_thread_cb(void* param);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static uint8_t buf[FILE_SIZE];
+static uint8_t ref[FILE_SIZE];
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_port_fs_cache(void)
+{
+	lv_test_print("");
+	lv_test_print("===========================");
+	lv_test_print("Start lv_port_fs_cache testing");
+	lv_test_print("===========================");
+
+	uint32_t i;
+	for (i = 0; i < FILE_SIZE; i++) ref[i] = file_byte(i);
+	file_create();
+	lv_fs_if_set_cache(LV_PORT_FS_CACHE_SECTORS);
+
+	read_ahead();
+	unaligned();
+	larger_than_cache();
+	end_of_file();
+	write_invalidates();
+	trunc_invalidates();
+	stats_threads();
+	extra_size();
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+/* Small reads going on: the first sector, then the whole cache at once */
+static void read_ahead(void)
+{
+	lv_test_print("");
+	lv_test_print("Read-ahead:");
+
+	lv_fs_file_t file;
+	lv_port_fs_cache_stats_t stats;
+	file_open(&file, LV_FS_MODE_RD);
+	lv_port_fs_cache_get_stats(&stats);
+
+	uint32_t reads = 0;
+	uint32_t pos;
+	for (pos = 0; pos < CACHE_SIZE; pos += 100, reads++) read_check(&file, pos, 100, 100, NULL);
+	lv_fs_close(&file);
+
+	lv_port_fs_cache_get_stats(&stats);
+	lv_test_assert_int_eq(2, stats.misses, "Two reads of the file");
+	lv_test_assert_int_eq(reads - 2, stats.hits, "The others from the cache");
+	lv_test_assert_int_eq(SECTOR + CACHE_SIZE, stats.bytes_file, "A sector, then the whole cache");
+	lv_test_assert_int_eq(reads * 100, stats.bytes_read, "Bytes given to the reader");
+	lv_test_assert_int_eq(0, stats.bytes_direct, "Nothing read around the cache");
+}
+
+/* A seek, then a read across sectors: only its sectors */
+static void unaligned(void)
+{
+	lv_test_print("");
+	lv_test_print("Unaligned read:");
+
+	lv_fs_file_t file;
+	lv_port_fs_cache_stats_t stats;
+	file_open(&file, LV_FS_MODE_RD);
+	read_check(&file, 10, 20, 20, NULL);
+	lv_port_fs_cache_get_stats(&stats);
+
+	read_check(&file, 5000, 1000, 1000, "Read across three sectors");
+	lv_port_fs_cache_get_stats(&stats);
+	lv_test_assert_int_eq(1, stats.misses, "One read of the file");
+	lv_test_assert_int_eq(3 * SECTOR, stats.bytes_file, "Only the sectors of the read");
+	lv_test_assert_int_eq(0, stats.bytes_direct, "Nothing read around the cache");
+
+	read_check(&file, 5900, 100, 100, "Read from the cached sectors");
+	lv_port_fs_cache_get_stats(&stats);
+	lv_test_assert_int_eq(1, stats.hits, "Served from the cache");
+	lv_fs_close(&file);
+}
+
+/* The whole sectors straight into the reader's buffer, the rest through the cache */
+static void larger_than_cache(void)
+{
+	lv_test_print("");
+	lv_test_print("Read larger than the cache:");
+
+	lv_fs_file_t file;
+	lv_port_fs_cache_stats_t stats;
+	file_open(&file, LV_FS_MODE_RD);
+	lv_port_fs_cache_get_stats(&stats);
+
+	uint32_t len = CACHE_SIZE + SECTOR + 100;
+	read_check(&file, 2 * SECTOR, len, len, "Aligned read");
+	lv_port_fs_cache_get_stats(&stats);
+	lv_test_assert_int_eq(CACHE_SIZE + SECTOR, stats.bytes_direct, "Whole sectors around the cache");
+	lv_test_assert_int_eq(CACHE_SIZE + 2 * SECTOR, stats.bytes_file, "The last sector through the cache");
+
+	/* The cache filled up to a sector, the sector after it directly, the rest through the cache again */
+	read_check(&file, 2 * SECTOR + 100, len, len, "Unaligned read");
+	lv_port_fs_cache_get_stats(&stats);
+	lv_test_assert_int_eq(SECTOR, stats.bytes_direct, "Whole sector around the cache");
+	lv_test_assert_int_eq(CACHE_SIZE + 2 * SECTOR, stats.bytes_file, "Every byte read once");
+	lv_fs_close(&file);
+}
+
+static void end_of_file(void)
+{
+	lv_test_print("");
+	lv_test_print("End of the file:");
+
+	lv_fs_file_t file;
+	file_open(&file, LV_FS_MODE_RD);
+	read_check(&file, FILE_SIZE - 100, 300, 100, "Short read at the end");
+	read_check(&file, FILE_SIZE, 300, 0, "Nothing after the end");
+	read_check(&file, FILE_SIZE - 50, 10, 10, "Last bytes again");
+
+	/* Straight into the reader's buffer */
+	uint32_t pos = (FILE_SIZE - CACHE_SIZE) & ~(SECTOR - 1);
+	read_check(&file, pos, 2 * CACHE_SIZE, FILE_SIZE - pos, "Large short read at the end");
+	read_check(&file, FILE_SIZE + 1000, 100, 0, "Nothing beyond the end");
+	lv_fs_close(&file);
+}
+
+static void write_invalidates(void)
+{
+	lv_test_print("");
+	lv_test_print("Write:");
+
+	lv_fs_file_t file;
+	file_open(&file, LV_FS_MODE_RD | LV_FS_MODE_WR);
+	read_check(&file, 0, 100, 100, "Cached");
+
+	const uint8_t data[] = { 'H', 'o', 'l', 'o' };
+	uint32_t bw = 0;
+	uint32_t pos = 0;
+	lv_fs_seek(&file, 10);
+	lv_test_assert_int_eq(LV_FS_RES_OK, lv_fs_write(&file, data, sizeof(data), &bw), "Written");
+	lv_fs_tell(&file, &pos);
+	lv_test_assert_int_eq(10 + sizeof(data), pos, "Position after the write");
+	memcpy(&ref[10], data, sizeof(data));
+
+	read_check(&file, 0, 100, 100, "New data after the write");
+	lv_fs_close(&file);
+
+	file_create();
+}
+
+static void trunc_invalidates(void)
+{
+	lv_test_print("");
+	lv_test_print("Truncate:");
+
+	lv_fs_file_t file;
+	file_open(&file, LV_FS_MODE_RD | LV_FS_MODE_WR);
+	uint32_t pos;
+	for (pos = 0; pos < 2 * SECTOR; pos += 100) read_check(&file, pos, 100, 100, NULL);
+
+	uint32_t size = 0;
+	lv_fs_seek(&file, 1000);
+	lv_test_assert_int_eq(LV_FS_RES_OK, lv_fs_trunc(&file), "Truncated");
+	lv_fs_size(&file, &size);
+	lv_test_assert_int_eq(1000, size, "Size after the truncation");
+
+	read_check(&file, 900, 300, 100, "Nothing cached after the new end");
+	lv_fs_close(&file);
+
+	file_create();
+}
+
+/* The counters of files read at the same time by the LVGL core and the I/O workers add up */
+static void stats_threads(void)
+{
+	lv_test_print("");
+	lv_test_print("Statistics of two threads:");
+
+	lv_port_fs_cache_stats_t stats;
+	lv_port_fs_cache_get_stats(&stats);
+
+	pthread_t threads[2];
+	int i;
+	for (i = 0; i < 2; i++) pthread_create(&threads[i], NULL, stats_thread_cb, NULL);
+	for (i = 0; i < 2; i++) pthread_join(threads[i], NULL);
+
+	lv_port_fs_cache_get_stats(&stats);
+	lv_test_assert_int_eq(2 * THREAD_READS, stats.hits + stats.misses, "Reads counted");
+	lv_test_assert_int_eq(2 * THREAD_READS, stats.bytes_read, "Bytes counted");
+}
+
+/* The decoders count the cache's buffer of their open file in the image cache's budget */
+static void extra_size(void)
+{
+	lv_test_print("");
+	lv_test_print("Memory of an open file:");
+
+	lv_fs_drv_t* drv = lv_fs_get_drv('S');
+	lv_test_assert_int_eq(CACHE_SIZE, drv->file_extra_size, "The cache's buffer");
+
+	lv_fs_if_set_cache(0);
+	lv_test_assert_int_eq(0, drv->file_extra_size, "Nothing without a cache");
+	lv_fs_if_set_cache(LV_PORT_FS_CACHE_SECTORS);
+}
+
+static void file_create(void)
+{
+	lv_fs_file_t file;
+	uint32_t bw = 0;
+	uint32_t i;
+	for (i = 0; i < FILE_SIZE; i++) ref[i] = file_byte(i);
+
+	file_open(&file, LV_FS_MODE_WR);
+	lv_fs_write(&file, ref, FILE_SIZE, &bw);
+	lv_fs_trunc(&file);
+	lv_fs_close(&file);
+	if (bw != FILE_SIZE) lv_test_exit("Can't write %s", FILE_PATH);
+}
+
+static void file_open(lv_fs_file_t* file, lv_fs_mode_t mode)
+{
+	if (lv_fs_open(file, "S:" FILE_PATH, mode) != LV_FS_RES_OK) lv_test_exit("Can't open %s", FILE_PATH);
+}
+
+/* Read at `pos` and compare with the file, assert only if `s` is set */
+static void read_check(lv_fs_file_t* file, uint32_t pos, uint32_t btr, uint32_t br_ref, const char* s)
+{
+	uint32_t br = 0;
+	memset(buf, 0, sizeof(buf));
+	lv_fs_seek(file, pos);
+	lv_fs_res_t res = lv_fs_read(file, buf, btr, &br);
+
+	if (s)
+	{
+		lv_test_assert_int_eq(LV_FS_RES_OK, res, s);
+		lv_test_assert_int_eq(br_ref, br, s);
+		lv_test_assert_array_eq(&ref[LV_MATH_MIN(pos, FILE_SIZE)], buf, br, s);
+	}
+	else if (res != LV_FS_RES_OK || br != br_ref || memcmp(&ref[pos], buf, br) != 0)
+	{
+		lv_test_error("   FAIL: read of %u bytes at %u", btr, pos);
+	}
+}
+
+/* Different in every sector */
+static uint8_t file_byte(uint32_t pos)
+{
+	return (uint8_t)(pos * 7 + pos / SECTOR);
+}
+
+static lv_fs_res_t mem_read_at(void* file, uint32_t pos, void* buf, uint32_t btr, uint32_t* br)
+{
+	*br = LV_MATH_MIN(btr, FILE_SIZE - LV_MATH_MIN(pos, FILE_SIZE));
+	memcpy(buf, &ref[pos], *br);
+	return LV_FS_RES_OK;
+}
+
+/* Byte reads through a cache of its own, most of them hits */
+static void* stats_thread_cb(void* param)
+{
+	lv_port_fs_cache_t cache;
+	lv_port_fs_cache_init(&cache, NULL, mem_read_at, LV_PORT_FS_CACHE_SECTORS);
+
+	uint32_t i;
+	for (i = 0; i < THREAD_READS; i++)
+	{
+		uint8_t b;
+		uint32_t br;
+		cache.pos = i % FILE_SIZE;
+		lv_port_fs_cache_read(&cache, &b, 1, &br);
+	}
+	lv_port_fs_cache_free(&cache);
+	return NULL;
+}
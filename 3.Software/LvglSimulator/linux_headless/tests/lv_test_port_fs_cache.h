@@ -0,0 +1,20 @@
+/**
+ * @file lv_test_port_fs_cache.h
+ *
+ */
+
+#ifndef LV_TEST_PORT_FS_CACHE_H
+#define LV_TEST_PORT_FS_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* Read cache of the "S:" drive (lv_port_fs_cache.c through lv_port_fatfs.c) */
+	void lv_test_port_fs_cache(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_PORT_FS_CACHE_H*/
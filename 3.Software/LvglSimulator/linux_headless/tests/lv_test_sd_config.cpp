@@ -0,0 +1,164 @@
+/**
+ * @file lv_test_sd_config.cpp
+ *
+ */
+
+/*********************
+*      INCLUDES
+*********************/
+#include <stdio.h>
+#include "sd_config.h"
+#include "ff.h"
+#include "lv_test_assert.h"
+#include "lv_test_sd_config.h"
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void parse(void);
+static void reload(void);
+static void many_keys(void);
+static void line_files(void);
+static void too_long(void);
+static void file_write(const char* path, const char* text, bool append);
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static const char* const wifi_keys[] = { "wifi.ssid", "wifi.password" };
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void lv_test_sd_config(void)
+{
+	lv_test_print("");
+	lv_test_print("===========================");
+	lv_test_print("Start sd_config testing");
+	lv_test_print("===========================");
+
+	parse();
+	reload();
+	many_keys();
+	line_files();
+	too_long();
+}
+
+/**********************
+*   STATIC FUNCTIONS
+**********************/
+
+static void parse(void)
+{
+	lv_test_print("");
+	lv_test_print("Parse a config file:");
+
+	file_write("/config.txt", "# comment\r\n  wifi.ssid =  my net \r\nwifi.password=a=b#c\n\nbacklight = 0.25\n"
+		"fps=0x19\non = Yes\noff=0\nwifi.ssid = other\nnoeq line\n=empty key\nlast = x", false);
+
+	Config config;
+	lv_test_assert_true(config.load("/config.txt"), "Loaded");
+	lv_test_assert_int_eq(7, config.count(), "Keys, not the empty one");
+	lv_test_assert_str_eq("other", config.getString("wifi.ssid"), "The last of a repeated key");
+	lv_test_assert_str_eq("a=b#c", config.getString("wifi.password"), "Value with '=' and '#'");
+	lv_test_assert_true(config.getFloat("backlight") == 0.25f, "Float");
+	lv_test_assert_int_eq(0, config.getInt("backlight", 7), "Float as int");
+	lv_test_assert_int_eq(25, config.getInt("fps"), "Hex int");
+	lv_test_assert_true(config.getBool("on"), "Bool yes");
+	lv_test_assert_true(!config.getBool("off", true), "Bool 0");
+	lv_test_assert_int_eq(0, config.getInt("off", 5), "Int 0");
+	lv_test_assert_true(config.getBool("wifi.ssid", true), "Default of a string as bool");
+	lv_test_assert_str_eq("x", config.getString("last"), "Last line without '\\n'");
+	lv_test_assert_true(!config.has("noeq line"), "Line without '='");
+	lv_test_assert_str_eq("d", config.getString("nope", "d"), "Default of a missing key");
+	lv_test_assert_true(!config.load("/none.txt"), "Missing file");
+}
+
+static void reload(void)
+{
+	lv_test_print("");
+	lv_test_print("Reload a changed file:");
+
+	Config config;
+	file_write("/config.txt", "a = 1\n", false);
+	config.load("/config.txt");
+	lv_test_assert_true(!config.reload(), "Not read again while unchanged");
+
+	file_write("/config.txt", "new = 3\n", true);
+	lv_test_assert_true(config.reload(), "Read again after an append");
+	lv_test_assert_int_eq(3, config.getInt("new"), "New key");
+	lv_test_assert_int_eq(1, config.getInt("a"), "Old key");
+}
+
+static void many_keys(void)
+{
+	lv_test_print("");
+	lv_test_print("More keys than entries:");
+
+	char text[CONFIG_FILE_MAX];
+	uint32_t len = 0;
+	int i;
+	for (i = 0; i < CONFIG_ENTRY_MAX + 8; i++) len += snprintf(&text[len], sizeof(text) - len, "k%d = %d\n", i, i);
+	file_write("/many.txt", text, false);
+
+	Config config;
+	lv_test_assert_true(config.load("/many.txt"), "Loaded");
+	lv_test_assert_int_eq(CONFIG_ENTRY_MAX, config.count(), "Keys kept");
+
+	int bad = 0;
+	for (i = 0; i < CONFIG_ENTRY_MAX + 8; i++)
+	{
+		char key[8];
+		snprintf(key, sizeof(key), "k%d", i);
+		if (config.getInt(key, -1) != (i < CONFIG_ENTRY_MAX ? i : -1)) bad++;
+	}
+	lv_test_assert_int_eq(0, bad, "The first keys found, the others ignored");
+}
+
+static void line_files(void)
+{
+	lv_test_print("");
+	lv_test_print("Line by line file:");
+
+	file_write("/wifi.txt", "ssid x \r\npass word\r\n", false);
+	Config config;
+	lv_test_assert_true(config.loadLines("/wifi.txt", wifi_keys, 2), "Loaded");
+	lv_test_assert_str_eq("ssid x", config.getString("wifi.ssid"), "Line 1");
+	lv_test_assert_str_eq("pass word", config.getString("wifi.password"), "Line 2");
+
+	file_write("/wifi.txt", "longer ssid\npw", false);
+	lv_test_assert_true(config.reload(), "Read again after a change");
+	lv_test_assert_str_eq("longer ssid", config.getString("wifi.ssid"), "Line 1 again");
+	lv_test_assert_str_eq("pw", config.getString("wifi.password"), "Line 2 again");
+}
+
+static void too_long(void)
+{
+	lv_test_print("");
+	lv_test_print("File too long:");
+
+	file_write("/config.txt", "a = 1\n", false);
+	Config config;
+	config.load("/config.txt");
+
+	static char text[CONFIG_FILE_MAX + 2];
+	memset(text, 'a', sizeof(text) - 1);
+	text[sizeof(text) - 1] = '\0';
+	file_write("/big.txt", text, false);
+	lv_test_assert_true(!config.load("/big.txt"), "Not loaded");
+	lv_test_assert_int_eq(1, config.getInt("a"), "Previous keys kept");
+}
+
+static void file_write(const char* path, const char* text, bool append)
+{
+	FIL fil;
+	UINT bw = 0;
+	if (f_open(&fil, path, FA_WRITE | (append ? FA_OPEN_ALWAYS : FA_CREATE_ALWAYS)) != FR_OK)
+	{
+		lv_test_exit("Can't create %s", path);
+	}
+	f_lseek(&fil, append ? f_size(&fil) : 0);
+	f_write(&fil, text, strlen(text), &bw);
+	f_close(&fil);
+}
@@ -0,0 +1,20 @@
+/**
+ * @file lv_test_sd_config.h
+ *
+ */
+
+#ifndef LV_TEST_SD_CONFIG_H
+#define LV_TEST_SD_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/* Config files on the "S:" drive (sd_config.cpp) */
+	void lv_test_sd_config(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_SD_CONFIG_H*/